@@ -3,6 +3,9 @@
 #include <cstring>
 #include "type_traits.h"
 #include "iterator.h"
+#include "simd.h"
+
+#include <type_traits>
 
 namespace mystl {
 
@@ -27,9 +30,70 @@ namespace mystl {
         return comp(b, a) ? b : a;
     }
 
+    // ȼλͬıָ롢ö٣ NaN  0 ڴ
+    template<class T>
+    struct __is_bitwise_comparable
+        : bool_constant<std::is_integral<T>::value || std::is_pointer<T>::value || std::is_enum<T>::value> {};
+
+    // ָͬһλɱȽ͵ָʱֱӱȽڴ
+    template<class Iter1, class Iter2, bool = std::is_pointer<Iter1>::value && std::is_pointer<Iter2>::value>
+    struct __is_bitwise_range : false_type {};
+
+    template<class Iter1, class Iter2>
+    struct __is_bitwise_range<Iter1, Iter2, true>
+        : bool_constant<is_same<std::remove_cv_t<std::remove_pointer_t<Iter1>>,
+                                std::remove_cv_t<std::remove_pointer_t<Iter2>>>::value &&
+                        __is_bitwise_comparable<std::remove_cv_t<std::remove_pointer_t<Iter1>>>::value> {};
+
+    template<class T>
+    inline const unsigned char* __as_bytes(T* p) {
+        return reinterpret_cast<const unsigned char*>(p);
+    }
+
+    // ֽ޷ֱ memcmpλһͬԪٱȽ
+    template<class T1, class T2>
+    bool __lexicographical_compare_bitwise(T1* first1, T1* last1, T2* first2, T2* last2) {
+        using T = std::remove_cv_t<T1>;
+        const size_t len1 = last1 - first1;
+        const size_t len2 = last2 - first2;
+        const size_t len = min(len1, len2);
+        if (len == 0) return len1 < len2;
+        if constexpr (sizeof(T) == 1 && !std::is_signed<T>::value) {
+            const int result = memcmp(first1, first2, len);
+            return result != 0 ? result < 0 : len1 < len2;
+        } else {
+            const size_t i = __simd_mismatch(__as_bytes(first1), __as_bytes(first2), len * sizeof(T)) / sizeof(T);
+            return i != len ? first1[i] < first2[i] : len1 < len2;
+        }
+    }
+
+    template<class InputIterator1, class InputIterator2>
+    inline bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+        if constexpr (__is_bitwise_range<InputIterator1, InputIterator2>::value) {
+            const size_t n = last1 - first1;
+            return n == 0 || memcmp(first1, first2, n * sizeof(*first1)) == 0;
+        } else {
+            for (; first1 != last1; ++first1, ++first2) {
+                if (!(*first1 == *first2)) return false;
+            }
+            return true;
+        }
+    }
+
+    template<class InputIterator1, class InputIterator2, class BinaryPredicate>
+    inline bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate pred) {
+        for (; first1 != last1; ++first1, ++first2) {
+            if (!pred(*first1, *first2)) return false;
+        }
+        return true;
+    }
+
     template<class InputIterator1, class InputIterator2>
     bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
                                 InputIterator2 first2, InputIterator2 last2) {
+    if constexpr (__is_bitwise_range<InputIterator1, InputIterator2>::value) {
+        return mystl::__lexicographical_compare_bitwise(first1, last1, first2, last2);
+    }
     for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
         if (*first1 < *first2)
         return true;
@@ -52,17 +116,6 @@ namespace mystl {
         return first1 == last1 && first2 != last2;// ڶ࣬truefalse
     }
 
-    // ԭʼָconst unsigned char*ȫػ汾
-    inline bool lexicographical_compare(const unsigned char* first1,
-        const unsigned char* last1,
-        const unsigned char* first2,
-        const unsigned char* last2) {
-        const size_t len1 = last1 - first1;
-        const size_t len2 = last2 - first2;
-        // ȱȽϳͬĶ
-        const int result = memcmp(first1, first2, min(len1, len2));
-        return result != 0 ? result < 0 : len1 < len2;
-    }
 
 
 
@@ -222,43 +275,81 @@ namespace mystl {
         return first;
     }
 
+    template<typename T>
+    auto move(T &&param) -> decltype(static_cast<remove_reference_t<T> &&>(param)) {
+        using ReturnType = remove_reference_t<T> &&;
+        return static_cast<ReturnType>(param);
+    }
+
+
+    template<typename T>
+    T &&forward(remove_reference_t<T> & param) {
+        return static_cast<T &&>(param);
+    }
+
+    template<typename T>
+    T &&forward(remove_reference_t<T> && param) {
+        return static_cast<T &&>(param);
+    }
+
     // 
     template<class T>
     inline void swap(T& a, T& b) {
-        T temp = a;
-        a = b;
-        b = temp;
+        T temp = mystl::move(a);
+        a = mystl::move(b);
+        b = mystl::move(temp);
     }
 
     // Ҫָ֪Ķܹͣ˱ʹvalue_type
     template<class ForwardIterator1, class ForwardIterator2, class T>
-    inline void iter_swap(ForwardIterator1 a, ForwardIterator2 b, T) {
-        T temp = *a;
-        *a = *b;
-        *b = temp;
+    inline void iter_swap(ForwardIterator1 a, ForwardIterator2 b, T*) {
+        T temp = mystl::move(*a);
+        *a = mystl::move(*b);
+        *b = mystl::move(temp);
     }
 
     template<class ForwardIterator1, class ForwardIterator2>
     inline void iter_swap(ForwardIterator1 a, ForwardIterator2 b) {
-        return iter_swap(a, b, value_type_t<ForwardIterator1>());
+        return iter_swap(a, b, static_cast<value_type_t<ForwardIterator1>*>(nullptr));
     }
 
-    template<typename T>
-    auto move(T &&param) -> decltype(static_cast<remove_reference_t<T> &&>(param)) {
-        using ReturnType = remove_reference_t<T> &&;
-        return static_cast<ReturnType>(param);
+    
+    //  [first, last) ƶ result ʼ䣬result λ (first, last) ֮
+    template<class InputIterator, class OutputIterator>
+    inline OutputIterator move(InputIterator first, InputIterator last, OutputIterator result) {
+        for (; first != last; ++first, ++result) *result = mystl::move(*first);
+        return result;
     }
 
+    // Ӻǰƶresult λ (first, last] ֮
+    template<class BidirectionalIter1, class BidirectionalIter2>
+    inline BidirectionalIter2 move_backward(BidirectionalIter1 first, BidirectionalIter1 last,
+                                            BidirectionalIter2 result) {
+        while (first != last) *--result = mystl::move(*--last);
+        return result;
+    }
 
-    template<typename T>
-    T &&forward(remove_reference_t<T> & param) {
-        return static_cast<T &&>(param);
+    template<class RandomIter>
+    inline void __iter_swap_move(RandomIter a, RandomIter b) {
+        value_type_t<RandomIter> temp = mystl::move(*a);
+        *a = mystl::move(*b);
+        *b = mystl::move(temp);
     }
 
-    template<typename T>
-    T &&forward(remove_reference_t<T> && param) {
-        return static_cast<T &&>(param);
+    // תתҪʵ
+    template<class RandomIter>
+    void reverse(RandomIter first, RandomIter last) {
+        while (first < last) mystl::__iter_swap_move(first++, --last);
     }
 
-    
+    // ηתʵתԭ first Ԫصλ
+    template<class RandomIter>
+    RandomIter rotate(RandomIter first, RandomIter middle, RandomIter last) {
+        if (first == middle) return last;
+        if (middle == last) return first;
+        mystl::reverse(first, middle);
+        mystl::reverse(middle, last);
+        mystl::reverse(first, last);
+        return first + (last - middle);
+    }
 }
\ No newline at end of file
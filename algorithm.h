@@ -0,0 +1,833 @@
+#pragma once
+
+#include "iterator.h"
+#include "algobase.h"
+#include "allocator.h"
+#include "construct.h"
+#include "functional.h"
+#include "heap.h"
+#include "deque.h"
+#include "pair.h"
+#include "simd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>  // bad_alloc
+#include <type_traits>
+
+// 逐元素算法：for_each、transform
+namespace mystl {
+    template<class InputIter, class Function>
+    Function for_each(InputIter first, InputIter last, Function f) {
+        for (; first != last; ++first) f(*first);
+        return f;
+    }
+
+    template<class InputIter, class OutputIter, class UnaryOperation>
+    OutputIter transform(InputIter first, InputIter last, OutputIter result, UnaryOperation op) {
+        for (; first != last; ++first, ++result) *result = op(*first);
+        return result;
+    }
+
+    template<class InputIter1, class InputIter2, class OutputIter, class BinaryOperation>
+    OutputIter transform(InputIter1 first1, InputIter1 last1, InputIter2 first2, OutputIter result,
+                         BinaryOperation op) {
+        for (; first1 != last1; ++first1, ++first2, ++result) *result = op(*first1, *first2);
+        return result;
+    }
+}
+
+
+// 查找与计数：find、find_if、count、count_if、mismatch
+// 迭代器是指向按位可比较类型的指针时使用 simd.h 中的向量化内核
+namespace mystl {
+    // 元素类型 T 与查找值类型 U 相同，或同为非 bool 的整数时，可把查找值转换为 T 后按位查找
+    template<class T, class U>
+    struct __is_simd_searchable
+        : bool_constant<__is_bitwise_comparable<T>::value &&
+                        (is_same<T, U>::value ||
+                         (std::is_integral<T>::value && std::is_integral<U>::value &&
+                          !is_same<T, bool>::value && !is_same<U, bool>::value))> {};
+
+    // 迭代器是指向 __is_simd_searchable 元素的指针时走向量化内核；否则逐个比较，
+    // 向量化分支不会实例化逐个比较的循环
+    template<class Iter, class T, bool = std::is_pointer<Iter>::value>
+    struct __is_simd_search_range : false_type {};
+    template<class Iter, class T>
+    struct __is_simd_search_range<Iter, T, true>
+        : __is_simd_searchable<std::remove_cv_t<std::remove_pointer_t<Iter>>, T> {};
+
+    // 查找值能否转换为元素类型后再无损转回，不能时任何元素都不会与它相等
+    template<class T, class U>
+    inline bool __to_search_bits(const U& value, typename __simd_bits<sizeof(T)>::type& bits) {
+        const T v = static_cast<T>(value);
+        if (static_cast<U>(v) != static_cast<U>(value)) return false;
+        std::memcpy(&bits, &v, sizeof(T));
+        return true;
+    }
+
+    template<class InputIter, class T>
+    InputIter find(InputIter first, InputIter last, const T& value) {
+        if constexpr (__is_simd_search_range<InputIter, T>::value) {
+            using E = std::remove_cv_t<std::remove_pointer_t<InputIter>>;
+            typename __simd_bits<sizeof(E)>::type bits;
+            if (!mystl::__to_search_bits<E>(value, bits)) return last;
+            return first + mystl::__simd_find<sizeof(E)>(__as_bytes(first), static_cast<size_t>(last - first), bits);
+        } else {
+            while (first != last && !(*first == value)) ++first;
+            return first;
+        }
+    }
+
+    template<class InputIter, class Predicate>
+    InputIter find_if(InputIter first, InputIter last, Predicate pred) {
+        while (first != last && !pred(*first)) ++first;
+        return first;
+    }
+
+    template<class InputIter, class T>
+    difference_type_t<InputIter> count(InputIter first, InputIter last, const T& value) {
+        if constexpr (__is_simd_search_range<InputIter, T>::value) {
+            using E = std::remove_cv_t<std::remove_pointer_t<InputIter>>;
+            typename __simd_bits<sizeof(E)>::type bits;
+            if (!mystl::__to_search_bits<E>(value, bits)) return 0;
+            return static_cast<ptrdiff_t>(
+                mystl::__simd_count<sizeof(E)>(__as_bytes(first), static_cast<size_t>(last - first), bits));
+        } else {
+            difference_type_t<InputIter> n = 0;
+            for (; first != last; ++first) {
+                if (*first == value) ++n;
+            }
+            return n;
+        }
+    }
+
+    template<class InputIter, class Predicate>
+    difference_type_t<InputIter> count_if(InputIter first, InputIter last, Predicate pred) {
+        difference_type_t<InputIter> n = 0;
+        for (; first != last; ++first) {
+            if (pred(*first)) ++n;
+        }
+        return n;
+    }
+
+    template<class InputIter1, class InputIter2>
+    pair<InputIter1, InputIter2> mismatch(InputIter1 first1, InputIter1 last1, InputIter2 first2) {
+        if constexpr (__is_bitwise_range<InputIter1, InputIter2>::value) {
+            using E = std::remove_cv_t<std::remove_pointer_t<InputIter1>>;
+            const size_t n = static_cast<size_t>(last1 - first1);
+            const size_t i = n == 0 ? 0 : mystl::__simd_mismatch(__as_bytes(first1), __as_bytes(first2), n * sizeof(E)) / sizeof(E);
+            return pair<InputIter1, InputIter2>(first1 + i, first2 + i);
+        } else {
+            while (first1 != last1 && *first1 == *first2) {
+                ++first1;
+                ++first2;
+            }
+            return pair<InputIter1, InputIter2>(first1, first2);
+        }
+    }
+
+    template<class InputIter1, class InputIter2, class BinaryPredicate>
+    pair<InputIter1, InputIter2> mismatch(InputIter1 first1, InputIter1 last1, InputIter2 first2, BinaryPredicate pred) {
+        while (first1 != last1 && pred(*first1, *first2)) {
+            ++first1;
+            ++first2;
+        }
+        return pair<InputIter1, InputIter2>(first1, first2);
+    }
+
+    // 两个区间长度可以不同，比较到较短者结束
+    template<class InputIter1, class InputIter2>
+    pair<InputIter1, InputIter2> mismatch(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2) {
+        if constexpr (__is_bitwise_range<InputIter1, InputIter2>::value) {
+            const ptrdiff_t n = mystl::min(last1 - first1, static_cast<ptrdiff_t>(last2 - first2));
+            return mystl::mismatch(first1, first1 + n, first2);
+        } else {
+            while (first1 != last1 && first2 != last2 && *first1 == *first2) {
+                ++first1;
+                ++first2;
+            }
+            return pair<InputIter1, InputIter2>(first1, first2);
+        }
+    }
+}
+
+
+// 二分查找：lower_bound、upper_bound、equal_range、binary_search
+// 随机访问迭代器使用无分支版本：每轮区间长度减半只取决于 n，比较结果乘以步长后加到起点上，
+// 不产生难以预测的分支；代价是 CPU 不能再靠分支预测提前取数，大区间改用软件预取补上
+namespace mystl {
+    constexpr size_t __bsearch_prefetch_bytes = 64 * 1024;
+
+    // 返回第一个使 pred 为 false 的位置，要求 [first, last) 已按 pred 划分（前段为 true）
+    // 指针区间大于 __bsearch_prefetch_bytes 时，每轮预取下一轮两个可能的中点。
+    // 随机查找时每次落到的子区间都不同，缩小后的子区间同样不在缓存里，
+    // 因此按整个区间的大小决定是否预取，而不是按当前子区间
+    template<class RandomIter, class Predicate>
+    RandomIter __branchless_partition_point(RandomIter first, RandomIter last, Predicate pred) {
+        using Distance = difference_type_t<RandomIter>;
+        Distance len = last - first;
+        if (len == 0) return first;
+        // 答案始终位于 [first, first + len] 之内
+        if constexpr (std::is_pointer<RandomIter>::value) {
+            if (static_cast<size_t>(len) * sizeof(*first) > __bsearch_prefetch_bytes) {
+                while (len > 1) {
+                    const Distance half = len / 2;
+                    const Distance next_half = (len - half) / 2;
+                    __builtin_prefetch(first + next_half);
+                    __builtin_prefetch(first + half + next_half);
+                    first += static_cast<Distance>(pred(first[half])) * half;
+                    len -= half;
+                }
+                return first + static_cast<Distance>(pred(*first));
+            }
+        }
+        while (len > 1) {
+            const Distance half = len / 2;
+            first += static_cast<Distance>(pred(first[half])) * half;
+            len -= half;
+        }
+        return first + static_cast<Distance>(pred(*first));
+    }
+
+    template<class ForwardIter, class T, class Compare>
+    ForwardIter __lower_bound(ForwardIter first, ForwardIter last, const T& value, Compare& comp,
+                              forward_iterator_tag) {
+        difference_type_t<ForwardIter> len = mystl::distance(first, last);
+        while (len > 0) {
+            auto half = len / 2;
+            ForwardIter mid = first;
+            mystl::advance(mid, half);
+            if (comp(*mid, value)) {
+                first = ++mid;
+                len -= half + 1;
+            } else {
+                len = half;
+            }
+        }
+        return first;
+    }
+
+    template<class RandomIter, class T, class Compare>
+    inline RandomIter __lower_bound(RandomIter first, RandomIter last, const T& value, Compare& comp,
+                                    random_access_iterator_tag) {
+        return mystl::__branchless_partition_point(first, last, [&](const auto& x) { return comp(x, value); });
+    }
+
+    template<class ForwardIter, class T, class Compare>
+    ForwardIter __upper_bound(ForwardIter first, ForwardIter last, const T& value, Compare& comp,
+                              forward_iterator_tag) {
+        difference_type_t<ForwardIter> len = mystl::distance(first, last);
+        while (len > 0) {
+            auto half = len / 2;
+            ForwardIter mid = first;
+            mystl::advance(mid, half);
+            if (comp(value, *mid)) {
+                len = half;
+            } else {
+                first = ++mid;
+                len -= half + 1;
+            }
+        }
+        return first;
+    }
+
+    template<class RandomIter, class T, class Compare>
+    inline RandomIter __upper_bound(RandomIter first, RandomIter last, const T& value, Compare& comp,
+                                    random_access_iterator_tag) {
+        return mystl::__branchless_partition_point(first, last, [&](const auto& x) { return !comp(value, x); });
+    }
+
+    template<class ForwardIter, class T, class Compare>
+    inline ForwardIter lower_bound(ForwardIter first, ForwardIter last, const T& value, Compare comp) {
+        return mystl::__lower_bound(first, last, value, comp, iterator_category_t<ForwardIter>());
+    }
+
+    template<class ForwardIter, class T>
+    inline ForwardIter lower_bound(ForwardIter first, ForwardIter last, const T& value) {
+        return mystl::lower_bound(first, last, value, mystl::less<void>());
+    }
+
+    template<class ForwardIter, class T, class Compare>
+    inline ForwardIter upper_bound(ForwardIter first, ForwardIter last, const T& value, Compare comp) {
+        return mystl::__upper_bound(first, last, value, comp, iterator_category_t<ForwardIter>());
+    }
+
+    template<class ForwardIter, class T>
+    inline ForwardIter upper_bound(ForwardIter first, ForwardIter last, const T& value) {
+        return mystl::upper_bound(first, last, value, mystl::less<void>());
+    }
+
+    template<class ForwardIter, class T, class Compare>
+    pair<ForwardIter, ForwardIter> equal_range(ForwardIter first, ForwardIter last, const T& value, Compare comp) {
+        ForwardIter lo = mystl::lower_bound(first, last, value, comp);
+        return pair<ForwardIter, ForwardIter>(lo, mystl::upper_bound(lo, last, value, comp));
+    }
+
+    template<class ForwardIter, class T>
+    inline pair<ForwardIter, ForwardIter> equal_range(ForwardIter first, ForwardIter last, const T& value) {
+        return mystl::equal_range(first, last, value, mystl::less<void>());
+    }
+
+    template<class ForwardIter, class T, class Compare>
+    inline bool binary_search(ForwardIter first, ForwardIter last, const T& value, Compare comp) {
+        first = mystl::lower_bound(first, last, value, comp);
+        return first != last && !comp(value, *first);
+    }
+
+    template<class ForwardIter, class T>
+    inline bool binary_search(ForwardIter first, ForwardIter last, const T& value) {
+        return mystl::binary_search(first, last, value, mystl::less<void>());
+    }
+}
+
+
+// 排序相关算法：sort、stable_sort、partial_sort、nth_element，均要求随机访问迭代器
+// 它们依赖的 reverse、rotate 定义在 algobase.h
+
+
+// sort：内省排序
+// 快速排序（三数取中）划分到小于阈值的区间后停止，最后整体做一次插入排序；
+// 递归深度超过 2log(n) 时改用堆排序，保证最坏 O(nlogn)
+namespace mystl {
+    constexpr ptrdiff_t __sort_threshold = 16;
+
+    // 计算 floor(log2(n))，用于限制递归深度
+    template<class Size>
+    inline Size __lg(Size n) {
+        Size k = 0;
+        for (; n > 1; n >>= 1) ++k;
+        return k;
+    }
+
+    // 已知 last 左侧存在不大于 *last 的元素，无需检查边界
+    template<class RandomIter, class Compare>
+    void __unguarded_linear_insert(RandomIter last, Compare& comp) {
+        value_type_t<RandomIter> value = mystl::move(*last);
+        RandomIter next = last;
+        --next;
+        while (comp(value, *next)) {
+            *last = mystl::move(*next);
+            last = next;
+            --next;
+        }
+        *last = mystl::move(value);
+    }
+
+    template<class RandomIter, class Compare>
+    void __insertion_sort(RandomIter first, RandomIter last, Compare& comp) {
+        if (first == last) return;
+        for (RandomIter i = first + 1; i != last; ++i) {
+            if (comp(*i, *first)) {// 比首元素还小，整体后移一位
+                value_type_t<RandomIter> value = mystl::move(*i);
+                mystl::move_backward(first, i, i + 1);
+                *first = mystl::move(value);
+            } else {
+                mystl::__unguarded_linear_insert(i, comp);
+            }
+        }
+    }
+
+    template<class RandomIter, class Compare>
+    void __unguarded_insertion_sort(RandomIter first, RandomIter last, Compare& comp) {
+        for (RandomIter i = first; i != last; ++i) mystl::__unguarded_linear_insert(i, comp);
+    }
+
+    // 前 threshold 个元素中必然含有全局最小值，其后的插入均可省去边界检查
+    template<class RandomIter, class Compare>
+    void __final_insertion_sort(RandomIter first, RandomIter last, Compare& comp) {
+        if (last - first > __sort_threshold) {
+            mystl::__insertion_sort(first, first + __sort_threshold, comp);
+            mystl::__unguarded_insertion_sort(first + __sort_threshold, last, comp);
+        } else {
+            mystl::__insertion_sort(first, last, comp);
+        }
+    }
+
+    // 把 a、b、c 的中位数交换到 result
+    template<class RandomIter, class Compare>
+    void __move_median_to_first(RandomIter result, RandomIter a, RandomIter b, RandomIter c, Compare& comp) {
+        if (comp(*a, *b)) {
+            if (comp(*b, *c)) mystl::__iter_swap_move(result, b);
+            else if (comp(*a, *c)) mystl::__iter_swap_move(result, c);
+            else mystl::__iter_swap_move(result, a);
+        } else if (comp(*a, *c)) {
+            mystl::__iter_swap_move(result, a);
+        } else if (comp(*b, *c)) {
+            mystl::__iter_swap_move(result, c);
+        } else {
+            mystl::__iter_swap_move(result, b);
+        }
+    }
+
+    // 以 *pivot 为枢轴划分，两侧各有哨兵，循环内不检查边界
+    template<class RandomIter, class Compare>
+    RandomIter __unguarded_partition(RandomIter first, RandomIter last, RandomIter pivot, Compare& comp) {
+        while (true) {
+            while (comp(*first, *pivot)) ++first;
+            --last;
+            while (comp(*pivot, *last)) --last;
+            if (!(first < last)) return first;
+            mystl::__iter_swap_move(first, last);
+            ++first;
+        }
+    }
+
+    template<class RandomIter, class Compare>
+    inline RandomIter __unguarded_partition_pivot(RandomIter first, RandomIter last, Compare& comp) {
+        RandomIter mid = first + (last - first) / 2;
+        mystl::__move_median_to_first(first, first + 1, mid, last - 1, comp);
+        return mystl::__unguarded_partition(first + 1, last, first, comp);
+    }
+
+    // 使 [first, middle) 成为 [first, last) 中最小的若干元素组成的堆
+    template<class RandomIter, class Compare>
+    void __heap_select(RandomIter first, RandomIter middle, RandomIter last, Compare& comp) {
+        using Distance = difference_type_t<RandomIter>;
+        mystl::make_heap(first, middle, comp);
+        const Distance len = middle - first;
+        for (RandomIter i = middle; i < last; ++i) {
+            if (comp(*i, *first)) {
+                value_type_t<RandomIter> value = mystl::move(*i);
+                *i = mystl::move(*first);
+                mystl::__adjust_heap(first, Distance(0), len, mystl::move(value), comp);
+            }
+        }
+    }
+
+    template<class RandomIter, class Size, class Compare>
+    void __introsort_loop(RandomIter first, RandomIter last, Size depth_limit, Compare& comp) {
+        while (last - first > __sort_threshold) {
+            if (depth_limit == 0) {// 划分过于不均，退化为堆排序
+                mystl::__heap_select(first, last, last, comp);
+                mystl::sort_heap(first, last, comp);
+                return;
+            }
+            --depth_limit;
+            RandomIter cut = mystl::__unguarded_partition_pivot(first, last, comp);
+            mystl::__introsort_loop(cut, last, depth_limit, comp);// 右半递归，左半循环
+            last = cut;
+        }
+    }
+
+    template<class RandomIter, class Compare>
+    inline void __sort(RandomIter first, RandomIter last, Compare& comp) {
+        if (last - first < 2) return;
+        mystl::__introsort_loop(first, last, mystl::__lg(last - first) * 2, comp);
+        mystl::__final_insertion_sort(first, last, comp);
+    }
+
+    template<class RandomIter, class Compare>
+    inline void sort(RandomIter first, RandomIter last, Compare comp) {
+        mystl::__sort(first, last, comp);
+    }
+
+    template<class RandomIter>
+    inline void sort(RandomIter first, RandomIter last) {
+        mystl::sort(first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+}
+
+
+// partial_sort：使 [first, middle) 为整个区间中最小的若干元素并有序
+// nth_element：使 nth 处为排序后应在该处的元素，左侧均不大于它，右侧均不小于它
+namespace mystl {
+    template<class RandomIter, class Compare>
+    void partial_sort(RandomIter first, RandomIter middle, RandomIter last, Compare comp) {
+        if (first == middle) return;
+        mystl::__heap_select(first, middle, last, comp);
+        mystl::sort_heap(first, middle, comp);
+    }
+
+    template<class RandomIter>
+    inline void partial_sort(RandomIter first, RandomIter middle, RandomIter last) {
+        mystl::partial_sort(first, middle, last, mystl::less<value_type_t<RandomIter>>());
+    }
+
+    // 内省选择：只递归进入包含 nth 的一侧，深度超限时改用堆选择
+    template<class RandomIter, class Compare>
+    void nth_element(RandomIter first, RandomIter nth, RandomIter last, Compare comp) {
+        if (first == last || nth == last) return;
+        auto depth_limit = mystl::__lg(last - first) * 2;
+        while (last - first > 3) {
+            if (depth_limit == 0) {
+                mystl::__heap_select(first, nth + 1, last, comp);
+                mystl::__iter_swap_move(first, nth);// 堆顶即前 nth + 1 小中的最大者
+                return;
+            }
+            --depth_limit;
+            RandomIter cut = mystl::__unguarded_partition_pivot(first, last, comp);
+            if (cut <= nth) first = cut;
+            else last = cut;
+        }
+        mystl::__insertion_sort(first, last, comp);
+    }
+
+    template<class RandomIter>
+    inline void nth_element(RandomIter first, RandomIter nth, RandomIter last) {
+        mystl::nth_element(first, nth, last, mystl::less<value_type_t<RandomIter>>());
+    }
+}
+
+
+// stable_sort：归并排序
+// 先对长度为 7 的小段做插入排序，再在原区间与缓冲区之间来回归并；
+// 缓冲区由 simpleAlloc 分配，分配失败时改用无缓冲的原地归并（O(nlog²n)）
+namespace mystl {
+    constexpr ptrdiff_t __chunk_size = 7;
+
+    template<class InputIter1, class InputIter2, class OutputIter, class Compare>
+    OutputIter __move_merge(InputIter1 first1, InputIter1 last1, InputIter2 first2, InputIter2 last2,
+                            OutputIter result, Compare& comp) {
+        while (first1 != last1 && first2 != last2) {
+            if (comp(*first2, *first1)) *result = mystl::move(*first2++);
+            else *result = mystl::move(*first1++);
+            ++result;
+        }
+        result = mystl::move(first1, last1, result);
+        return mystl::move(first2, last2, result);
+    }
+
+    template<class RandomIter, class Compare>
+    void __chunk_insertion_sort(RandomIter first, RandomIter last, ptrdiff_t chunk, Compare& comp) {
+        while (last - first >= chunk) {
+            mystl::__insertion_sort(first, first + chunk, comp);
+            first += chunk;
+        }
+        mystl::__insertion_sort(first, last, comp);
+    }
+
+    // 把长度为 step 的相邻有序段两两归并到 result
+    template<class RandomIter1, class RandomIter2, class Compare>
+    void __merge_sort_loop(RandomIter1 first, RandomIter1 last, RandomIter2 result, ptrdiff_t step, Compare& comp) {
+        const ptrdiff_t two_step = 2 * step;
+        while (last - first >= two_step) {
+            result = mystl::__move_merge(first, first + step, first + step, first + two_step, result, comp);
+            first += two_step;
+        }
+        const ptrdiff_t rest = mystl::min(ptrdiff_t(last - first), step);
+        mystl::__move_merge(first, first + rest, first + rest, last, result, comp);
+    }
+
+    // buffer 中已有 len 个构造好的元素，归并结束后结果位于 [first, last)
+    template<class RandomIter, class T, class Compare>
+    void __merge_sort_with_buffer(RandomIter first, RandomIter last, T* buffer, Compare& comp) {
+        const ptrdiff_t len = last - first;
+        T* const buffer_last = buffer + len;
+        ptrdiff_t step = __chunk_size;
+        mystl::__chunk_insertion_sort(first, last, step, comp);
+        while (step < len) {
+            mystl::__merge_sort_loop(first, last, buffer, step, comp);
+            step *= 2;
+            mystl::__merge_sort_loop(buffer, buffer_last, first, step, comp);
+            step *= 2;
+        }
+    }
+
+    // 无缓冲归并：用二分定位切分点，旋转后递归归并两侧
+    template<class RandomIter, class Distance, class Compare>
+    void __merge_without_buffer(RandomIter first, RandomIter middle, RandomIter last,
+                                Distance len1, Distance len2, Compare& comp) {
+        if (len1 == 0 || len2 == 0) return;
+        if (len1 + len2 == 2) {
+            if (comp(*middle, *first)) mystl::__iter_swap_move(first, middle);
+            return;
+        }
+        RandomIter first_cut = first, second_cut = middle;
+        Distance len11 = 0, len22 = 0;
+        if (len1 > len2) {
+            len11 = len1 / 2;
+            first_cut = first + len11;
+            second_cut = mystl::lower_bound(middle, last, *first_cut, comp);
+            len22 = second_cut - middle;
+        } else {
+            len22 = len2 / 2;
+            second_cut = middle + len22;
+            first_cut = mystl::upper_bound(first, middle, *second_cut, comp);
+            len11 = first_cut - first;
+        }
+        RandomIter new_middle = mystl::rotate(first_cut, middle, second_cut);
+        mystl::__merge_without_buffer(first, first_cut, new_middle, len11, len22, comp);
+        mystl::__merge_without_buffer(new_middle, second_cut, last, len1 - len11, len2 - len22, comp);
+    }
+
+    template<class RandomIter, class Compare>
+    void __inplace_stable_sort(RandomIter first, RandomIter last, Compare& comp) {
+        if (last - first < 15) {
+            mystl::__insertion_sort(first, last, comp);
+            return;
+        }
+        RandomIter middle = first + (last - first) / 2;
+        mystl::__inplace_stable_sort(first, middle, comp);
+        mystl::__inplace_stable_sort(middle, last, comp);
+        mystl::__merge_without_buffer(first, middle, last, middle - first, last - middle, comp);
+    }
+
+    template<class RandomIter, class Compare>
+    void __stable_sort(RandomIter first, RandomIter last, Compare& comp) {
+        using T = value_type_t<RandomIter>;
+        const ptrdiff_t len = last - first;
+        if (len <= __chunk_size) {
+            mystl::__insertion_sort(first, last, comp);
+            return;
+        }
+        T* buffer = nullptr;
+        try {
+            buffer = simpleAlloc<T>::allocate(static_cast<size_t>(len));
+        } catch (const std::bad_alloc&) {
+            mystl::__inplace_stable_sort(first, last, comp);
+            return;
+        }
+        // 缓冲区元素以原区间元素移动构造，此后仅作为移动赋值的目标
+        ptrdiff_t built = 0;
+        try {
+            for (RandomIter it = first; built < len; ++it, ++built) mystl::construct(buffer + built, mystl::move(*it));
+            mystl::move(buffer, buffer + len, first);
+            mystl::__merge_sort_with_buffer(first, last, buffer, comp);
+        } catch (...) {
+            mystl::destroy(buffer, buffer + built);
+            simpleAlloc<T>::deallocate(buffer, static_cast<size_t>(len));
+            throw;
+        }
+        mystl::destroy(buffer, buffer + len);
+        simpleAlloc<T>::deallocate(buffer, static_cast<size_t>(len));
+    }
+
+    template<class RandomIter, class Compare>
+    inline void stable_sort(RandomIter first, RandomIter last, Compare comp) {
+        mystl::__stable_sort(first, last, comp);
+    }
+
+    template<class RandomIter>
+    inline void stable_sort(RandomIter first, RandomIter last) {
+        mystl::stable_sort(first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+}
+
+
+// deque 的分段版本
+// __deque_iterator 的每次加减都要判断是否跨越缓冲区，
+// 因此区间位于同一缓冲区时直接以指针排序，跨越多个缓冲区时按段把元素移到连续的临时区间，
+// 以指针完成排序后再按段移回；临时区间分配失败时退回通用版本
+namespace mystl {
+    // 依次对 [first, last) 覆盖的每个连续段调用 f(段首指针, 段尾指针)
+    template<class T, class Ref, class Ptr, class Function>
+    void __deque_for_each_segment(__deque_iterator<T, Ref, Ptr> first, __deque_iterator<T, Ref, Ptr> last,
+                                  Function f) {
+        if (first.node == last.node) {
+            f(first.cur, last.cur);
+            return;
+        }
+        f(first.cur, first.last);
+        for (auto node = first.node + 1; node != last.node; ++node) {
+            f(*node, *node + __deque_iterator<T, Ref, Ptr>::buffer_size());
+        }
+        f(last.first, last.cur);
+    }
+
+    template<class T, class Compare, class Sorter>
+    void __deque_segmented_sort(__deque_iterator<T, T&, T*> first, __deque_iterator<T, T&, T*> last,
+                                Compare& comp, Sorter sorter) {
+        if (first.node == last.node) {
+            sorter(first.cur, last.cur, comp);
+            return;
+        }
+        const ptrdiff_t len = last - first;
+        T* buffer = nullptr;
+        try {
+            buffer = simpleAlloc<T>::allocate(static_cast<size_t>(len));
+        } catch (const std::bad_alloc&) {
+            sorter(first, last, comp);
+            return;
+        }
+        T* cur = buffer;
+        try {
+            mystl::__deque_for_each_segment(first, last, [&cur](T* b, T* e) {
+                for (; b != e; ++b, ++cur) mystl::construct(cur, mystl::move(*b));
+            });
+            sorter(buffer, buffer + len, comp);
+        } catch (...) {
+            mystl::destroy(buffer, cur);
+            simpleAlloc<T>::deallocate(buffer, static_cast<size_t>(len));
+            throw;
+        }
+        cur = buffer;
+        mystl::__deque_for_each_segment(first, last, [&cur](T* b, T* e) {
+            mystl::move(cur, cur + (e - b), b);
+            cur += e - b;
+        });
+        mystl::destroy(buffer, buffer + len);
+        simpleAlloc<T>::deallocate(buffer, static_cast<size_t>(len));
+    }
+
+    struct __sort_fn {
+        template<class RandomIter, class Compare>
+        void operator()(RandomIter first, RandomIter last, Compare& comp) const { mystl::__sort(first, last, comp); }
+    };
+
+    struct __stable_sort_fn {
+        template<class RandomIter, class Compare>
+        void operator()(RandomIter first, RandomIter last, Compare& comp) const {
+            mystl::__stable_sort(first, last, comp);
+        }
+    };
+
+    template<class T, class Compare>
+    inline void sort(__deque_iterator<T, T&, T*> first, __deque_iterator<T, T&, T*> last, Compare comp) {
+        mystl::__deque_segmented_sort(first, last, comp, __sort_fn());
+    }
+
+    template<class T>
+    inline void sort(__deque_iterator<T, T&, T*> first, __deque_iterator<T, T&, T*> last) {
+        mystl::sort(first, last, mystl::less<T>());
+    }
+
+    template<class T, class Compare>
+    inline void stable_sort(__deque_iterator<T, T&, T*> first, __deque_iterator<T, T&, T*> last, Compare comp) {
+        mystl::__deque_segmented_sort(first, last, comp, __stable_sort_fn());
+    }
+
+    template<class T>
+    inline void stable_sort(__deque_iterator<T, T&, T*> first, __deque_iterator<T, T&, T*> last) {
+        mystl::stable_sort(first, last, mystl::less<T>());
+    }
+}
+
+
+// radix_sort：LSD 基数排序，稳定
+// 键为整数或浮点数，由投影 proj(元素) 给出，可按结构体的某个字段或 pair 的 first 排序。
+// 键先映射为无符号整数，使其大小顺序与原值一致；每趟按一个字节分配到缓冲区，
+// 所有字节的计数在第一趟一次统计完成，所有元素在某字节上相同时跳过该趟。
+// 区间很短时用插入排序；缓冲区分配失败时退回按键比较的 stable_sort
+namespace mystl {
+    constexpr ptrdiff_t __radix_threshold = 64;
+
+    template<class Key, class = void>
+    struct __radix_key;
+
+    // 有符号整数翻转符号位
+    template<class Key>
+    struct __radix_key<Key, enable_if_t<is_integral<Key>::value>> {
+        using bits_type = typename std::make_unsigned<typename std::conditional<
+            is_same<Key, bool>::value, unsigned char, Key>::type>::type;
+
+        static bits_type to_bits(Key key) noexcept {
+            bits_type u = static_cast<bits_type>(key);
+            if (std::is_signed<Key>::value) u ^= bits_type(1) << (sizeof(bits_type) * 8 - 1);
+            return u;
+        }
+    };
+
+    // IEEE 754：正数翻转符号位，负数翻转全部位；-0.0 排在 +0.0 之前，NaN 按位模式排在两端
+    template<class Key>
+    struct __radix_key<Key, enable_if_t<is_same<Key, float>::value || is_same<Key, double>::value>> {
+        using bits_type = typename std::conditional<sizeof(Key) == 4, uint32_t, uint64_t>::type;
+
+        static bits_type to_bits(Key key) noexcept {
+            bits_type u;
+            std::memcpy(&u, &key, sizeof(u));
+            const bits_type sign = bits_type(1) << (sizeof(bits_type) * 8 - 1);
+            return (u & sign) ? ~u : (u ^ sign);
+        }
+    };
+
+    template<class RandomIter, class Projection>
+    using __radix_key_t = typename std::decay<decltype(std::declval<Projection&>()(*std::declval<RandomIter>()))>::type;
+
+    // 比较映射后的键，用于短区间与退化路径
+    template<class Projection, class Key>
+    struct __radix_compare {
+        Projection& proj;
+
+        template<class T>
+        bool operator()(const T& a, const T& b) const {
+            return __radix_key<Key>::to_bits(proj(a)) < __radix_key<Key>::to_bits(proj(b));
+        }
+    };
+
+    // 按第 pass 个字节把 [first, first + n) 分配到 result，offset 为各桶的起始位置
+    template<class Key, class InputIter, class OutputIter, class Projection>
+    void __radix_scatter(InputIter first, ptrdiff_t n, OutputIter result, size_t* offset, unsigned shift,
+                         Projection& proj) {
+        for (ptrdiff_t i = 0; i < n; ++i, ++first) {
+            const size_t digit = (__radix_key<Key>::to_bits(proj(*first)) >> shift) & 0xFF;
+            result[offset[digit]++] = mystl::move(*first);
+        }
+    }
+
+    // buffer 至少能容纳 n 个元素；非平凡类型的 buffer 元素须已构造
+    template<class Key, class RandomIter, class T, class Projection>
+    void __radix_sort_lsd(RandomIter first, ptrdiff_t n, T* buffer, Projection& proj) {
+        using bits_type = typename __radix_key<Key>::bits_type;
+        constexpr size_t passes = sizeof(bits_type);
+        size_t counts[passes][256] = {};
+        RandomIter it = first;
+        for (ptrdiff_t i = 0; i < n; ++i, ++it) {
+            bits_type bits = __radix_key<Key>::to_bits(proj(*it));
+            for (size_t p = 0; p < passes; ++p, bits >>= 8) ++counts[p][bits & 0xFF];
+        }
+
+        bool in_buffer = false;
+        for (size_t p = 0; p < passes; ++p) {
+            const unsigned shift = static_cast<unsigned>(p * 8);
+            const bits_type head = in_buffer ? __radix_key<Key>::to_bits(proj(*buffer))
+                                             : __radix_key<Key>::to_bits(proj(*first));
+            if (counts[p][(head >> shift) & 0xFF] == static_cast<size_t>(n)) continue;// 该字节全部相同
+            size_t offset[256];
+            size_t sum = 0;
+            for (size_t d = 0; d < 256; ++d) {
+                offset[d] = sum;
+                sum += counts[p][d];
+            }
+            if (in_buffer) mystl::__radix_scatter<Key>(buffer, n, first, offset, shift, proj);
+            else mystl::__radix_scatter<Key>(first, n, buffer, offset, shift, proj);
+            in_buffer = !in_buffer;
+        }
+        if (in_buffer) mystl::move(buffer, buffer + n, first);
+    }
+
+    template<class RandomIter, class Projection>
+    void radix_sort(RandomIter first, RandomIter last, Projection proj) {
+        using T = value_type_t<RandomIter>;
+        using Key = __radix_key_t<RandomIter, Projection>;
+        static_assert(is_integral<Key>::value || is_same<Key, float>::value || is_same<Key, double>::value,
+                      "radix_sort requires an integral or floating-point key");
+        __radix_compare<Projection, Key> comp{proj};
+        const ptrdiff_t n = last - first;
+        if (n <= __radix_threshold) {
+            mystl::__insertion_sort(first, last, comp);
+            return;
+        }
+        T* buffer = nullptr;
+        try {
+            buffer = simpleAlloc<T>::allocate(static_cast<size_t>(n));
+        } catch (const std::bad_alloc&) {
+            mystl::__stable_sort(first, last, comp);
+            return;
+        }
+        if (std::is_trivially_copyable<T>::value) {// 缓冲区可直接作为赋值目标
+            mystl::__radix_sort_lsd<Key>(first, n, buffer, proj);
+            simpleAlloc<T>::deallocate(buffer, static_cast<size_t>(n));
+            return;
+        }
+        ptrdiff_t built = 0;
+        try {
+            for (RandomIter it = first; built < n; ++it, ++built) mystl::construct(buffer + built, mystl::move(*it));
+            mystl::move(buffer, buffer + n, first);
+            mystl::__radix_sort_lsd<Key>(first, n, buffer, proj);
+        } catch (...) {
+            mystl::destroy(buffer, buffer + built);
+            simpleAlloc<T>::deallocate(buffer, static_cast<size_t>(n));
+            throw;
+        }
+        mystl::destroy(buffer, buffer + n);
+        simpleAlloc<T>::deallocate(buffer, static_cast<size_t>(n));
+    }
+
+    template<class RandomIter>
+    inline void radix_sort(RandomIter first, RandomIter last) {
+        mystl::radix_sort(first, last, mystl::identity<value_type_t<RandomIter>>());
+    }
+
+} // namespace mystl
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "alloc.h"
+#include "allocator.h"
+#include "vector.h"
+
+#include <cstddef>
+
+// 分配追踪：包装底层配置器，记录每次分配、释放的次数、字节数与调用点，供测试与性能测试统计容器操作的分配开销
+// 用法：容器的 Alloc 取 traced_alloc<T>（即 simpleAlloc<T, trace_alloc<>>），容器内部的节点、中控数组等也经
+// __rebind_alloc 走同一个底层配置器；调用点由 alloc_site 标注，alloc_budget 统计一段代码内的分配量。
+// 记录保存在进程级的单例中，与 _default_alloc 一样不是线程安全的
+namespace mystl {
+
+    struct alloc_event {
+        enum kind_type { allocate, deallocate, reallocate };
+
+        kind_type kind;
+        size_t bytes;       // 分配、释放的字节数，reallocate 时为新大小
+        size_t old_bytes;   // 仅 reallocate 有效
+        const void* ptr;
+        const char* site;   // 发生时所在的 alloc_site，没有时为 nullptr
+    };
+
+    class alloc_trace {
+    public:
+        static alloc_trace& instance() {
+            static alloc_trace trace;
+            return trace;
+        }
+
+    public: // 统计
+        size_t allocations() const noexcept { return allocations_; }
+        size_t deallocations() const noexcept { return deallocations_; }
+        size_t reallocations() const noexcept { return reallocations_; }
+        size_t bytes_allocated() const noexcept { return bytes_allocated_; }
+        size_t bytes_deallocated() const noexcept { return bytes_deallocated_; }
+        size_t live_bytes() const noexcept { return bytes_allocated_ - bytes_deallocated_; }
+        size_t peak_bytes() const noexcept { return peak_bytes_; }
+
+        // 逐次记录，record_events(false) 时只计数
+        const vector<alloc_event>& events() const noexcept { return events_; }
+        void record_events(bool on) noexcept { record_ = on; }
+
+        // 在 site 处发生的分配次数，site 按指针比较
+        size_t allocations_at(const char* site) const noexcept {
+            size_t n = 0;
+            for (const alloc_event* e = events_.begin(); e != events_.end(); ++e) {
+                if (e->site == site && e->kind != alloc_event::deallocate) ++n;
+            }
+            return n;
+        }
+
+        const char* site() const noexcept { return site_; }
+
+        void reset() {
+            allocations_ = deallocations_ = reallocations_ = 0;
+            bytes_allocated_ = bytes_deallocated_ = peak_bytes_ = 0;
+            events_.clear();
+        }
+
+    public: // 由 trace_alloc 调用
+        void on_allocate(const void* p, size_t n) {
+            ++allocations_;
+            bytes_allocated_ += n;
+            update_peak();
+            push(alloc_event::allocate, p, n, 0);
+        }
+
+        void on_deallocate(const void* p, size_t n) {
+            ++deallocations_;
+            bytes_deallocated_ += n;
+            push(alloc_event::deallocate, p, n, 0);
+        }
+
+        void on_reallocate(const void* p, size_t old_sz, size_t new_sz) {
+            ++reallocations_;
+            bytes_allocated_ += new_sz;
+            bytes_deallocated_ += old_sz;
+            update_peak();
+            push(alloc_event::reallocate, p, new_sz, old_sz);
+        }
+
+    private:
+        friend class alloc_site;
+
+        alloc_trace() = default;
+
+        void update_peak() noexcept {
+            if (live_bytes() > peak_bytes_) peak_bytes_ = live_bytes();
+        }
+
+        // events_ 自身用默认配置器扩容，不会回到这里
+        void push(alloc_event::kind_type kind, const void* p, size_t n, size_t old_n) {
+            if (record_) events_.push_back(alloc_event{kind, n, old_n, p, site_});
+        }
+
+        size_t allocations_ = 0;
+        size_t deallocations_ = 0;
+        size_t reallocations_ = 0;
+        size_t bytes_allocated_ = 0;
+        size_t bytes_deallocated_ = 0;
+        size_t peak_bytes_ = 0;
+        bool record_ = true;
+        const char* site_ = nullptr;
+        vector<alloc_event> events_;
+    };
+
+    // 底层配置器接口与 _default_alloc 相同，转发给 Raw 并记录
+    template<class Raw = _default_alloc>
+    struct trace_alloc {
+        static void* allocate(size_t n) {
+            void* p = Raw::allocate(n);
+            alloc_trace::instance().on_allocate(p, n);
+            return p;
+        }
+
+        static void deallocate(void* p, size_t n) {
+            alloc_trace::instance().on_deallocate(p, n);
+            Raw::deallocate(p, n);
+        }
+
+        static void* reallocate(void* p, size_t old_sz, size_t new_sz) {
+            void* result = Raw::reallocate(p, old_sz, new_sz);
+            alloc_trace::instance().on_reallocate(result, old_sz, new_sz);
+            return result;
+        }
+    };
+
+    template<class T>
+    using traced_alloc = simpleAlloc<T, trace_alloc<>>;
+
+    // 作用域内的分配都记在 name 名下，可以嵌套，离开时恢复外层的调用点
+    class alloc_site {
+    public:
+        explicit alloc_site(const char* name) noexcept : prev_(alloc_trace::instance().site_) {
+            alloc_trace::instance().site_ = name;
+        }
+        ~alloc_site() { alloc_trace::instance().site_ = prev_; }
+
+        alloc_site(const alloc_site&) = delete;
+        alloc_site& operator=(const alloc_site&) = delete;
+
+    private:
+        const char* prev_;
+    };
+
+    // 记下构造时的计数，之后查询这段时间内的分配量，用于在测试中断言分配预算，如
+    //     alloc_budget budget;
+    //     v.push_back(x);
+    //     ASSERT_TRUE(budget.allocations() <= 1);
+    class alloc_budget {
+    public:
+        alloc_budget() noexcept { restart(); }
+
+        void restart() noexcept {
+            const alloc_trace& t = alloc_trace::instance();
+            allocations_ = t.allocations() + t.reallocations();
+            deallocations_ = t.deallocations();
+            bytes_ = t.bytes_allocated();
+        }
+
+        // reallocate 计为一次分配
+        size_t allocations() const noexcept {
+            const alloc_trace& t = alloc_trace::instance();
+            return t.allocations() + t.reallocations() - allocations_;
+        }
+        size_t deallocations() const noexcept { return alloc_trace::instance().deallocations() - deallocations_; }
+        size_t bytes() const noexcept { return alloc_trace::instance().bytes_allocated() - bytes_; }
+
+    private:
+        size_t allocations_;
+        size_t deallocations_;
+        size_t bytes_;
+    };
+
+} // namespace mystl
@@ -69,4 +69,14 @@ namespace mystl {
 	void simpleAlloc<T, Alloc>::destroy(T* first, T* last) {
 		for (; first != last; ++first) first->~T();
 	}
+
+	//  simpleAlloc<T, Raw> ɷ U  simpleAlloc<U, Raw>ײ
+	// ڵʽݴģ Alloc ĵײڵ㡢пڲ
+	template<class Alloc, class U>
+	struct __rebind_alloc;
+
+	template<class T, class Raw, class U>
+	struct __rebind_alloc<simpleAlloc<T, Raw>, U> {
+		using type = simpleAlloc<U, Raw>;
+	};
 }// namespace mystl
\ No newline at end of file
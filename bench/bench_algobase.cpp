@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include "../algobase.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// algobase 中的基础算法：copy、copy_backward、fill、fill_n、equal，与 std 版本并排对比
+// 查找类（find、mismatch、lexicographical_compare）见 bench_search.cpp
+namespace {
+
+template<class T, bool Mine>
+void BM_copy(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> src(n, T(1)), dst(n);
+    for (auto _ : state) {
+        T* r = Mine ? mystl::copy(src.data(), src.data() + n, dst.data()) : std::copy(src.data(), src.data() + n, dst.data());
+        benchmark::DoNotOptimize(r);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+// 非平凡元素逐个赋值
+template<bool Mine>
+void BM_copy_string(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<std::string> src(n, std::string(16, 'x')), dst(n);
+    for (auto _ : state) {
+        auto r = Mine ? mystl::copy(src.data(), src.data() + n, dst.data()) : std::copy(src.data(), src.data() + n, dst.data());
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 区间重叠、向后平移一格，即 vector 中间插入时的搬运
+template<class T, bool Mine>
+void BM_copy_backward(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> v(n + 1, T(1));
+    for (auto _ : state) {
+        T* r = Mine ? mystl::copy_backward(v.data(), v.data() + n, v.data() + n + 1)
+                    : std::copy_backward(v.data(), v.data() + n, v.data() + n + 1);
+        benchmark::DoNotOptimize(r);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+template<class T, bool Mine>
+void BM_fill(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> v(n);
+    for (auto _ : state) {
+        if (Mine) mystl::fill(v.data(), v.data() + n, T(7));
+        else std::fill(v.data(), v.data() + n, T(7));
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+template<class T, bool Mine>
+void BM_fill_n(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> v(n);
+    for (auto _ : state) {
+        T* r = Mine ? mystl::fill_n(v.data(), n, T(7)) : std::fill_n(v.data(), n, T(7));
+        benchmark::DoNotOptimize(r);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+template<class T, bool Mine>
+void BM_equal(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> a(n, T(1)), b(n, T(1));
+    for (auto _ : state) {
+        bool r = Mine ? mystl::equal(a.data(), a.data() + n, b.data()) : std::equal(a.data(), a.data() + n, b.data());
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_copy, uint8_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_copy, uint8_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_copy, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_copy, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_copy_string, true)->Range(64, 1 << 16);
+BENCHMARK_TEMPLATE(BM_copy_string, false)->Range(64, 1 << 16);
+BENCHMARK_TEMPLATE(BM_copy_backward, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_copy_backward, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_fill, uint8_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_fill, uint8_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_fill, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_fill, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_fill_n, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_fill_n, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_equal, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_equal, uint32_t, false)->Range(64, 1 << 20);
@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+#include "../algorithm.h"
+#include "../deque.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<int> random_ints(size_t n) {
+    std::mt19937 gen(42);
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(gen());
+    return v;
+}
+
+struct my_sort { template<class It> void operator()(It f, It l) const { mystl::sort(f, l); } };
+struct std_sort { template<class It> void operator()(It f, It l) const { std::sort(f, l); } };
+struct my_stable { template<class It> void operator()(It f, It l) const { mystl::stable_sort(f, l); } };
+struct std_stable { template<class It> void operator()(It f, It l) const { std::stable_sort(f, l); } };
+
+// 连续内存上的排序
+template<class Sorter>
+void BM_sort_vector(benchmark::State& state) {
+    const auto src = random_ints(static_cast<size_t>(state.range(0)));
+    std::vector<int> v;
+    for (auto _ : state) {
+        v = src;
+        Sorter()(v.data(), v.data() + v.size());
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// deque 上的排序，mystl 走分段路径
+template<class Deque, class Sorter>
+void BM_sort_deque(benchmark::State& state) {
+    const auto src = random_ints(static_cast<size_t>(state.range(0)));
+    Deque d;
+    for (int x : src) d.push_back(x);
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < src.size(); ++i) d[i] = src[i];
+        state.ResumeTiming();
+        Sorter()(d.begin(), d.end());
+        benchmark::DoNotOptimize(d[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<bool Mine>
+void BM_nth_element(benchmark::State& state) {
+    const auto src = random_ints(static_cast<size_t>(state.range(0)));
+    std::vector<int> v;
+    for (auto _ : state) {
+        v = src;
+        int* mid = v.data() + v.size() / 2;
+        if (Mine) mystl::nth_element(v.data(), mid, v.data() + v.size());
+        else std::nth_element(v.data(), mid, v.data() + v.size());
+        benchmark::DoNotOptimize(*mid);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<bool Mine>
+void BM_partial_sort(benchmark::State& state) {
+    const auto src = random_ints(static_cast<size_t>(state.range(0)));
+    std::vector<int> v;
+    for (auto _ : state) {
+        v = src;
+        int* mid = v.data() + 100;
+        if (Mine) mystl::partial_sort(v.data(), mid, v.data() + v.size());
+        else std::partial_sort(v.data(), mid, v.data() + v.size());
+        benchmark::DoNotOptimize(v[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 基数排序与内省排序对比，Sorter 为 0 时 mystl::radix_sort，1 时 mystl::sort，2 时 std::sort
+template<class T>
+std::vector<T> random_keys(size_t n) {
+    std::mt19937_64 gen(7);
+    std::vector<T> v(n);
+    for (auto& x : v) {
+        if constexpr (std::is_floating_point<T>::value) x = static_cast<T>(static_cast<int64_t>(gen())) * T(1e-6);
+        else x = static_cast<T>(gen());
+    }
+    return v;
+}
+
+template<class T, int Sorter>
+void BM_radix_keys(benchmark::State& state) {
+    const auto src = random_keys<T>(static_cast<size_t>(state.range(0)));
+    std::vector<T> v;
+    for (auto _ : state) {
+        v = src;
+        T* first = v.data();
+        T* last = first + v.size();
+        if (Sorter == 0) mystl::radix_sort(first, last);
+        else if (Sorter == 1) mystl::sort(first, last);
+        else std::sort(first, last);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 键值对按键排序
+template<int Sorter>
+void BM_radix_pairs(benchmark::State& state) {
+    using P = std::pair<uint32_t, uint32_t>;
+    const auto keys = random_keys<uint32_t>(static_cast<size_t>(state.range(0)));
+    std::vector<P> src;
+    for (size_t i = 0; i < keys.size(); ++i) src.emplace_back(keys[i], static_cast<uint32_t>(i));
+    std::vector<P> v;
+    auto by_key = [](const P& a, const P& b) { return a.first < b.first; };
+    for (auto _ : state) {
+        v = src;
+        P* first = v.data();
+        P* last = first + v.size();
+        if (Sorter == 0) mystl::radix_sort(first, last, [](const P& p) { return p.first; });
+        else if (Sorter == 1) mystl::sort(first, last, by_key);
+        else std::sort(first, last, by_key);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_sort_vector, my_sort)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_sort_vector, std_sort)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_sort_vector, my_stable)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_sort_vector, std_stable)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_sort_deque, mystl::deque<int>, my_sort)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_sort_deque, std::deque<int>, std_sort)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_nth_element, true)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_nth_element, false)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_partial_sort, true)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_partial_sort, false)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_radix_keys, uint32_t, 0)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_keys, uint32_t, 1)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_keys, uint32_t, 2)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_keys, uint64_t, 0)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_keys, uint64_t, 1)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_keys, float, 0)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_keys, float, 1)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_pairs, 0)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_pairs, 1)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_radix_pairs, 2)->RangeMultiplier(10)->Range(1000, 10000000);
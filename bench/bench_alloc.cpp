@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include "../alloc.h"
+#include "../alloc_trace.h"
+#include "../deque.h"
+#include "../list.h"
+#include "../vector.h"
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+// 第二级配置器 _default_alloc 的小块分配，对照 std::allocator（即 operator new）
+namespace {
+
+struct pool_alloc {
+    static void* allocate(size_t n) { return mystl::_default_alloc::allocate(n); }
+    static void deallocate(void* p, size_t n) { mystl::_default_alloc::deallocate(p, n); }
+};
+
+struct std_alloc {
+    static void* allocate(size_t n) { return std::allocator<char>().allocate(n); }
+    static void deallocate(void* p, size_t n) { std::allocator<char>().deallocate(static_cast<char*>(p), n); }
+};
+
+// 同一大小的分配紧接着释放：free_list 头部的一进一出
+template<class Alloc>
+void BM_alloc_pair(benchmark::State& state) {
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        void* p = Alloc::allocate(bytes);
+        benchmark::DoNotOptimize(p);
+        Alloc::deallocate(p, bytes);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 先分配一批再全部释放，像节点容器的构造与析构
+template<class Alloc>
+void BM_alloc_batch(benchmark::State& state) {
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    std::vector<void*> ptrs(4096);
+    for (auto _ : state) {
+        for (auto& p : ptrs) p = Alloc::allocate(bytes);
+        benchmark::DoNotOptimize(ptrs.data());
+        for (auto p : ptrs) Alloc::deallocate(p, bytes);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ptrs.size()));
+}
+
+// 8 ~ 128 字节混合大小，随机替换已持有的块
+template<class Alloc>
+void BM_alloc_mixed(benchmark::State& state) {
+    std::mt19937 gen(42);
+    std::vector<std::pair<void*, size_t>> live(4096);
+    for (auto& b : live) {
+        b.second = 8 * (1 + gen() % 16);
+        b.first = Alloc::allocate(b.second);
+    }
+    for (auto _ : state) {
+        auto& b = live[gen() % live.size()];
+        Alloc::deallocate(b.first, b.second);
+        b.second = 8 * (1 + gen() % 16);
+        b.first = Alloc::allocate(b.second);
+        benchmark::DoNotOptimize(b.first);
+    }
+    for (auto& b : live) Alloc::deallocate(b.first, b.second);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 经 trace_alloc 统计容器逐个压入 n 个元素的分配次数与字节数，以每元素的计数输出，便于在 JSON 结果中跟踪
+template<class Container>
+void BM_alloc_count_push_back(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    mystl::alloc_trace& trace = mystl::alloc_trace::instance();
+    trace.record_events(false);
+    trace.reset();
+    for (auto _ : state) {
+        Container c;
+        for (size_t i = 0; i < n; ++i) c.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(c.back());
+    }
+    const double elements = static_cast<double>(state.iterations()) * static_cast<double>(n);
+    state.counters["allocs_per_elem"] = static_cast<double>(trace.allocations() + trace.reallocations()) / elements;
+    state.counters["bytes_per_elem"] = static_cast<double>(trace.bytes_allocated()) / elements;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_alloc_pair, pool_alloc)->Arg(8)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_TEMPLATE(BM_alloc_pair, std_alloc)->Arg(8)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_TEMPLATE(BM_alloc_batch, pool_alloc)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_TEMPLATE(BM_alloc_batch, std_alloc)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_TEMPLATE(BM_alloc_mixed, pool_alloc);
+BENCHMARK_TEMPLATE(BM_alloc_mixed, std_alloc);
+BENCHMARK_TEMPLATE(BM_alloc_count_push_back, mystl::vector<int, mystl::traced_alloc<int>>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_alloc_count_push_back, mystl::deque<int, mystl::traced_alloc<int>>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_alloc_count_push_back, mystl::list<int, mystl::traced_alloc<int>>)->Arg(1000)->Arg(100000);
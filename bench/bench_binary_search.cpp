@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include "../algorithm.h"
+#include "../sorted_index.h"
+#include "../vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// 有序数组上的随机查找：数组从放得进 L1 增大到远超末级缓存，
+// 对比 std::lower_bound、无分支的 mystl::lower_bound 与 Eytzinger 布局的 sorted_index
+namespace {
+
+constexpr size_t query_count = 1 << 16;
+
+struct search_data {
+    std::vector<int> sorted;
+    std::vector<int> queries;
+
+    explicit search_data(size_t n) : sorted(n), queries(query_count) {
+        for (size_t i = 0; i < n; ++i) sorted[i] = static_cast<int>(i * 2);
+        std::mt19937 gen(static_cast<unsigned>(n));
+        for (auto& q : queries) q = static_cast<int>(gen() % (n * 2));
+    }
+};
+
+void BM_lower_bound_std(benchmark::State& state) {
+    search_data d(static_cast<size_t>(state.range(0)));
+    const int* first = d.sorted.data();
+    const int* last = first + d.sorted.size();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::lower_bound(first, last, d.queries[i++ & (query_count - 1)]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_lower_bound_mystl(benchmark::State& state) {
+    search_data d(static_cast<size_t>(state.range(0)));
+    const int* first = d.sorted.data();
+    const int* last = first + d.sorted.size();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mystl::lower_bound(first, last, d.queries[i++ & (query_count - 1)]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_sorted_index(benchmark::State& state) {
+    search_data d(static_cast<size_t>(state.range(0)));
+    mystl::sorted_index<int> index(d.sorted.data(), d.sorted.data() + d.sorted.size());
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.lower_bound(d.queries[i++ & (query_count - 1)]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+// 4K 个 int 为 16KB（L1），最大 64MB（超出末级缓存）
+BENCHMARK(BM_lower_bound_std)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_lower_bound_mystl)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_sorted_index)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include "../algorithm.h"
+#include "../vector.h"
+
+#include <algorithm>
+#include <vector>
+
+// 位图的计数、查找与整体与运算：mystl::vector<bool> 逐字处理，std::vector<bool> 作对照
+namespace {
+
+template<class V>
+V make_bitmap(size_t n, size_t stride) {
+    V v(n, false);
+    for (size_t i = 0; i < n; i += stride) v[i] = true;
+    return v;
+}
+
+template<class V>
+void BM_bitmap_count(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    V v = make_bitmap<V>(n, 3);
+    for (auto _ : state) {
+        if constexpr (std::is_same<V, std::vector<bool>>::value)
+            benchmark::DoNotOptimize(std::count(v.begin(), v.end(), true));
+        else
+            benchmark::DoNotOptimize(mystl::count(v.begin(), v.end(), true));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 只有最后一位为 1，测扫描速度
+template<class V>
+void BM_bitmap_find(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    V v(n, false);
+    v[n - 1] = true;
+    for (auto _ : state) {
+        if constexpr (std::is_same<V, std::vector<bool>>::value)
+            benchmark::DoNotOptimize(std::find(v.begin(), v.end(), true));
+        else
+            benchmark::DoNotOptimize(mystl::find(v.begin(), v.end(), true));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class V>
+void BM_bitmap_and(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    V a = make_bitmap<V>(n, 2), b = make_bitmap<V>(n, 3);
+    for (auto _ : state) {
+        if constexpr (std::is_same<V, std::vector<bool>>::value) {
+            for (size_t i = 0; i < n; ++i) a[i] = a[i] && b[i];
+        } else {
+            a &= b;
+        }
+        benchmark::DoNotOptimize(a);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using my_bits = mystl::vector<bool>;
+using std_bits = std::vector<bool>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_bitmap_count, my_bits)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_bitmap_count, std_bits)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_bitmap_find, my_bits)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_bitmap_find, std_bits)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_bitmap_and, my_bits)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_bitmap_and, std_bits)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+#include "../btree_map.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<int> random_ints(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(gen());
+    return v;
+}
+
+// 随机插入
+template<class Map>
+void BM_ordered_insert(benchmark::State& state) {
+    const auto keys = random_ints(static_cast<size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        Map m;
+        for (int k : keys) m[k] = k;
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 随机查找（全部命中）
+template<class Map>
+void BM_ordered_find(benchmark::State& state) {
+    const auto keys = random_ints(static_cast<size_t>(state.range(0)), 1);
+    Map m;
+    for (int k : keys) m[k] = k;
+    for (auto _ : state) {
+        long sum = 0;
+        for (int k : keys) sum += m.find(k)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// lower_bound 查找（多数不命中）
+template<class Map>
+void BM_ordered_lower_bound(benchmark::State& state) {
+    const auto keys = random_ints(static_cast<size_t>(state.range(0)), 1);
+    const auto probes = random_ints(static_cast<size_t>(state.range(0)), 2);
+    Map m;
+    for (int k : keys) m[k] = k;
+    for (auto _ : state) {
+        size_t n = 0;
+        for (int k : probes) n += (m.lower_bound(k) != m.end());
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 顺序遍历
+template<class Map>
+void BM_ordered_scan(benchmark::State& state) {
+    const auto keys = random_ints(static_cast<size_t>(state.range(0)), 1);
+    Map m;
+    for (int k : keys) m[k] = k;
+    for (auto _ : state) {
+        long sum = 0;
+        for (auto& kv : m) sum += kv.second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(m.size()));
+}
+
+// 从有序序列构造
+template<class Map>
+void BM_ordered_bulk_load(benchmark::State& state) {
+    std::vector<std::pair<int, int>> std_v;
+    std::vector<mystl::pair<const int, int>> my_v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        std_v.emplace_back(static_cast<int>(i), 0);
+        my_v.emplace_back(static_cast<int>(i), 0);
+    }
+    for (auto _ : state) {
+        if constexpr (std::is_same<Map, std::map<int, int>>::value) {
+            Map m(std_v.begin(), std_v.end());
+            benchmark::DoNotOptimize(m.size());
+        } else {
+            Map m(my_v.data(), my_v.data() + my_v.size());
+            benchmark::DoNotOptimize(m.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using my_map = mystl::btree_map<int, int>;
+using std_map = std::map<int, int>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ordered_insert, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_insert, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_find, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_find, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_lower_bound, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_lower_bound, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_scan, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_scan, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_bulk_load, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_ordered_bulk_load, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include "../deque.h"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+// deque 的两端增删、随机访问与遍历，与 std::deque 并排对比
+namespace {
+
+template<class Deque>
+void BM_deque_push_back(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Deque d;
+        for (size_t i = 0; i < n; ++i) d.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(d.back());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Deque>
+void BM_deque_push_front(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Deque d;
+        for (size_t i = 0; i < n; ++i) d.push_front(static_cast<int>(i));
+        benchmark::DoNotOptimize(d.front());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 先进先出：尾部压入、头部弹出，规模不变
+template<class Deque>
+void BM_deque_fifo(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Deque d;
+    for (size_t i = 0; i < n; ++i) d.push_back(static_cast<int>(i));
+    int x = 0;
+    for (auto _ : state) {
+        d.push_back(++x);
+        d.pop_front();
+        benchmark::DoNotOptimize(d.front());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 头进尾出，规模不变：元素向中控数组头部滑动
+template<class Deque>
+void BM_deque_lifo_front(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Deque d;
+    for (size_t i = 0; i < n; ++i) d.push_front(static_cast<int>(i));
+    int x = 0;
+    for (auto _ : state) {
+        d.push_front(++x);
+        d.pop_back();
+        benchmark::DoNotOptimize(d.back());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class Deque>
+void BM_deque_random_access(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Deque d;
+    for (size_t i = 0; i < n; ++i) d.push_back(static_cast<int>(i));
+    std::mt19937 gen(42);
+    std::vector<size_t> idx(1024);
+    for (auto& i : idx) i = gen() % n;
+    for (auto _ : state) {
+        long long sum = 0;
+        for (size_t i : idx) sum += d[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(idx.size()));
+}
+
+template<class Deque>
+void BM_deque_iterate(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Deque d;
+    for (size_t i = 0; i < n; ++i) d.push_back(static_cast<int>(i));
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int x : d) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_deque_push_back, mystl::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_push_back, std::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_push_front, mystl::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_push_front, std::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_fifo, mystl::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_fifo, std::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_lifo_front, mystl::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_lifo_front, std::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_random_access, mystl::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_random_access, std::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_iterate, mystl::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_deque_iterate, std::deque<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
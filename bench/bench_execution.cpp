@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+#include "../execution.h"
+#include "../vector.h"
+#include "../deque.h"
+
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+// 并行算法的扩展性：参数为线程池的执行者数，从 1 到硬件并发数
+namespace {
+
+const size_t N = 1 << 24;
+
+mystl::thread_pool& pool_of(int64_t concurrency) {
+    static std::vector<std::unique_ptr<mystl::thread_pool>> pools(std::thread::hardware_concurrency() + 1);
+    auto& p = pools[static_cast<size_t>(concurrency)];
+    if (!p) p.reset(new mystl::thread_pool(static_cast<size_t>(concurrency)));
+    return *p;
+}
+
+std::vector<int> random_ints(size_t n) {
+    std::mt19937 gen(42);
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(gen());
+    return v;
+}
+
+void BM_par_sort_vector(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    const auto src = random_ints(N);
+    mystl::vector<int> v(N);
+    for (auto _ : state) {
+        state.PauseTiming();
+        mystl::copy(src.data(), src.data() + N, v.begin());
+        state.ResumeTiming();
+        mystl::sort(par, v.begin(), v.end());
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_par_sort_deque(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    const auto src = random_ints(N);
+    mystl::deque<int> d;
+    for (int x : src) d.push_back(x);
+    for (auto _ : state) {
+        state.PauseTiming();
+        mystl::copy(src.data(), src.data() + N, d.begin());
+        state.ResumeTiming();
+        mystl::sort(par, d.begin(), d.end());
+        benchmark::DoNotOptimize(d[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_par_fill(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    mystl::vector<int> v(N);
+    int value = 0;
+    for (auto _ : state) {
+        mystl::fill(par, v.begin(), v.end(), ++value);
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(N * sizeof(int)));
+}
+
+void BM_par_copy(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    mystl::vector<int> src(N, 1), dst(N);
+    for (auto _ : state) {
+        mystl::copy(par, src.begin(), src.end(), dst.begin());
+        benchmark::DoNotOptimize(dst.begin());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(N * sizeof(int)));
+}
+
+// 每个元素做一定量计算，接近计算密集的情形
+void BM_par_transform(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    mystl::vector<double> src(N, 1.5), dst(N);
+    for (auto _ : state) {
+        mystl::transform(par, src.begin(), src.end(), dst.begin(), [](double x) {
+            for (int i = 0; i < 8; ++i) x = x * 0.999 + 0.5 / x;
+            return x;
+        });
+        benchmark::DoNotOptimize(dst.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_par_for_each_deque(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    mystl::deque<int> d;
+    for (size_t i = 0; i < N; ++i) d.push_back(static_cast<int>(i));
+    for (auto _ : state) {
+        mystl::for_each(par, d.begin(), d.end(), [](int& x) { x = x * 3 + 1; });
+        benchmark::DoNotOptimize(d[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_par_reduce(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    const auto src = random_ints(N);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mystl::reduce(par, src.data(), src.data() + N, 0L));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_par_inclusive_scan(benchmark::State& state) {
+    auto par = mystl::execution::par.on(pool_of(state.range(0)));
+    const auto src = random_ints(N);
+    mystl::vector<int> dst(N);
+    for (auto _ : state) {
+        mystl::inclusive_scan(par, src.data(), src.data() + N, dst.begin());
+        benchmark::DoNotOptimize(dst.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void thread_counts(benchmark::internal::Benchmark* b) {
+    const int64_t max = std::max<int64_t>(1, std::thread::hardware_concurrency());
+    for (int64_t n = 1; n < max; n *= 2) b->Arg(n);
+    b->Arg(max);
+    b->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK(BM_par_sort_vector)->Apply(thread_counts);
+BENCHMARK(BM_par_sort_deque)->Apply(thread_counts);
+BENCHMARK(BM_par_fill)->Apply(thread_counts);
+BENCHMARK(BM_par_copy)->Apply(thread_counts);
+BENCHMARK(BM_par_transform)->Apply(thread_counts);
+BENCHMARK(BM_par_for_each_deque)->Apply(thread_counts);
+BENCHMARK(BM_par_reduce)->Apply(thread_counts);
+BENCHMARK(BM_par_inclusive_scan)->Apply(thread_counts);
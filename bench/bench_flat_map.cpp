@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include "../btree_map.h"
+#include "../flat_map.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+// 以查找为主的有序表：flat_map 与 btree_map、std::map 对比随机构建、查找与批量插入
+namespace {
+
+std::vector<int> random_ints(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(gen());
+    return v;
+}
+
+using my_flat = mystl::flat_map<int, int>;
+using my_btree = mystl::btree_map<int, int>;
+using std_map = std::map<int, int>;
+
+// 从无序输入构建
+template<class Map>
+void BM_lookup_build(benchmark::State& state) {
+    const auto keys = random_ints(static_cast<size_t>(state.range(0)), 1);
+    std::vector<mystl::pair<int, int>> input;
+    for (int k : keys) input.push_back(mystl::make_pair(k, k));
+    for (auto _ : state) {
+        if constexpr (std::is_same<Map, std_map>::value) {
+            Map m;
+            for (int k : keys) m.emplace(k, k);
+            benchmark::DoNotOptimize(m.size());
+        } else {
+            Map m(input.data(), input.data() + input.size());
+            benchmark::DoNotOptimize(m.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 随机查找（全部命中）
+template<class Map>
+void BM_lookup_find(benchmark::State& state) {
+    const auto keys = random_ints(static_cast<size_t>(state.range(0)), 1);
+    const auto probes = random_ints(static_cast<size_t>(state.range(0)), 1);
+    Map m;
+    for (int k : keys) m[k] = k;
+    for (auto _ : state) {
+        long sum = 0;
+        for (int k : probes) sum += m.find(k)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 向已有 n 个元素的表中批量插入 n / 10 个新键
+template<class Map>
+void BM_lookup_batch_insert(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    const auto keys = random_ints(n, 1);
+    const auto extra = random_ints(n / 10, 2);
+    std::vector<mystl::pair<int, int>> batch;
+    for (int k : extra) batch.push_back(mystl::make_pair(k, k));
+    Map base;
+    for (int k : keys) base[k] = k;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Map m(base);
+        state.ResumeTiming();
+        if constexpr (std::is_same<Map, std_map>::value) {
+            for (int k : extra) m.emplace(k, k);
+        } else {
+            m.insert(batch.data(), batch.data() + batch.size());
+        }
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(extra.size()));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_lookup_build, my_flat)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_build, my_btree)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_build, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_find, my_flat)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_find, my_btree)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_find, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_batch_insert, my_flat)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_batch_insert, my_btree)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_lookup_batch_insert, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include "../hash_map.h"
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+std::vector<unsigned long> random_keys(size_t n, unsigned seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<unsigned long> v(n);
+    for (auto& x : v) x = gen();
+    return v;
+}
+
+// 插入 n 个随机键
+template<class Map>
+void BM_hash_insert(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        Map m;
+        for (auto k : keys) m[k] = k;
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 命中查找
+template<class Map>
+void BM_hash_find_hit(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<size_t>(state.range(0)), 1);
+    Map m;
+    for (auto k : keys) m[k] = k;
+    for (auto _ : state) {
+        unsigned long sum = 0;
+        for (auto k : keys) sum += m.find(k)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 未命中查找
+template<class Map>
+void BM_hash_find_miss(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<size_t>(state.range(0)), 1);
+    const auto misses = random_keys(static_cast<size_t>(state.range(0)), 2);
+    Map m;
+    for (auto k : keys) m[k] = k;
+    for (auto _ : state) {
+        size_t n = 0;
+        for (auto k : misses) n += (m.find(k) != m.end());
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 交替插入删除，规模保持不变
+template<class Map>
+void BM_hash_churn(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    const auto keys = random_keys(n * 2, 3);
+    Map m;
+    for (size_t i = 0; i < n; ++i) m[keys[i]] = i;
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) {
+            m.erase(keys[i]);
+            m[keys[n + i]] = i;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            m.erase(keys[n + i]);
+            m[keys[i]] = i;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+
+// 字符串键
+template<class Map>
+void BM_hash_string_find(benchmark::State& state) {
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < state.range(0); ++i) keys.push_back("key_" + std::to_string(i * 7919));
+    Map m;
+    for (auto& k : keys) m[k] = 1;
+    for (auto _ : state) {
+        int sum = 0;
+        for (auto& k : keys) sum += m.find(k)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using my_map = mystl::hash_map<unsigned long, unsigned long>;
+using std_map = std::unordered_map<unsigned long, unsigned long>;
+using my_str_map = mystl::hash_map<std::string, int>;
+using std_str_map = std::unordered_map<std::string, int>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_hash_insert, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_hash_insert, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_hash_find_hit, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_hash_find_hit, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_hash_find_miss, my_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_hash_find_miss, std_map)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_hash_churn, my_map)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK_TEMPLATE(BM_hash_churn, std_map)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK_TEMPLATE(BM_hash_string_find, my_str_map)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK_TEMPLATE(BM_hash_string_find, std_str_map)->RangeMultiplier(10)->Range(1000, 100000);
@@ -0,0 +1,30 @@
+#include <benchmark/benchmark.h>
+#include "../queue.h"
+
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace {
+
+// 先 push n 个随机数，再全部 pop
+template<class PQ>
+void BM_push_pop(benchmark::State& state) {
+    std::mt19937 gen(42);
+    std::vector<int> data(static_cast<size_t>(state.range(0)));
+    for (auto& x : data) x = static_cast<int>(gen());
+    for (auto _ : state) {
+        PQ pq;
+        for (int x : data) pq.push(x);
+        while (!pq.empty()) pq.pop();
+        benchmark::DoNotOptimize(pq);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_push_pop, mystl::priority_queue<int>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_push_pop, mystl::dary_priority_queue<int, 4>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_push_pop, mystl::dary_priority_queue<int, 8>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_push_pop, std::priority_queue<int>)->RangeMultiplier(10)->Range(1000, 1000000);
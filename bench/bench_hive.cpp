@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include "../hive.h"
+#include "../vector.h"
+
+#include <list>
+#include <random>
+#include <vector>
+
+// 需要稳定地址、频繁增删的场景：hive 与 std::list 都保证地址不变，
+// hive 的元素按块连续存放，遍历接近 vector；vector 只作为稠密遍历的参照
+namespace {
+
+// 随机删除一半元素后的遍历
+template<class Container>
+void BM_iterate_half_erased(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::mt19937 gen(42);
+    Container c;
+    for (size_t i = 0; i < n; ++i) c.insert(c.end(), static_cast<int>(i));
+    for (auto it = c.begin(); it != c.end();) {
+        if (gen() & 1) it = c.erase(it);
+        else ++it;
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int x : c) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(c.size()));
+}
+
+void BM_iterate_vector(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0)) / 2;
+    mystl::vector<int> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int x : v) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+// 持有元素指针，随机删除再插入，规模不变
+template<class Container>
+void BM_churn(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::mt19937 gen(42);
+    Container c;
+    std::vector<typename Container::iterator> handles;
+    for (size_t i = 0; i < n; ++i) handles.push_back(c.insert(c.end(), static_cast<int>(i)));
+    for (auto _ : state) {
+        const size_t k = gen() % n;
+        c.erase(handles[k]);
+        handles[k] = c.insert(c.end(), static_cast<int>(k));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// hive 的 insert 不接受位置参数，适配成与 std::list 相同的调用形式
+struct hive_adaptor : mystl::hive<int> {
+    using mystl::hive<int>::insert;
+    iterator insert(iterator, int x) { return mystl::hive<int>::insert(x); }
+};
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_iterate_half_erased, hive_adaptor)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK_TEMPLATE(BM_iterate_half_erased, std::list<int>)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_iterate_vector)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK_TEMPLATE(BM_churn, hive_adaptor)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK_TEMPLATE(BM_churn, std::list<int>)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include "../list.h"
+#include "../intrusive_list.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+struct conn {
+    int fd;
+    mystl::list_hook hook;
+};
+
+// 随机挑选对象，从链表中摘下后重新挂到尾部（模拟定时器/LRU 刷新）
+void BM_intrusive_relink(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<conn> objs(n);
+    mystl::intrusive_list<conn, &conn::hook> l;
+    for (auto& c : objs) l.push_back(c);
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        conn& c = objs[gen() % n];
+        c.hook.unlink();
+        l.push_back(c);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 同样的操作用 list<conn*>：需要保存迭代器，每次 erase/push_back 都要释放/分配节点
+void BM_list_ptr_relink(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<conn> objs(n);
+    mystl::list<conn*> l;
+    std::vector<mystl::list<conn*>::iterator> pos(n);
+    for (size_t i = 0; i < n; ++i) {
+        l.push_back(&objs[i]);
+        pos[i] = --l.end();
+    }
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        size_t i = gen() % n;
+        l.erase(pos[i]);
+        l.push_back(&objs[i]);
+        pos[i] = --l.end();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 遍历
+void BM_intrusive_iterate(benchmark::State& state) {
+    std::vector<conn> objs(static_cast<size_t>(state.range(0)));
+    mystl::intrusive_list<conn, &conn::hook> l;
+    for (size_t i = 0; i < objs.size(); ++i) {
+        objs[i].fd = static_cast<int>(i);
+        l.push_back(objs[i]);
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto& c : l) sum += c.fd;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_list_ptr_iterate(benchmark::State& state) {
+    std::vector<conn> objs(static_cast<size_t>(state.range(0)));
+    mystl::list<conn*> l;
+    for (size_t i = 0; i < objs.size(); ++i) {
+        objs[i].fd = static_cast<int>(i);
+        l.push_back(&objs[i]);
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto p : l) sum += p->fd;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_intrusive_relink)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_list_ptr_relink)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_intrusive_iterate)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_list_ptr_iterate)->Range(1 << 10, 1 << 20);
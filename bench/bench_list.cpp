@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+#include "../list.h"
+
+#include <list>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<int> random_ints(size_t n) {
+    std::mt19937 gen(42);
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(gen());
+    return v;
+}
+
+// list::sort，规模 10^3 ~ 10^7
+template<class List>
+void BM_list_sort(benchmark::State& state) {
+    const auto data = random_ints(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        List l(data.begin(), data.end());
+        state.ResumeTiming();
+        l.sort();
+        benchmark::DoNotOptimize(l.front());
+        state.PauseTiming();
+        l.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 构造 n 个节点再析构，测节点分配
+template<class List>
+void BM_list_push_back(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        List l;
+        for (size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(l.back());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 稳定长度：头部弹出、尾部压入，节点不断复用
+template<class List>
+void BM_list_fifo(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    List l;
+    for (size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+    int x = 0;
+    for (auto _ : state) {
+        l.push_back(++x);
+        l.pop_front();
+        benchmark::DoNotOptimize(l.front());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 与 BM_list_fifo 相同，但 mystl::list 开启空闲节点缓存，弹出的节点留给下一次压入
+void reserve_nodes(mystl::list<int>& l, size_t n) { l.reserve_nodes(n); }
+void reserve_nodes(std::list<int>&, size_t) {}
+
+template<class List>
+void BM_list_fifo_cached(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    List l;
+    reserve_nodes(l, 1);
+    for (size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+    int x = 0;
+    for (auto _ : state) {
+        l.pop_front();
+        l.push_back(++x);
+        benchmark::DoNotOptimize(l.front());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 把 a 的头节点改写后交给 b，再原样交回：mystl 走节点句柄，std 走 splice
+void hand_off(mystl::list<int>& from, mystl::list<int>& to, int x) {
+    auto nh = from.extract(from.begin());
+    nh.value() = x;
+    to.insert(to.end(), mystl::move(nh));
+}
+void hand_off(std::list<int>& from, std::list<int>& to, int x) {
+    to.splice(to.end(), from, from.begin());
+    to.back() = x;
+}
+
+template<class List>
+void BM_list_hand_off(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    List a, b;
+    for (size_t i = 0; i < n; ++i) a.push_back(static_cast<int>(i));
+    int x = 0;
+    for (auto _ : state) {
+        hand_off(a, b, ++x);
+        hand_off(b, a, ++x);
+        benchmark::DoNotOptimize(a.back());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+template<class List>
+void BM_list_iterate(benchmark::State& state) {
+    const auto data = random_ints(static_cast<size_t>(state.range(0)));
+    const List l(data.begin(), data.end());
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int x : l) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class List>
+void BM_list_reverse(benchmark::State& state) {
+    const auto data = random_ints(static_cast<size_t>(state.range(0)));
+    List l(data.begin(), data.end());
+    for (auto _ : state) {
+        l.reverse();
+        benchmark::DoNotOptimize(l.front());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_list_sort, mystl::list<int>)
+    ->RangeMultiplier(10)->Range(1000, 10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_list_sort, std::list<int>)
+    ->RangeMultiplier(10)->Range(1000, 10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_list_push_back, mystl::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_push_back, std::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_fifo, mystl::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_fifo, std::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_fifo_cached, mystl::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_fifo_cached, std::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_hand_off, mystl::list<int>)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_list_hand_off, std::list<int>)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_list_iterate, mystl::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_iterate, std::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_reverse, mystl::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_list_reverse, std::list<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include "../lru_cache.h"
+
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// lru_cache 与服务中常见的手写 LRU（std::list + std::unordered_map）对比
+namespace {
+
+// 对照组：命中时 splice 到表头，满时删除表尾再插入
+class std_lru {
+public:
+    explicit std_lru(size_t capacity) : capacity_(capacity) { index_.reserve(capacity); }
+
+    int* get(int key) {
+        auto pos = index_.find(key);
+        if (pos == index_.end()) return nullptr;
+        items_.splice(items_.begin(), items_, pos->second);
+        return &pos->second->second;
+    }
+
+    void put(int key, int value) {
+        auto pos = index_.find(key);
+        if (pos != index_.end()) {
+            pos->second->second = value;
+            items_.splice(items_.begin(), items_, pos->second);
+            return;
+        }
+        if (index_.size() == capacity_) {
+            index_.erase(items_.back().first);
+            items_.pop_back();
+        }
+        items_.emplace_front(key, value);
+        index_.emplace(key, items_.begin());
+    }
+
+private:
+    size_t capacity_;
+    std::list<std::pair<int, int>> items_;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index_;
+};
+
+class mystl_lru {
+public:
+    explicit mystl_lru(size_t capacity) : cache_(capacity) { cache_.reserve(capacity); }
+    int* get(int key) { return cache_.get(key); }
+    void put(int key, int value) { cache_.put(key, value); }
+
+private:
+    mystl::lru_cache<int, int> cache_;
+};
+
+// 键取自 [0, 2 * capacity) 上的偏斜分布，未命中时回填，命中率约六成
+std::vector<int> skewed_keys(size_t capacity, size_t n) {
+    std::mt19937 gen(42);
+    std::geometric_distribution<int> dist(1.0 / static_cast<double>(capacity));
+    std::vector<int> keys(n);
+    for (auto& k : keys) k = dist(gen) % static_cast<int>(2 * capacity);
+    return keys;
+}
+
+template<class Cache>
+void BM_lru_get_or_fill(benchmark::State& state) {
+    const size_t capacity = static_cast<size_t>(state.range(0));
+    const auto keys = skewed_keys(capacity, 1 << 20);
+    Cache cache(capacity);
+    size_t i = 0, hits = 0;
+    for (auto _ : state) {
+        const int key = keys[i++ & (keys.size() - 1)];
+        if (int* v = cache.get(key)) {
+            benchmark::DoNotOptimize(*v);
+            ++hits;
+        } else
+            cache.put(key, key);
+    }
+    state.counters["hit_rate"] = static_cast<double>(hits) / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 多线程共享一个缓存：分片各自加锁
+void BM_lru_sharded(benchmark::State& state) {
+    static mystl::sharded_lru_cache<int, int>* cache = nullptr;
+    const size_t capacity = 1 << 16;
+    if (state.thread_index() == 0) {
+        cache = new mystl::sharded_lru_cache<int, int>(capacity, 64);
+        cache->reserve(capacity);
+    }
+    const auto keys = skewed_keys(capacity, 1 << 20);
+    size_t i = static_cast<size_t>(state.thread_index()) * 997;
+    for (auto _ : state) {
+        const int key = keys[i++ & (keys.size() - 1)];
+        int v;
+        if (cache->get(key, v))
+            benchmark::DoNotOptimize(v);
+        else
+            cache->put(key, key);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        delete cache;
+        cache = nullptr;
+    }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_lru_get_or_fill, mystl_lru)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_lru_get_or_fill, std_lru)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_lru_sharded)->Threads(1)->Threads(4);
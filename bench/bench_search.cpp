@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include "../algorithm.h"
+#include "../vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// 连续内存上的查找与比较，目标位于末尾，测的是扫描吞吐
+namespace {
+
+template<class T, bool Mine>
+void BM_find(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> v(n, T(1));
+    v.back() = T(2);
+    for (auto _ : state) {
+        const T* hit = Mine ? mystl::find(v.data(), v.data() + n, T(2)) : std::find(v.data(), v.data() + n, T(2));
+        benchmark::DoNotOptimize(hit);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+template<class T, bool Mine>
+void BM_count(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> v(n);
+    for (size_t i = 0; i < n; ++i) v[i] = T(i % 7);
+    for (auto _ : state) {
+        auto c = Mine ? mystl::count(v.data(), v.data() + n, T(3)) : std::count(v.data(), v.data() + n, T(3));
+        benchmark::DoNotOptimize(c);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+template<class T, bool Mine>
+void BM_mismatch(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> a(n, T(1)), b(n, T(1));
+    b.back() = T(2);
+    for (auto _ : state) {
+        auto r = Mine ? mystl::mismatch(a.data(), a.data() + n, b.data()).first
+                      : std::mismatch(a.data(), a.data() + n, b.data()).first;
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+template<class T, bool Mine>
+void BM_lexicographical_compare(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<T> a(n, T(1)), b(n, T(1));
+    b.back() = T(2);
+    for (auto _ : state) {
+        bool r = Mine ? mystl::lexicographical_compare(a.data(), a.data() + n, b.data(), b.data() + n)
+                      : std::lexicographical_compare(a.data(), a.data() + n, b.data(), b.data() + n);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(T)));
+}
+
+// vector::operator== 现在走 equal 的 memcmp 路径
+void BM_vector_equal(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    mystl::vector<int> a(n, 1), b(n, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(a == b);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(int)));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_find, uint8_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_find, uint8_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_find, uint16_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_find, uint16_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_find, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_find, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_find, uint64_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_find, uint64_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_count, uint8_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_count, uint8_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_count, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_count, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_mismatch, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_mismatch, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_lexicographical_compare, uint32_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_lexicographical_compare, uint32_t, false)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_lexicographical_compare, int8_t, true)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(BM_lexicographical_compare, int8_t, false)->Range(64, 1 << 20);
+BENCHMARK(BM_vector_equal)->Range(64, 1 << 20);
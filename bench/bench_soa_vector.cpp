@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include "../soa_vector.h"
+#include "../vector.h"
+
+#include <cstdint>
+
+// 记录数组只扫描一个字段：vector<Record> 每取一个 float 要带进整条记录，
+// soa_vector 的一列是连续的 float，缓存与带宽只花在用到的字段上
+namespace {
+
+struct Record {
+    uint32_t id;
+    float price;
+    uint64_t timestamp;
+    double weight;
+    char tag[8];
+};
+
+void BM_scan_aos(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    mystl::vector<Record> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(Record{static_cast<uint32_t>(i), static_cast<float>(i % 100), i, 1.0, {}});
+    for (auto _ : state) {
+        float sum = 0;
+        for (const Record& r : v) sum += r.price;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_scan_soa(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    mystl::soa_vector<uint32_t, float, uint64_t, double, uint64_t> v;
+    for (size_t i = 0; i < n; ++i) v.emplace_back(static_cast<uint32_t>(i), static_cast<float>(i % 100), i, 1.0, 0);
+    for (auto _ : state) {
+        float sum = 0;
+        for (float p : v.column<1>()) sum += p;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_push_back_aos(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        mystl::vector<Record> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(Record{static_cast<uint32_t>(i), 1.0f, i, 1.0, {}});
+        benchmark::DoNotOptimize(v.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_push_back_soa(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        mystl::soa_vector<uint32_t, float, uint64_t, double, uint64_t> v;
+        for (size_t i = 0; i < n; ++i) v.emplace_back(static_cast<uint32_t>(i), 1.0f, i, 1.0, 0);
+        benchmark::DoNotOptimize(v.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_scan_aos)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_scan_soa)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_push_back_aos)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_push_back_soa)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+#include "../stack.h"
+#include "../queue.h"
+
+#include <queue>
+#include <stack>
+#include <vector>
+
+// 容器适配器：默认底层都是 deque，与 std::stack、std::queue 并排对比
+namespace {
+
+// 压入 n 个再全部弹出
+template<class Stack>
+void BM_stack_push_pop(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Stack s;
+        for (size_t i = 0; i < n; ++i) s.push(static_cast<int>(i));
+        long long sum = 0;
+        while (s.size() != 0) {
+            sum += s.top();
+            s.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Queue>
+void BM_queue_push_pop(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Queue q;
+        for (size_t i = 0; i < n; ++i) q.push(static_cast<int>(i));
+        long long sum = 0;
+        while (!q.empty()) {
+            sum += q.front();
+            q.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 稳定长度的队列：每次压入一个、弹出一个
+template<class Queue>
+void BM_queue_steady(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Queue q;
+    for (size_t i = 0; i < n; ++i) q.push(static_cast<int>(i));
+    int x = 0;
+    for (auto _ : state) {
+        q.push(++x);
+        q.pop();
+        benchmark::DoNotOptimize(q.front());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 批量入队 n 个再清空：逐个 push 与 push_range（std::queue 在 C++17 下没有 push_range，只比较逐个 push）
+template<class Queue>
+void BM_queue_ingest_loop(benchmark::State& state) {
+    const std::vector<int> batch(static_cast<size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        Queue q;
+        for (int x : batch) q.push(x);
+        benchmark::DoNotOptimize(q.back());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Queue>
+void BM_queue_ingest_range(benchmark::State& state) {
+    const std::vector<int> batch(static_cast<size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        Queue q;
+        q.push_range(batch.data(), batch.data() + batch.size());
+        benchmark::DoNotOptimize(q.back());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 填满 n 个后全部取出到 std::vector：逐个 front + pop 与 pop_n
+template<class Queue>
+void BM_queue_drain_loop(benchmark::State& state) {
+    const std::vector<int> batch(static_cast<size_t>(state.range(0)), 1);
+    std::vector<int> out(batch.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        Queue q;
+        for (int x : batch) q.push(x);
+        state.ResumeTiming();
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = q.front();
+            q.pop();
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Queue>
+void BM_queue_drain_pop_n(benchmark::State& state) {
+    const std::vector<int> batch(static_cast<size_t>(state.range(0)), 1);
+    std::vector<int> out(batch.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        Queue q;
+        for (int x : batch) q.push(x);
+        state.ResumeTiming();
+        q.pop_n(out.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_stack_push_pop, mystl::stack<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_stack_push_pop, std::stack<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_push_pop, mystl::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_push_pop, std::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_steady, mystl::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_steady, std::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_ingest_loop, mystl::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_ingest_loop, std::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_ingest_range, mystl::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_drain_loop, mystl::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_drain_loop, std::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_queue_drain_pop_n, mystl::queue<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+#include "../list.h"
+#include "../unrolled_list.h"
+
+#include <random>
+
+namespace {
+
+// 顺序遍历求和
+template<class List>
+void BM_iterate(benchmark::State& state) {
+    List l;
+    for (int i = 0; i < state.range(0); ++i) l.push_back(i);
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = l.begin(); it != l.end(); ++it) sum += *it;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 尾部插入
+template<class List>
+void BM_push_back(benchmark::State& state) {
+    for (auto _ : state) {
+        List l;
+        for (int i = 0; i < state.range(0); ++i) l.push_back(i);
+        benchmark::DoNotOptimize(l.back());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 在一个移动的游标处插入（模拟按位置批量插入）
+template<class List>
+void BM_insert_cursor(benchmark::State& state) {
+    std::mt19937 gen(42);
+    for (auto _ : state) {
+        List l;
+        l.push_back(0);
+        auto it = l.begin();
+        for (int i = 0; i < state.range(0); ++i) {
+            it = l.insert(it, i);
+            if (gen() & 1) {
+                ++it;
+                if (it == l.end()) it = l.begin();
+            }
+        }
+        benchmark::DoNotOptimize(l.front());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_iterate, mystl::list<int>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_iterate, mystl::unrolled_list<int>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_push_back, mystl::list<int>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_push_back, mystl::unrolled_list<int>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_insert_cursor, mystl::list<int>)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK_TEMPLATE(BM_insert_cursor, mystl::unrolled_list<int>)->RangeMultiplier(10)->Range(1000, 100000);
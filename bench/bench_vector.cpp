@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+#include "../vector.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+// vector 的常用操作，每项都与 std::vector 并排对比
+namespace {
+
+std::vector<int> random_ints(size_t n) {
+    std::mt19937 gen(42);
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(gen());
+    return v;
+}
+
+template<class Vector>
+void BM_vector_push_back(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Vector v;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vector>
+void BM_vector_push_back_reserved(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Vector v;
+        v.reserve(n);
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 非平凡元素：扩容时的搬运代价
+template<class Vector>
+void BM_vector_push_back_string(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    const std::string s(32, 'x');
+    for (auto _ : state) {
+        Vector v;
+        for (size_t i = 0; i < n; ++i) v.push_back(s);
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vector>
+void BM_vector_copy(benchmark::State& state) {
+    const auto data = random_ints(static_cast<size_t>(state.range(0)));
+    const Vector src(data.data(), data.data() + data.size());
+    for (auto _ : state) {
+        Vector v(src);
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(int)));
+}
+
+template<class Vector>
+void BM_vector_iterate(benchmark::State& state) {
+    const auto data = random_ints(static_cast<size_t>(state.range(0)));
+    const Vector v(data.data(), data.data() + data.size());
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int x : v) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 在中间插入再删除，规模不变，测元素平移
+template<class Vector>
+void BM_vector_insert_erase_middle(benchmark::State& state) {
+    const auto data = random_ints(static_cast<size_t>(state.range(0)));
+    Vector v(data.data(), data.data() + data.size());
+    for (auto _ : state) {
+        v.insert(v.begin() + v.size() / 2, 1);
+        v.erase(v.begin() + v.size() / 2);
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 单遍输入迭代器，Tag 取各自库的 input_iterator_tag
+template<class Tag>
+struct counting_input {
+    using iterator_category = Tag;
+    using value_type = int;
+    using difference_type = ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+
+    int i;
+    const int& operator*() const { return i; }
+    counting_input& operator++() { ++i; return *this; }
+    counting_input operator++(int) { counting_input t = *this; ++i; return t; }
+    bool operator==(const counting_input& rhs) const { return i == rhs.i; }
+    bool operator!=(const counting_input& rhs) const { return i != rhs.i; }
+};
+
+// 从输入迭代器向中间插入 n 个元素，原有 n 个元素
+template<class Vector, class Tag>
+void BM_vector_insert_input_middle(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        Vector v;
+        for (int i = 0; i < n; ++i) v.push_back(i);
+        state.ResumeTiming();
+        v.insert(v.begin() + n / 2, counting_input<Tag>{0}, counting_input<Tag>{n});
+        benchmark::DoNotOptimize(v.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_vector_push_back, mystl::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_push_back, std::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_push_back_reserved, mystl::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_push_back_reserved, std::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_push_back_string, mystl::vector<std::string>)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_vector_push_back_string, std::vector<std::string>)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_vector_copy, mystl::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_copy, std::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_iterate, mystl::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_iterate, std::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_vector_insert_erase_middle, mystl::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_vector_insert_erase_middle, std::vector<int>)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_vector_insert_input_middle, mystl::vector<int>, mystl::input_iterator_tag)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_vector_insert_input_middle, std::vector<int>, std::input_iterator_tag)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
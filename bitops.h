@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 位容器（vector<bool>、bitset）共用的字操作与位引用
+// 位按字（64 位）存放，第 i 位位于第 i / 64 个字的第 i % 64 位
+namespace mystl {
+
+    using __bit_word = uint64_t;
+    constexpr size_t __word_bits = 64;
+
+    // 低 n 位为 1 的掩码，n 取 [0, 64]
+    inline __bit_word __low_mask(size_t n) noexcept {
+        return n < __word_bits ? (__bit_word(1) << n) - 1 : ~__bit_word(0);
+    }
+
+    inline size_t __words_for(size_t nbits) noexcept { return (nbits + __word_bits - 1) / __word_bits; }
+
+    inline size_t __popcount(__bit_word w) noexcept { return static_cast<size_t>(__builtin_popcountll(w)); }
+
+    // w 不能为 0
+    inline size_t __ctz(__bit_word w) noexcept { return static_cast<size_t>(__builtin_ctzll(w)); }
+
+    // 整段字的置位个数。默认的 x86-64 目标没有 POPCNT 指令，__builtin_popcountll 会退化为软件实现，
+    // 此时生成带 POPCNT 与不带的两个版本，由加载器按 CPU 选择
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__POPCNT__)
+    __attribute__((target_clones("popcnt", "default")))
+#endif
+    inline size_t __popcount_words(const __bit_word* p, size_t n) noexcept {
+        size_t result = 0;
+        for (size_t i = 0; i < n; ++i) result += static_cast<size_t>(__builtin_popcountll(p[i]));
+        return result;
+    }
+
+    // 单个位的代理引用
+    struct __bit_reference {
+        __bit_word* p;
+        __bit_word mask;
+
+        __bit_reference(__bit_word* word, __bit_word m) noexcept : p(word), mask(m) {}
+
+        operator bool() const noexcept { return (*p & mask) != 0; }
+
+        __bit_reference& operator=(bool x) noexcept {
+            if (x) *p |= mask;
+            else *p &= ~mask;
+            return *this;
+        }
+        __bit_reference& operator=(const __bit_reference& x) noexcept { return *this = bool(x); }
+
+        bool operator==(const __bit_reference& x) const noexcept { return bool(*this) == bool(x); }
+        bool operator<(const __bit_reference& x) const noexcept { return !bool(*this) && bool(x); }
+
+        void flip() noexcept { *p ^= mask; }
+    };
+
+    inline void swap(__bit_reference x, __bit_reference y) noexcept {
+        const bool temp = x;
+        x = y;
+        y = temp;
+    }
+
+} // namespace mystl
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "bitops.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+// bitset：N 位的定长位集，按 64 位的字存放在对象内部，不做动态分配
+// 计数、查找、移位与逻辑运算都逐字进行。最后一个字中超出 N 的位始终为 0
+namespace mystl {
+
+    template<size_t N>
+    class bitset {
+    public:
+        using reference = __bit_reference;
+
+    private:
+        static constexpr size_t word_count = N == 0 ? 1 : (N + __word_bits - 1) / __word_bits;
+
+        __bit_word words_[word_count];
+
+        void clear_tail() noexcept {
+            if (N % __word_bits || N == 0) words_[word_count - 1] &= __low_mask(N % __word_bits);
+        }
+
+        static void check(size_t pos, const char* what) {
+            if (pos >= N) throw std::out_of_range(what);
+        }
+
+    public: // 构造
+        constexpr bitset() noexcept : words_() {}
+
+        // 低位对应 val 的低位
+        bitset(unsigned long long val) noexcept : words_() {
+            words_[0] = val;
+            clear_tail();
+        }
+
+    public: // 访问
+        constexpr size_t size() const noexcept { return N; }
+
+        bool operator[](size_t pos) const noexcept { return (words_[pos / __word_bits] >> (pos % __word_bits)) & 1; }
+        reference operator[](size_t pos) noexcept {
+            return reference(words_ + pos / __word_bits, __bit_word(1) << (pos % __word_bits));
+        }
+
+        bool test(size_t pos) const {
+            check(pos, "bitset::test");
+            return (*this)[pos];
+        }
+
+        size_t count() const noexcept { return __popcount_words(words_, word_count); }
+
+        bool all() const noexcept {
+            for (size_t i = 0; i + 1 < word_count; ++i) {
+                if (~words_[i]) return false;
+            }
+            return words_[word_count - 1] == (N % __word_bits ? __low_mask(N % __word_bits) : (N ? ~__bit_word(0) : 0));
+        }
+        bool any() const noexcept {
+            for (size_t i = 0; i < word_count; ++i) {
+                if (words_[i]) return true;
+            }
+            return false;
+        }
+        bool none() const noexcept { return !any(); }
+
+        // 第一个置位的下标，没有时返回 N
+        size_t find_first() const noexcept { return find_from(0); }
+
+        // pos 之后第一个置位的下标，没有时返回 N
+        size_t find_next(size_t pos) const noexcept { return pos + 1 >= N ? N : find_from(pos + 1); }
+
+        unsigned long long to_ullong() const {
+            for (size_t i = 1; i < word_count; ++i) {
+                if (words_[i]) throw std::overflow_error("bitset::to_ullong");
+            }
+            return words_[0];
+        }
+
+    public: // 修改
+        bitset& set() noexcept {
+            for (size_t i = 0; i < word_count; ++i) words_[i] = ~__bit_word(0);
+            clear_tail();
+            return *this;
+        }
+        bitset& set(size_t pos, bool value = true) {
+            check(pos, "bitset::set");
+            (*this)[pos] = value;
+            return *this;
+        }
+        bitset& reset() noexcept {
+            for (size_t i = 0; i < word_count; ++i) words_[i] = 0;
+            return *this;
+        }
+        bitset& reset(size_t pos) {
+            check(pos, "bitset::reset");
+            (*this)[pos] = false;
+            return *this;
+        }
+        bitset& flip() noexcept {
+            for (size_t i = 0; i < word_count; ++i) words_[i] = ~words_[i];
+            clear_tail();
+            return *this;
+        }
+        bitset& flip(size_t pos) {
+            check(pos, "bitset::flip");
+            words_[pos / __word_bits] ^= __bit_word(1) << (pos % __word_bits);
+            return *this;
+        }
+
+    public: // 位运算
+        bitset& operator&=(const bitset& rhs) noexcept {
+            for (size_t i = 0; i < word_count; ++i) words_[i] &= rhs.words_[i];
+            return *this;
+        }
+        bitset& operator|=(const bitset& rhs) noexcept {
+            for (size_t i = 0; i < word_count; ++i) words_[i] |= rhs.words_[i];
+            return *this;
+        }
+        bitset& operator^=(const bitset& rhs) noexcept {
+            for (size_t i = 0; i < word_count; ++i) words_[i] ^= rhs.words_[i];
+            return *this;
+        }
+
+        // 整字移动 shift / 64 个字，再在相邻字之间移动余下的位
+        bitset& operator<<=(size_t shift) noexcept {
+            if (shift >= N) return reset();
+            const size_t wshift = shift / __word_bits, offset = shift % __word_bits;
+            if (offset == 0) {
+                for (size_t i = word_count; i-- > wshift;) words_[i] = words_[i - wshift];
+            } else {
+                for (size_t i = word_count - 1; i > wshift; --i)
+                    words_[i] = (words_[i - wshift] << offset) | (words_[i - wshift - 1] >> (__word_bits - offset));
+                words_[wshift] = words_[0] << offset;
+            }
+            for (size_t i = 0; i < wshift; ++i) words_[i] = 0;
+            clear_tail();
+            return *this;
+        }
+        bitset& operator>>=(size_t shift) noexcept {
+            if (shift >= N) return reset();
+            const size_t wshift = shift / __word_bits, offset = shift % __word_bits;
+            const size_t limit = word_count - wshift - 1;
+            if (offset == 0) {
+                for (size_t i = 0; i <= limit; ++i) words_[i] = words_[i + wshift];
+            } else {
+                for (size_t i = 0; i < limit; ++i)
+                    words_[i] = (words_[i + wshift] >> offset) | (words_[i + wshift + 1] << (__word_bits - offset));
+                words_[limit] = words_[word_count - 1] >> offset;
+            }
+            for (size_t i = limit + 1; i < word_count; ++i) words_[i] = 0;
+            return *this;
+        }
+
+        bitset operator~() const noexcept { return bitset(*this).flip(); }
+        bitset operator<<(size_t shift) const noexcept { return bitset(*this) <<= shift; }
+        bitset operator>>(size_t shift) const noexcept { return bitset(*this) >>= shift; }
+
+        friend bitset operator&(const bitset& x, const bitset& y) noexcept { return bitset(x) &= y; }
+        friend bitset operator|(const bitset& x, const bitset& y) noexcept { return bitset(x) |= y; }
+        friend bitset operator^(const bitset& x, const bitset& y) noexcept { return bitset(x) ^= y; }
+
+        bool operator==(const bitset& rhs) const noexcept {
+            for (size_t i = 0; i < word_count; ++i) {
+                if (words_[i] != rhs.words_[i]) return false;
+            }
+            return true;
+        }
+        bool operator!=(const bitset& rhs) const noexcept { return !(*this == rhs); }
+
+    private:
+        size_t find_from(size_t pos) const noexcept {
+            size_t i = pos / __word_bits;
+            if (i >= word_count) return N;
+            __bit_word w = words_[i] & ~__low_mask(pos % __word_bits);
+            while (true) {
+                if (w) return i * __word_bits + __ctz(w);
+                if (++i == word_count) return N;
+                w = words_[i];
+            }
+        }
+    };
+
+} // namespace mystl
@@ -0,0 +1,737 @@
+#pragma once
+
+#include "iterator.h"
+#include "allocator.h"
+#include "algobase.h"
+#include "construct.h"
+#include "functional.h"
+#include "pair.h"
+
+#include <cstddef>
+#include <type_traits>  // aligned_storage
+
+// 每个节点中元素区的目标字节数
+#ifndef BTREE_NODE_BYTES
+#define BTREE_NODE_BYTES 256
+#endif
+
+// B 树节点定义
+// 一个节点连续存放多个元素，树高约为 log_{N}(n)，查找时访问的 cache line 远少于红黑树
+// 叶节点只有元素区，内部节点在其后追加 N + 1 个子节点指针
+// 除根节点外，每个节点的元素个数位于 [min_count, max_count]
+namespace mystl {
+    inline constexpr size_t __btree_node_values(size_t sz) {
+        return (BTREE_NODE_BYTES - 16) / sz >= 3 ? size_t((BTREE_NODE_BYTES - 16) / sz) : size_t(3);
+    }
+
+    template<class Value>
+    struct __btree_node {
+        static constexpr size_t max_count = __btree_node_values(sizeof(Value));
+        static constexpr size_t min_count = (max_count - 1) / 2;
+
+        __btree_node* parent;
+        unsigned short position;    // 在父节点 children 中的下标
+        unsigned short count;       // 元素个数
+        bool leaf;
+        typename std::aligned_storage<sizeof(Value), alignof(Value)>::type storage[max_count];
+
+        Value& value(size_t i) noexcept { return reinterpret_cast<Value*>(storage)[i]; }
+        Value* value_ptr(size_t i) noexcept { return reinterpret_cast<Value*>(storage) + i; }
+
+        __btree_node*& child(size_t i) noexcept;
+        void set_child(size_t i, __btree_node* c) noexcept {
+            child(i) = c;
+            c->parent = this;
+            c->position = static_cast<unsigned short>(i);
+        }
+
+        bool full() const noexcept { return count == max_count; }
+    };
+
+    template<class Value>
+    struct __btree_internal_node : public __btree_node<Value> {
+        __btree_node<Value>* children[__btree_node<Value>::max_count + 1];
+    };
+
+    template<class Value>
+    inline __btree_node<Value>*& __btree_node<Value>::child(size_t i) noexcept {
+        return static_cast<__btree_internal_node<Value>*>(this)->children[i];
+    }
+
+    template<class Value>
+    constexpr size_t __btree_node<Value>::max_count;
+    template<class Value>
+    constexpr size_t __btree_node<Value>::min_count;
+}
+
+
+// 迭代器定义
+// 迭代器由 (节点, 下标) 组成，end() 为最右叶节点的 (node, count)
+namespace mystl {
+    template<class Value, class Ref, class Ptr>
+    struct __btree_iterator {
+        using iterator = __btree_iterator<Value, Value &, Value *>;
+        using const_iterator = __btree_iterator<Value, const Value &, const Value *>;
+        using self = __btree_iterator;
+
+        using iterator_category = bidirectional_iterator_tag;
+        using value_type = Value;
+        using pointer = Ptr;
+        using reference = Ref;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using node_ptr = __btree_node<Value> *;
+
+        // 数据成员
+        node_ptr node;
+        size_type position;
+
+        __btree_iterator() noexcept : node(nullptr), position(0) {}
+        __btree_iterator(node_ptr n, size_type pos) noexcept : node(n), position(pos) {}
+        __btree_iterator(const iterator& rhs) noexcept : node(rhs.node), position(rhs.position) {}
+        self& operator=(const self&) = default;
+
+        reference operator*() const noexcept { return node->value(position); }
+        pointer operator->() const noexcept { return &(operator*()); }
+
+        self& operator++() noexcept {
+            increment();
+            return *this;
+        }
+        self operator++(int) noexcept {
+            self temp = *this;
+            increment();
+            return temp;
+        }
+        self& operator--() noexcept {
+            decrement();
+            return *this;
+        }
+        self operator--(int) noexcept {
+            self temp = *this;
+            decrement();
+            return temp;
+        }
+
+        bool operator==(const self& rhs) const noexcept { return node == rhs.node && position == rhs.position; }
+        bool operator!=(const self& rhs) const noexcept { return !(*this == rhs); }
+
+        void increment() noexcept {
+            if (node->leaf) {
+                if (++position < node->count) return;
+                // 叶节点走完，向上找第一个还有右侧元素的祖先
+                node_ptr n = node;
+                while (n->parent && n->position == n->parent->count) n = n->parent;
+                if (n->parent) {
+                    position = n->position;
+                    node = n->parent;
+                }// 否则已是最右叶节点，停在 end()
+            } else {
+                node = node->child(position + 1);
+                while (!node->leaf) node = node->child(0);
+                position = 0;
+            }
+        }
+
+        void decrement() noexcept {
+            if (node->leaf) {
+                if (position > 0) {
+                    --position;
+                    return;
+                }
+                node_ptr n = node;
+                while (n->parent && n->position == 0) n = n->parent;
+                if (n->parent) {
+                    position = n->position - 1;
+                    node = n->parent;
+                }
+            } else {
+                node = node->child(position);
+                while (!node->leaf) node = node->child(node->count);
+                position = node->count - 1;
+            }
+        }
+    };
+}
+
+
+// btree 定义，供 btree_map 与 btree_set 使用，接口与 SGI rb_tree 对应
+// 元素在节点内与节点间移动时使用移动构造，要求 Value 的移动构造不抛异常
+namespace mystl {
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    class btree {
+    public:
+        using key_type = Key;
+        using value_type = Value;
+        using key_compare = Compare;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = __btree_iterator<Value, Value &, Value *>;
+        using const_iterator = __btree_iterator<Value, const Value &, const Value *>;
+        using reverse_iterator = __reverse_iterator<iterator>;
+        using const_reverse_iterator = __reverse_iterator<const_iterator>;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private:
+        using node_type = __btree_node<Value>;
+        using internal_node_type = __btree_internal_node<Value>;
+        using node_ptr = node_type *;
+        using leaf_allocator = simpleAlloc<node_type>;
+        using internal_allocator = simpleAlloc<internal_node_type>;
+
+        static constexpr size_type max_count = node_type::max_count;
+        static constexpr size_type min_count = node_type::min_count;
+
+        // 数据成员
+        node_ptr root_;
+        node_ptr leftmost_;
+        node_ptr rightmost_;
+        size_type size_;
+        Compare comp_;
+        KeyOfValue key_of_;
+
+    public: // 构造、复制、移动、析构函数
+        btree() noexcept : btree(Compare()) {}
+        explicit btree(const Compare& comp) noexcept
+            : root_(nullptr), leftmost_(nullptr), rightmost_(nullptr), size_(0), comp_(comp), key_of_() {}
+
+        // 按序追加，得到的树节点接近装满
+        btree(const btree& rhs) : btree(rhs.comp_) {
+            try {
+                for (const_iterator it = rhs.begin(); it != rhs.end(); ++it) append_back(*it);
+            } catch (...) {
+                clear();
+                throw;
+            }
+            fix_right_spine();
+        }
+
+        btree(btree&& rhs) noexcept
+            : root_(rhs.root_), leftmost_(rhs.leftmost_), rightmost_(rhs.rightmost_),
+              size_(rhs.size_), comp_(rhs.comp_), key_of_() {
+            rhs.root_ = rhs.leftmost_ = rhs.rightmost_ = nullptr;
+            rhs.size_ = 0;
+        }
+
+        btree& operator=(const btree& rhs) {
+            if (this != &rhs) {
+                btree temp(rhs);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        btree& operator=(btree&& rhs) noexcept {
+            if (this != &rhs) {
+                clear();
+                swap(rhs);
+            }
+            return *this;
+        }
+
+        ~btree() { clear(); }
+
+    public: // 迭代器相关操作
+        iterator begin() noexcept { return iterator(leftmost_, 0); }
+        const_iterator begin() const noexcept { return const_iterator(leftmost_, 0); }
+        iterator end() noexcept { return iterator(rightmost_, rightmost_ ? rightmost_->count : 0); }
+        const_iterator end() const noexcept { return const_iterator(rightmost_, rightmost_ ? rightmost_->count : 0); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        key_compare key_comp() const { return comp_; }
+
+        // 树高，空树为 0
+        size_type height() const noexcept {
+            size_type h = 0;
+            for (node_ptr n = root_; n; n = n->leaf ? nullptr : n->child(0)) ++h;
+            return h;
+        }
+
+    public: // 查找
+        iterator find(const key_type& k) {
+            node_ptr n = root_;
+            while (n) {
+                size_type i = node_lower_bound(n, k);
+                if (i < n->count && !comp_(k, key(n, i))) return iterator(n, i);
+                if (n->leaf) break;
+                n = n->child(i);
+            }
+            return end();
+        }
+        const_iterator find(const key_type& k) const { return const_cast<btree*>(this)->find(k); }
+
+        size_type count(const key_type& k) const { return find(k) == end() ? 0 : 1; }
+        bool contains(const key_type& k) const { return find(k) != end(); }
+
+        // 沿查找路径记下最深的候选位置，即为第一个不小于 k 的元素
+        iterator lower_bound(const key_type& k) {
+            iterator res = end();
+            node_ptr n = root_;
+            while (n) {
+                size_type i = node_lower_bound(n, k);
+                if (i < n->count) res = iterator(n, i);
+                if (n->leaf) break;
+                n = n->child(i);
+            }
+            return res;
+        }
+        const_iterator lower_bound(const key_type& k) const { return const_cast<btree*>(this)->lower_bound(k); }
+
+        iterator upper_bound(const key_type& k) {
+            iterator res = end();
+            node_ptr n = root_;
+            while (n) {
+                size_type i = node_upper_bound(n, k);
+                if (i < n->count) res = iterator(n, i);
+                if (n->leaf) break;
+                n = n->child(i);
+            }
+            return res;
+        }
+        const_iterator upper_bound(const key_type& k) const { return const_cast<btree*>(this)->upper_bound(k); }
+
+        pair<iterator, iterator> equal_range(const key_type& k) {
+            iterator first = lower_bound(k);
+            iterator last = first;
+            if (last != end() && !comp_(k, key_of_(*last))) ++last;
+            return pair<iterator, iterator>(first, last);
+        }
+        pair<const_iterator, const_iterator> equal_range(const key_type& k) const {
+            pair<iterator, iterator> r = const_cast<btree*>(this)->equal_range(k);
+            return pair<const_iterator, const_iterator>(r.first, r.second);
+        }
+
+    public: // 插入
+        pair<iterator, bool> insert_unique(const value_type& value) { return emplace_key(key_of_(value), value); }
+        pair<iterator, bool> insert_unique(value_type&& value) {
+            return emplace_key(key_of_(value), mystl::move(value));
+        }
+
+        template<class... Args>
+        pair<iterator, bool> emplace_unique(Args&&... args) {
+            value_type temp(mystl::forward<Args>(args)...);
+            return emplace_key(key_of_(temp), mystl::move(temp));
+        }
+
+        // 以 k 定位，k 不存在时才用 args 在叶节点中原地构造元素
+        template<class... Args>
+        pair<iterator, bool> emplace_key(const key_type& k, Args&&... args);
+
+        // 空树且输入严格递增时按序批量装载，否则逐个插入
+        template<class InputIterator>
+        void insert_unique(InputIterator first, InputIterator last) {
+            insert_range(first, last, iterator_category_t<InputIterator>());
+        }
+
+    public: // 删除
+        // 返回被删元素的后继
+        iterator erase(const_iterator pos);
+
+        iterator erase(const_iterator first, const_iterator last) {
+            if (first == begin() && last == end()) {
+                clear();
+                return end();
+            }
+            // 删除会重排节点，因此用元素个数而不是迭代器来控制循环
+            size_type n = 0;
+            for (const_iterator it = first; it != last; ++it) ++n;
+            iterator cur(first.node, first.position);
+            while (n--) cur = erase(cur);
+            return cur;
+        }
+
+        size_type erase_unique(const key_type& k) {
+            iterator it = find(k);
+            if (it == end()) return 0;
+            erase(it);
+            return 1;
+        }
+
+        void clear() noexcept {
+            if (root_) destroy_subtree(root_);
+            root_ = leftmost_ = rightmost_ = nullptr;
+            size_ = 0;
+        }
+
+        void swap(btree& rhs) noexcept {
+            mystl::swap(root_, rhs.root_);
+            mystl::swap(leftmost_, rhs.leftmost_);
+            mystl::swap(rightmost_, rhs.rightmost_);
+            mystl::swap(size_, rhs.size_);
+            mystl::swap(comp_, rhs.comp_);
+        }
+
+    private: // 节点内操作
+        const key_type& key(node_ptr n, size_type i) const { return key_of_(n->value(i)); }
+
+        size_type node_lower_bound(node_ptr n, const key_type& k) const {
+            size_type lo = 0, hi = n->count;
+            while (lo < hi) {
+                size_type mid = (lo + hi) / 2;
+                if (comp_(key(n, mid), k)) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo;
+        }
+
+        size_type node_upper_bound(node_ptr n, const key_type& k) const {
+            size_type lo = 0, hi = n->count;
+            while (lo < hi) {
+                size_type mid = (lo + hi) / 2;
+                if (comp_(k, key(n, mid))) hi = mid;
+                else lo = mid + 1;
+            }
+            return lo;
+        }
+
+        static void move_value(node_ptr dst, size_type j, node_ptr src, size_type i) {
+            mystl::construct(dst->value_ptr(j), mystl::move(src->value(i)));
+            mystl::destroy(src->value_ptr(i));
+        }
+
+        // [i, count) 右移一位，不修改 count
+        static void shift_right(node_ptr n, size_type i) {
+            for (size_type j = n->count; j > i; --j) move_value(n, j, n, j - 1);
+            if (!n->leaf) {
+                for (size_type j = n->count + 1; j > i + 1; --j) n->set_child(j, n->child(j - 1));
+            }
+        }
+
+        // 第 i 个元素已移走，(i, count) 左移一位填补，子节点 (i + 1, count] 同时左移，不修改 count
+        static void shift_left(node_ptr n, size_type i) {
+            for (size_type j = i; j + 1 < n->count; ++j) move_value(n, j, n, j + 1);
+            if (!n->leaf) {
+                for (size_type j = i + 1; j < n->count; ++j) n->set_child(j, n->child(j + 1));
+            }
+        }
+
+    private: // 节点管理
+        static node_ptr new_leaf() {
+            node_ptr n = leaf_allocator::allocate();
+            n->parent = nullptr;
+            n->position = 0;
+            n->count = 0;
+            n->leaf = true;
+            return n;
+        }
+
+        static node_ptr new_internal() {
+            node_ptr n = internal_allocator::allocate();
+            n->parent = nullptr;
+            n->position = 0;
+            n->count = 0;
+            n->leaf = false;
+            return n;
+        }
+
+        static void delete_node(node_ptr n) noexcept {
+            if (n->leaf) leaf_allocator::deallocate(n);
+            else internal_allocator::deallocate(static_cast<internal_node_type*>(n));
+        }
+
+        static void destroy_subtree(node_ptr n) noexcept {
+            if (!n->leaf) {
+                for (size_type i = 0; i <= n->count; ++i) destroy_subtree(n->child(i));
+            }
+            for (size_type i = 0; i < n->count; ++i) mystl::destroy(n->value_ptr(i));
+            delete_node(n);
+        }
+
+        void split_child(node_ptr p, size_type i);
+        void fix_right_spine();
+        void rebalance(node_ptr n, iterator& it);
+        void rotate_right(node_ptr p, size_type k, iterator& it);
+        void rotate_left(node_ptr p, size_type k, iterator& it);
+        void merge_children(node_ptr p, size_type k, iterator& it);
+
+        // 追加一个大于所有现有元素的值，右侧路径上的节点可能暂时不满足最少元素数，
+        // 全部追加完成后须调用 fix_right_spine
+        template<class V>
+        void append_back(V&& value) {
+            if (!root_) root_ = leftmost_ = rightmost_ = new_leaf();
+            node_ptr n = rightmost_;
+            if (n->count < max_count) {
+                mystl::construct(n->value_ptr(n->count), mystl::forward<V>(value));
+                ++n->count;
+                ++size_;
+                return;
+            }
+            // 最右叶节点已满：value 作为分隔元素放进第一个有空位的右侧祖先，
+            // 其下每个已满的层补一个空的内部节点，最底层是新的最右叶节点
+            size_type levels = 0;
+            node_ptr p = n->parent;
+            for (; p && p->full(); p = p->parent) ++levels;
+            node_ptr leaf = new_leaf();
+            node_ptr chain = leaf;
+            node_ptr new_root = nullptr;
+            try {
+                for (; levels; --levels) {
+                    node_ptr q = new_internal();
+                    q->set_child(0, chain);
+                    chain = q;
+                }
+                if (!p) p = new_root = new_internal();
+                mystl::construct(p->value_ptr(p->count), mystl::forward<V>(value));
+            } catch (...) {
+                while (chain) {
+                    node_ptr next = chain->leaf ? nullptr : chain->child(0);
+                    delete_node(chain);
+                    chain = next;
+                }
+                if (new_root) delete_node(new_root);
+                throw;
+            }
+            if (new_root) {
+                new_root->set_child(0, root_);
+                root_ = new_root;
+            }
+            ++p->count;
+            p->set_child(p->count, chain);
+            rightmost_ = leaf;
+            ++size_;
+        }
+
+        template<class InputIterator>
+        void insert_range(InputIterator first, InputIterator last, input_iterator_tag) {
+            for (; first != last; ++first) insert_unique(*first);
+        }
+
+        template<class ForwardIterator>
+        void insert_range(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+            if (empty() && strictly_sorted(first, last)) {
+                try {
+                    for (; first != last; ++first) append_back(*first);
+                } catch (...) {
+                    fix_right_spine();
+                    throw;
+                }
+                fix_right_spine();
+            } else {
+                for (; first != last; ++first) insert_unique(*first);
+            }
+        }
+
+        template<class ForwardIterator>
+        bool strictly_sorted(ForwardIterator first, ForwardIterator last) const {
+            if (first == last) return true;
+            ForwardIterator next = first;
+            for (++next; next != last; ++first, ++next) {
+                if (!comp_(key_of_(*first), key_of_(*next))) return false;
+            }
+            return true;
+        }
+    };
+
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    constexpr size_t btree<Key, Value, KeyOfValue, Compare, Alloc>::max_count;
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    constexpr size_t btree<Key, Value, KeyOfValue, Compare, Alloc>::min_count;
+
+
+    // 自顶向下插入：沿途遇到满节点先分裂，保证到达叶节点时一定有空位
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    template<class... Args>
+    pair<typename btree<Key, Value, KeyOfValue, Compare, Alloc>::iterator, bool>
+    btree<Key, Value, KeyOfValue, Compare, Alloc>::emplace_key(const key_type& k, Args&&... args) {
+        if (!root_) root_ = leftmost_ = rightmost_ = new_leaf();
+        if (root_->full()) {
+            node_ptr r = new_internal();
+            r->set_child(0, root_);
+            root_ = r;
+            split_child(r, 0);
+        }
+        node_ptr n = root_;
+        while (true) {
+            size_type i = node_lower_bound(n, k);
+            if (i < n->count && !comp_(k, key(n, i))) return pair<iterator, bool>(iterator(n, i), false);
+            if (n->leaf) {
+                shift_right(n, i);
+                try {
+                    mystl::construct(n->value_ptr(i), mystl::forward<Args>(args)...);
+                } catch (...) {
+                    for (size_type j = i; j < n->count; ++j) move_value(n, j, n, j + 1);
+                    throw;
+                }
+                ++n->count;
+                ++size_;
+                return pair<iterator, bool>(iterator(n, i), true);
+            }
+            if (n->child(i)->full()) {
+                split_child(n, i);
+                if (comp_(key(n, i), k)) ++i;
+                else if (!comp_(k, key(n, i))) return pair<iterator, bool>(iterator(n, i), false);
+            }
+            n = n->child(i);
+        }
+    }
+
+    // 把 p 的第 i 个子节点（已满）一分为二，中间元素上移到 p
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    void btree<Key, Value, KeyOfValue, Compare, Alloc>::split_child(node_ptr p, size_type i) {
+        node_ptr c = p->child(i);
+        node_ptr r = c->leaf ? new_leaf() : new_internal();
+        const size_type left = (max_count - 1) / 2;
+
+        for (size_type j = left + 1; j < c->count; ++j) move_value(r, j - left - 1, c, j);
+        if (!c->leaf) {
+            for (size_type j = left + 1; j <= c->count; ++j) r->set_child(j - left - 1, c->child(j));
+        }
+        r->count = static_cast<unsigned short>(c->count - left - 1);
+
+        shift_right(p, i);
+        move_value(p, i, c, left);
+        p->set_child(i + 1, r);
+        ++p->count;
+        c->count = static_cast<unsigned short>(left);
+        if (rightmost_ == c) rightmost_ = r;
+    }
+
+    // 删除内部节点的元素时，用左子树中的前驱顶替，真正的删除总发生在叶节点上
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    typename btree<Key, Value, KeyOfValue, Compare, Alloc>::iterator
+    btree<Key, Value, KeyOfValue, Compare, Alloc>::erase(const_iterator pos) {
+        node_ptr n = pos.node;
+        const size_type i = pos.position;
+        node_ptr leaf;
+        iterator next;
+
+        mystl::destroy(n->value_ptr(i));
+        if (!n->leaf) {
+            leaf = n->child(i);
+            while (!leaf->leaf) leaf = leaf->child(leaf->count);
+            move_value(n, i, leaf, leaf->count - 1);
+            --leaf->count;
+            next = iterator(n, i);
+            next.increment();
+        } else {
+            shift_left(n, i);
+            --n->count;
+            leaf = n;
+            next = iterator(n, i);
+            if (i == n->count) {// 删除的是叶节点末尾，后继在祖先中或不存在
+                node_ptr m = n;
+                while (m->parent && m->position == m->parent->count) m = m->parent;
+                next = m->parent ? iterator(m->parent, m->position) : iterator();
+            }
+        }
+        --size_;
+
+        rebalance(leaf, next);
+        return next.node ? next : end();
+    }
+
+    // 自下而上修复元素过少的节点：先向兄弟借，借不到则与兄弟合并
+    // it 跟踪被删元素的后继，节点重排时同步修正，node 为空表示 end()
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    void btree<Key, Value, KeyOfValue, Compare, Alloc>::rebalance(node_ptr n, iterator& it) {
+        while (n != root_ && n->count < min_count) {
+            node_ptr p = n->parent;
+            const size_type i = n->position;
+            if (i > 0 && p->child(i - 1)->count > min_count) {
+                rotate_right(p, i - 1, it);
+                return;
+            }
+            if (i < p->count && p->child(i + 1)->count > min_count) {
+                rotate_left(p, i, it);
+                return;
+            }
+            merge_children(p, i > 0 ? i - 1 : i, it);
+            n = p;
+        }
+        if (root_->count == 0) {
+            node_ptr old = root_;
+            if (root_->leaf) {
+                root_ = leftmost_ = rightmost_ = nullptr;
+            } else {
+                root_ = root_->child(0);
+                root_->parent = nullptr;
+                root_->position = 0;
+            }
+            delete_node(old);
+        }
+    }
+
+    // 左兄弟的末尾元素经父节点转到右兄弟开头
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    void btree<Key, Value, KeyOfValue, Compare, Alloc>::rotate_right(node_ptr p, size_type k, iterator& it) {
+        node_ptr left = p->child(k);
+        node_ptr right = p->child(k + 1);
+        if (it.node == right) ++it.position;
+        else if (it.node == p && it.position == k) it = iterator(right, 0);
+        else if (it.node == left && it.position == left->count - 1u) it = iterator(p, k);
+
+        for (size_type j = right->count; j > 0; --j) move_value(right, j, right, j - 1);
+        if (!right->leaf) {
+            for (size_type j = right->count + 1; j > 0; --j) right->set_child(j, right->child(j - 1));
+            right->set_child(0, left->child(left->count));
+        }
+        move_value(right, 0, p, k);
+        move_value(p, k, left, left->count - 1);
+        --left->count;
+        ++right->count;
+    }
+
+    // 右兄弟的开头元素经父节点转到左兄弟末尾
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    void btree<Key, Value, KeyOfValue, Compare, Alloc>::rotate_left(node_ptr p, size_type k, iterator& it) {
+        node_ptr left = p->child(k);
+        node_ptr right = p->child(k + 1);
+        if (it.node == p && it.position == k) it = iterator(left, left->count);
+        else if (it.node == right && it.position == 0) it = iterator(p, k);
+        else if (it.node == right) --it.position;
+
+        move_value(left, left->count, p, k);
+        move_value(p, k, right, 0);
+        if (!right->leaf) {
+            left->set_child(left->count + 1, right->child(0));
+            right->set_child(0, right->child(1));
+        }
+        shift_left(right, 0);
+        ++left->count;
+        --right->count;
+    }
+
+    // 把 p 的第 k + 1 个子节点与分隔元素一起并入第 k 个子节点
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    void btree<Key, Value, KeyOfValue, Compare, Alloc>::merge_children(node_ptr p, size_type k, iterator& it) {
+        node_ptr left = p->child(k);
+        node_ptr right = p->child(k + 1);
+        if (it.node == right) it = iterator(left, left->count + 1 + it.position);
+        else if (it.node == p && it.position == k) it = iterator(left, left->count);
+        else if (it.node == p && it.position > k) --it.position;
+
+        const size_type base = left->count + 1;
+        move_value(left, left->count, p, k);
+        for (size_type j = 0; j < right->count; ++j) move_value(left, base + j, right, j);
+        if (!left->leaf) {
+            for (size_type j = 0; j <= right->count; ++j) left->set_child(base + j, right->child(j));
+        }
+        left->count = static_cast<unsigned short>(base + right->count);
+
+        shift_left(p, k);
+        --p->count;
+        if (rightmost_ == right) rightmost_ = left;
+        delete_node(right);
+    }
+
+    // 批量追加后右侧路径上的节点可能元素不足，自顶向下从左兄弟（必然是满的）借入补齐
+    template<class Key, class Value, class KeyOfValue, class Compare, class Alloc>
+    void btree<Key, Value, KeyOfValue, Compare, Alloc>::fix_right_spine() {
+        iterator dummy;
+        for (node_ptr p = root_; p && !p->leaf; p = p->child(p->count)) {
+            node_ptr n = p->child(p->count);
+            while (n->count < min_count) rotate_right(p, p->count - 1, dummy);
+        }
+    }
+
+} // namespace mystl
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "btree.h"
+#include "functional.h"
+#include "pair.h"
+
+#include <initializer_list>
+#include <stdexcept>
+
+// btree_map：基于 B 树的有序映射
+// 与红黑树实现的 map 不同，插入和删除会在节点内移动元素，因此可能使其他元素的迭代器与引用失效
+namespace mystl {
+
+    template<class Key, class T, class Compare = mystl::less<Key>,
+             class Alloc = simpleAlloc<pair<const Key, T>>>
+    class btree_map {
+    private:
+        using rep_type = btree<Key, pair<const Key, T>, select1st<pair<const Key, T>>, Compare, Alloc>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = typename rep_type::value_type;
+        using key_compare = Compare;
+        using pointer = typename rep_type::pointer;
+        using const_pointer = typename rep_type::const_pointer;
+        using reference = typename rep_type::reference;
+        using const_reference = typename rep_type::const_reference;
+        using iterator = typename rep_type::iterator;
+        using const_iterator = typename rep_type::const_iterator;
+        using reverse_iterator = typename rep_type::reverse_iterator;
+        using const_reverse_iterator = typename rep_type::const_reverse_iterator;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private:
+        rep_type t_;
+
+    public: // 构造函数
+        btree_map() = default;
+        explicit btree_map(const Compare& comp) : t_(comp) {}
+
+        // 输入按键严格递增时整体装载，节点几乎全满
+        template<class InputIterator>
+        btree_map(InputIterator first, InputIterator last) { t_.insert_unique(first, last); }
+
+        btree_map(std::initializer_list<value_type> ilist) { t_.insert_unique(ilist.begin(), ilist.end()); }
+
+        btree_map& operator=(std::initializer_list<value_type> ilist) {
+            clear();
+            t_.insert_unique(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+    public: // 迭代器相关操作
+        iterator               begin()        noexcept { return t_.begin(); }
+        const_iterator         begin()  const noexcept { return t_.begin(); }
+        iterator               end()          noexcept { return t_.end(); }
+        const_iterator         end()    const noexcept { return t_.end(); }
+        reverse_iterator       rbegin()       noexcept { return t_.rbegin(); }
+        const_reverse_iterator rbegin() const noexcept { return t_.rbegin(); }
+        reverse_iterator       rend()         noexcept { return t_.rend(); }
+        const_reverse_iterator rend()   const noexcept { return t_.rend(); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return t_.empty(); }
+        size_type size() const noexcept { return t_.size(); }
+        size_type height() const noexcept { return t_.height(); }
+        key_compare key_comp() const { return t_.key_comp(); }
+
+    public: // 查找
+        iterator find(const key_type& key) { return t_.find(key); }
+        const_iterator find(const key_type& key) const { return t_.find(key); }
+        size_type count(const key_type& key) const { return t_.count(key); }
+        bool contains(const key_type& key) const { return t_.contains(key); }
+
+        iterator lower_bound(const key_type& key) { return t_.lower_bound(key); }
+        const_iterator lower_bound(const key_type& key) const { return t_.lower_bound(key); }
+        iterator upper_bound(const key_type& key) { return t_.upper_bound(key); }
+        const_iterator upper_bound(const key_type& key) const { return t_.upper_bound(key); }
+        pair<iterator, iterator> equal_range(const key_type& key) { return t_.equal_range(key); }
+        pair<const_iterator, const_iterator> equal_range(const key_type& key) const { return t_.equal_range(key); }
+
+        mapped_type& at(const key_type& key) {
+            iterator it = find(key);
+            if (it == end()) throw std::out_of_range("btree_map::at");
+            return it->second;
+        }
+        const mapped_type& at(const key_type& key) const {
+            const_iterator it = find(key);
+            if (it == end()) throw std::out_of_range("btree_map::at");
+            return it->second;
+        }
+
+        mapped_type& operator[](const key_type& key) { return try_emplace(key).first->second; }
+        mapped_type& operator[](key_type&& key) { return try_emplace(mystl::move(key)).first->second; }
+
+    public: // 插入
+        pair<iterator, bool> insert(const value_type& value) { return t_.insert_unique(value); }
+        pair<iterator, bool> insert(value_type&& value) { return t_.insert_unique(mystl::move(value)); }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) { t_.insert_unique(first, last); }
+        void insert(std::initializer_list<value_type> ilist) { t_.insert_unique(ilist.begin(), ilist.end()); }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args&&... args) { return t_.emplace_unique(mystl::forward<Args>(args)...); }
+
+        // 键已存在时不构造 mapped_type，也不移动 args
+        template<class K, class... Args>
+        pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+            const key_type& k = key;
+            iterator it = find(k);
+            if (it != end()) return pair<iterator, bool>(it, false);
+            return t_.emplace_key(k, mystl::forward<K>(key), mapped_type(mystl::forward<Args>(args)...));
+        }
+
+        template<class M>
+        pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+            iterator it = find(key);
+            if (it != end()) {
+                it->second = mystl::forward<M>(obj);
+                return pair<iterator, bool>(it, false);
+            }
+            return t_.emplace_key(key, key, mystl::forward<M>(obj));
+        }
+
+    public: // 删除，返回被删元素的后继
+        iterator erase(const_iterator pos) { return t_.erase(pos); }
+        iterator erase(iterator pos) { return t_.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return t_.erase(first, last); }
+        size_type erase(const key_type& key) { return t_.erase_unique(key); }
+
+        void clear() noexcept { t_.clear(); }
+        void swap(btree_map& rhs) noexcept { t_.swap(rhs.t_); }
+
+    public: // 比较
+        friend bool operator==(const btree_map& lhs, const btree_map& rhs) {
+            if (lhs.size() != rhs.size()) return false;
+            const_iterator it1 = lhs.begin(), it2 = rhs.begin();
+            for (; it1 != lhs.end(); ++it1, ++it2) {
+                if (!(*it1 == *it2)) return false;
+            }
+            return true;
+        }
+        friend bool operator!=(const btree_map& lhs, const btree_map& rhs) { return !(lhs == rhs); }
+        friend bool operator<(const btree_map& lhs, const btree_map& rhs) {
+            return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+    };
+
+    template<class Key, class T, class Compare, class Alloc>
+    inline void swap(btree_map<Key, T, Compare, Alloc>& lhs, btree_map<Key, T, Compare, Alloc>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "btree.h"
+#include "functional.h"
+#include "pair.h"
+
+#include <initializer_list>
+
+// btree_set：基于 B 树的有序集合，元素不可修改，iterator 与 const_iterator 相同
+namespace mystl {
+
+    template<class Key, class Compare = mystl::less<Key>, class Alloc = simpleAlloc<Key>>
+    class btree_set {
+    private:
+        using rep_type = btree<Key, Key, identity<Key>, Compare, Alloc>;
+
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using key_compare = Compare;
+        using value_compare = Compare;
+        using pointer = typename rep_type::const_pointer;
+        using const_pointer = typename rep_type::const_pointer;
+        using reference = typename rep_type::const_reference;
+        using const_reference = typename rep_type::const_reference;
+        using iterator = typename rep_type::const_iterator;
+        using const_iterator = typename rep_type::const_iterator;
+        using reverse_iterator = typename rep_type::const_reverse_iterator;
+        using const_reverse_iterator = typename rep_type::const_reverse_iterator;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private:
+        rep_type t_;
+
+    public: // 构造函数
+        btree_set() = default;
+        explicit btree_set(const Compare& comp) : t_(comp) {}
+
+        // 输入严格递增时整体装载，节点几乎全满
+        template<class InputIterator>
+        btree_set(InputIterator first, InputIterator last) { t_.insert_unique(first, last); }
+
+        btree_set(std::initializer_list<value_type> ilist) { t_.insert_unique(ilist.begin(), ilist.end()); }
+
+        btree_set& operator=(std::initializer_list<value_type> ilist) {
+            clear();
+            t_.insert_unique(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+    public: // 迭代器相关操作
+        iterator         begin()  const noexcept { return t_.begin(); }
+        iterator         end()    const noexcept { return t_.end(); }
+        reverse_iterator rbegin() const noexcept { return t_.rbegin(); }
+        reverse_iterator rend()   const noexcept { return t_.rend(); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return t_.empty(); }
+        size_type size() const noexcept { return t_.size(); }
+        size_type height() const noexcept { return t_.height(); }
+        key_compare key_comp() const { return t_.key_comp(); }
+        value_compare value_comp() const { return t_.key_comp(); }
+
+    public: // 查找
+        iterator find(const key_type& key) const { return t_.find(key); }
+        size_type count(const key_type& key) const { return t_.count(key); }
+        bool contains(const key_type& key) const { return t_.contains(key); }
+        iterator lower_bound(const key_type& key) const { return t_.lower_bound(key); }
+        iterator upper_bound(const key_type& key) const { return t_.upper_bound(key); }
+        pair<iterator, iterator> equal_range(const key_type& key) const { return t_.equal_range(key); }
+
+    public: // 插入
+        pair<iterator, bool> insert(const value_type& value) {
+            pair<typename rep_type::iterator, bool> res = t_.insert_unique(value);
+            return pair<iterator, bool>(res.first, res.second);
+        }
+        pair<iterator, bool> insert(value_type&& value) {
+            pair<typename rep_type::iterator, bool> res = t_.insert_unique(mystl::move(value));
+            return pair<iterator, bool>(res.first, res.second);
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) { t_.insert_unique(first, last); }
+        void insert(std::initializer_list<value_type> ilist) { t_.insert_unique(ilist.begin(), ilist.end()); }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args&&... args) {
+            pair<typename rep_type::iterator, bool> res = t_.emplace_unique(mystl::forward<Args>(args)...);
+            return pair<iterator, bool>(res.first, res.second);
+        }
+
+    public: // 删除，返回被删元素的后继
+        iterator erase(const_iterator pos) { return t_.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return t_.erase(first, last); }
+        size_type erase(const key_type& key) { return t_.erase_unique(key); }
+
+        void clear() noexcept { t_.clear(); }
+        void swap(btree_set& rhs) noexcept { t_.swap(rhs.t_); }
+
+    public: // 比较
+        friend bool operator==(const btree_set& lhs, const btree_set& rhs) {
+            if (lhs.size() != rhs.size()) return false;
+            const_iterator it1 = lhs.begin(), it2 = rhs.begin();
+            for (; it1 != lhs.end(); ++it1, ++it2) {
+                if (!(*it1 == *it2)) return false;
+            }
+            return true;
+        }
+        friend bool operator!=(const btree_set& lhs, const btree_set& rhs) { return !(lhs == rhs); }
+        friend bool operator<(const btree_set& lhs, const btree_set& rhs) {
+            return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+    };
+
+    template<class Key, class Compare, class Alloc>
+    inline void swap(btree_set<Key, Compare, Alloc>& lhs, btree_set<Key, Compare, Alloc>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
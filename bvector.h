@@ -0,0 +1,399 @@
+#pragma once
+
+#include "bitops.h"
+#include "algobase.h"
+#include "allocator.h"
+#include "iterator.h"
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+// vector<bool> 特化：每个元素只占一位，按 64 位的字存放（对应 SGI 的 stl_bvector.h）
+// 解引用迭代器得到 __bit_reference 代理；count、find、fill 对位迭代器区间逐字处理，
+// flip 与 &、|、^ 作用于整个 vector。由 vector.h 在末尾包含，不单独使用
+namespace mystl {
+
+    template<bool Const>
+    struct __bit_iterator {
+        using iterator = __bit_iterator<false>;
+        using self = __bit_iterator;
+        using word_pointer = typename std::conditional<Const, const __bit_word*, __bit_word*>::type;
+
+        using iterator_category = random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = ptrdiff_t;
+        using reference = typename std::conditional<Const, bool, __bit_reference>::type;
+        using pointer = void;
+
+        // 数据成员：所在的字与字内偏移
+        word_pointer p;
+        unsigned offset;
+
+        __bit_iterator() noexcept : p(nullptr), offset(0) {}
+        __bit_iterator(word_pointer word, unsigned off) noexcept : p(word), offset(off) {}
+        __bit_iterator(const iterator& rhs) noexcept : p(rhs.p), offset(rhs.offset) {}
+        self& operator=(const self&) = default;
+
+        reference operator*() const noexcept {
+            if constexpr (Const) return (*p >> offset) & 1;
+            else return __bit_reference(p, __bit_word(1) << offset);
+        }
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        self& operator++() noexcept {
+            if (++offset == __word_bits) {
+                offset = 0;
+                ++p;
+            }
+            return *this;
+        }
+        self operator++(int) noexcept { self temp = *this; ++*this; return temp; }
+        self& operator--() noexcept {
+            if (offset-- == 0) {
+                offset = __word_bits - 1;
+                --p;
+            }
+            return *this;
+        }
+        self operator--(int) noexcept { self temp = *this; --*this; return temp; }
+
+        self& operator+=(difference_type n) noexcept {
+            difference_type k = static_cast<difference_type>(offset) + n;
+            difference_type words = k / static_cast<difference_type>(__word_bits);
+            k %= static_cast<difference_type>(__word_bits);
+            if (k < 0) {
+                k += __word_bits;
+                --words;
+            }
+            p += words;
+            offset = static_cast<unsigned>(k);
+            return *this;
+        }
+        self& operator-=(difference_type n) noexcept { return *this += -n; }
+        self operator+(difference_type n) const noexcept { self temp = *this; return temp += n; }
+        self operator-(difference_type n) const noexcept { self temp = *this; return temp -= n; }
+        difference_type operator-(const self& rhs) const noexcept {
+            return (p - rhs.p) * static_cast<difference_type>(__word_bits) +
+                   static_cast<difference_type>(offset) - static_cast<difference_type>(rhs.offset);
+        }
+
+        bool operator==(const self& rhs) const noexcept { return p == rhs.p && offset == rhs.offset; }
+        bool operator!=(const self& rhs) const noexcept { return !(*this == rhs); }
+        bool operator<(const self& rhs) const noexcept { return p < rhs.p || (p == rhs.p && offset < rhs.offset); }
+        bool operator>(const self& rhs) const noexcept { return rhs < *this; }
+        bool operator<=(const self& rhs) const noexcept { return !(rhs < *this); }
+        bool operator>=(const self& rhs) const noexcept { return !(*this < rhs); }
+    };
+
+    // 对 [first, last) 覆盖到的每个字调用 f(字指针, 区间在该字内的掩码)，f 返回 true 时提前结束。
+    // 只有区间真正覆盖到的字才会被访问，last 指向存储末尾之后时不会越界
+    template<class WordPtr, class Function>
+    void __bit_for_each_word(WordPtr p, unsigned first_offset, WordPtr last_p, unsigned last_offset, Function f) {
+        if (p == last_p) {
+            if (first_offset < last_offset) f(p, __low_mask(last_offset) & ~__low_mask(first_offset));
+            return;
+        }
+        if (f(p, ~__low_mask(first_offset))) return;
+        for (++p; p != last_p; ++p) {
+            if (f(p, ~__bit_word(0))) return;
+        }
+        if (last_offset != 0) f(p, __low_mask(last_offset));
+    }
+
+    template<bool Const>
+    ptrdiff_t __bit_count(__bit_iterator<Const> first, __bit_iterator<Const> last, bool value) {
+        size_t ones = 0;
+        if (first.p == last.p) {
+            mystl::__bit_for_each_word(first.p, first.offset, last.p, last.offset,
+                                       [&](const __bit_word* w, __bit_word mask) { ones += __popcount(*w & mask); return false; });
+        } else {// 首尾的不完整字单独处理，中间整段交给 __popcount_words
+            ones = __popcount(*first.p & ~__low_mask(first.offset)) +
+                   __popcount_words(first.p + 1, static_cast<size_t>(last.p - first.p - 1));
+            if (last.offset != 0) ones += __popcount(*last.p & __low_mask(last.offset));
+        }
+        return value ? static_cast<ptrdiff_t>(ones) : (last - first) - static_cast<ptrdiff_t>(ones);
+    }
+
+    template<bool Const>
+    __bit_iterator<Const> __bit_find(__bit_iterator<Const> first, __bit_iterator<Const> last, bool value) {
+        __bit_iterator<Const> result = last;
+        mystl::__bit_for_each_word(first.p, first.offset, last.p, last.offset,
+                                   [&](typename __bit_iterator<Const>::word_pointer w, __bit_word mask) {
+                                       const __bit_word bits = (value ? *w : ~*w) & mask;
+                                       if (!bits) return false;
+                                       result = __bit_iterator<Const>(w, static_cast<unsigned>(__ctz(bits)));
+                                       return true;
+                                   });
+        return result;
+    }
+
+    inline ptrdiff_t count(__bit_iterator<false> first, __bit_iterator<false> last, const bool& value) {
+        return mystl::__bit_count(first, last, value);
+    }
+    inline ptrdiff_t count(__bit_iterator<true> first, __bit_iterator<true> last, const bool& value) {
+        return mystl::__bit_count(first, last, value);
+    }
+    inline __bit_iterator<false> find(__bit_iterator<false> first, __bit_iterator<false> last, const bool& value) {
+        return mystl::__bit_find(first, last, value);
+    }
+    inline __bit_iterator<true> find(__bit_iterator<true> first, __bit_iterator<true> last, const bool& value) {
+        return mystl::__bit_find(first, last, value);
+    }
+
+    inline void fill(__bit_iterator<false> first, __bit_iterator<false> last, const bool& value) {
+        mystl::__bit_for_each_word(first.p, first.offset, last.p, last.offset, [value](__bit_word* w, __bit_word mask) {
+            *w = value ? (*w | mask) : (*w & ~mask);
+            return false;
+        });
+    }
+
+    // 取反区间内的每一位
+    inline void flip(__bit_iterator<false> first, __bit_iterator<false> last) {
+        mystl::__bit_for_each_word(first.p, first.offset, last.p, last.offset, [](__bit_word* w, __bit_word mask) {
+            *w ^= mask;
+            return false;
+        });
+    }
+
+    template<class T, class Alloc>
+    class vector;
+
+    // 不变式：最后一个字中超出 size() 的位始终为 0，整字比较与计数无需再屏蔽
+    template<class Alloc>
+    class vector<bool, Alloc> {
+    public:
+        using value_type = bool;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = __bit_reference;
+        using const_reference = bool;
+        using iterator = __bit_iterator<false>;
+        using const_iterator = __bit_iterator<true>;
+        using reverse_iterator = __reverse_iterator<iterator>;
+        using const_reverse_iterator = __reverse_iterator<const_iterator>;
+        using word_type = __bit_word;
+
+    private:
+        using word_allocator = typename __rebind_alloc<Alloc, __bit_word>::type;
+
+        __bit_word* words_;
+        size_type size_;
+        size_type capacity_;// 以字计
+
+        static __bit_word* allocate_words(size_type n) {
+            __bit_word* p = word_allocator::allocate(n);
+            if (n) std::memset(p, 0, n * sizeof(__bit_word));
+            return p;
+        }
+
+        // 清掉最后一个字中超出 size_ 的位
+        void clear_tail() noexcept {
+            if (size_ % __word_bits) words_[size_ / __word_bits] &= __low_mask(size_ % __word_bits);
+        }
+
+        // 缩小到 n 位：除了新末字的尾部，原先用到而现在整字超出 size_ 的字也要清零，
+        // 否则之后增长时只写新增的位，旧位会重新出现在 size() 之内
+        void truncate(size_type n) noexcept {
+            const size_type old_words = __words_for(size_);
+            size_ = n;
+            const size_type new_words = __words_for(n);
+            if (old_words > new_words) std::memset(words_ + new_words, 0, (old_words - new_words) * sizeof(__bit_word));
+            clear_tail();
+        }
+
+        void reallocate(size_type new_words) {
+            __bit_word* fresh = allocate_words(new_words);
+            if (size_) std::memcpy(fresh, words_, __words_for(size_) * sizeof(__bit_word));
+            word_allocator::deallocate(words_, capacity_);
+            words_ = fresh;
+            capacity_ = new_words;
+        }
+
+        // 与 vector 相同的翻倍策略，以位计
+        void grow_for(size_type n) {
+            if (__words_for(n) <= capacity_) return;
+            const size_type doubled = 2 * capacity_;
+            reallocate(doubled > __words_for(n) ? doubled : __words_for(n));
+        }
+
+        template<class Integer>
+        void initialize_aux(Integer n, Integer value, true_type) { assign(static_cast<size_type>(n), static_cast<bool>(value)); }
+        template<class InputIterator>
+        void initialize_aux(InputIterator first, InputIterator last, false_type) {
+            for (; first != last; ++first) push_back(static_cast<bool>(*first));
+        }
+
+    public: // 构造、析构与赋值
+        vector() noexcept : words_(nullptr), size_(0), capacity_(0) {}
+        explicit vector(size_type n, bool value = false) : vector() { assign(n, value); }
+        template<class InputIterator>
+        vector(InputIterator first, InputIterator last) : vector() {
+            initialize_aux(first, last, is_integral<InputIterator>());
+        }
+        vector(std::initializer_list<bool> ilist) : vector(ilist.begin(), ilist.end()) {}
+
+        vector(const vector& rhs) : words_(allocate_words(__words_for(rhs.size_))), size_(rhs.size_),
+                                    capacity_(__words_for(rhs.size_)) {
+            if (size_) std::memcpy(words_, rhs.words_, capacity_ * sizeof(__bit_word));
+        }
+        vector(vector&& rhs) noexcept : words_(rhs.words_), size_(rhs.size_), capacity_(rhs.capacity_) {
+            rhs.words_ = nullptr;
+            rhs.size_ = rhs.capacity_ = 0;
+        }
+
+        ~vector() { word_allocator::deallocate(words_, capacity_); }
+
+        vector& operator=(const vector& rhs) {
+            if (this != &rhs) {
+                vector temp(rhs);
+                swap(temp);
+            }
+            return *this;
+        }
+        vector& operator=(vector&& rhs) noexcept {
+            vector temp(mystl::move(rhs));
+            swap(temp);
+            return *this;
+        }
+        vector& operator=(std::initializer_list<bool> ilist) {
+            vector temp(ilist);
+            swap(temp);
+            return *this;
+        }
+
+        void assign(size_type n, bool value) {
+            if (__words_for(n) > capacity_) reallocate(__words_for(n));
+            truncate(n < size_ ? n : size_);
+            size_ = n;
+            if (n) std::memset(words_, value ? 0xFF : 0, __words_for(n) * sizeof(__bit_word));
+            clear_tail();
+        }
+
+    public: // 迭代器
+        iterator               begin()         noexcept { return iterator(words_, 0); }
+        const_iterator         begin()   const noexcept { return const_iterator(words_, 0); }
+        iterator               end()           noexcept { return begin() + static_cast<difference_type>(size_); }
+        const_iterator         end()     const noexcept { return begin() + static_cast<difference_type>(size_); }
+        const_iterator         cbegin()  const noexcept { return begin(); }
+        const_iterator         cend()    const noexcept { return end(); }
+        reverse_iterator       rbegin()        noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator       rend()          noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+
+    public: // 容量
+        size_type size() const noexcept { return size_; }
+        size_type capacity() const noexcept { return capacity_ * __word_bits; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        void reserve(size_type n) {
+            if (__words_for(n) > capacity_) reallocate(__words_for(n));
+        }
+        void shrink_to_fit() {
+            if (__words_for(size_) < capacity_) reallocate(__words_for(size_));
+        }
+
+        void resize(size_type n, bool value = false) {
+            if (n > size_) {
+                grow_for(n);
+                const size_type old = size_;
+                size_ = n;
+                mystl::fill(begin() + static_cast<difference_type>(old), end(), value);
+            } else {
+                truncate(n);
+            }
+        }
+
+    public: // 元素访问
+        reference operator[](size_type n) noexcept {
+            return reference(words_ + n / __word_bits, __bit_word(1) << (n % __word_bits));
+        }
+        const_reference operator[](size_type n) const noexcept { return (words_[n / __word_bits] >> (n % __word_bits)) & 1; }
+        reference front() noexcept { return (*this)[0]; }
+        const_reference front() const noexcept { return (*this)[0]; }
+        reference back() noexcept { return (*this)[size_ - 1]; }
+        const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+        // 底层的字数组，共 (size() + 63) / 64 个字
+        const __bit_word* word_data() const noexcept { return words_; }
+
+    public: // 插入与删除
+        void push_back(bool value) {
+            grow_for(size_ + 1);
+            ++size_;
+            back() = value;
+        }
+        void pop_back() noexcept {
+            truncate(size_ - 1);
+        }
+
+        iterator insert(iterator pos, bool value) {
+            const difference_type n = pos - begin();
+            push_back(false);
+            pos = begin() + n;
+            mystl::copy_backward(pos, end() - 1, end());
+            *pos = value;
+            return pos;
+        }
+        void insert(iterator pos, size_type count, bool value) {
+            const difference_type n = pos - begin();
+            const size_type old = size_;
+            resize(size_ + count);
+            pos = begin() + n;
+            mystl::copy_backward(pos, begin() + static_cast<difference_type>(old), end());
+            mystl::fill(pos, pos + static_cast<difference_type>(count), value);
+        }
+
+        iterator erase(iterator first, iterator last) {
+            iterator new_end = mystl::copy(last, end(), first);
+            truncate(static_cast<size_type>(new_end - begin()));
+            return first;
+        }
+        iterator erase(iterator pos) { return erase(pos, pos + 1); }
+        void clear() noexcept { erase(begin(), end()); }
+
+        void swap(vector& rhs) noexcept {
+            mystl::swap(words_, rhs.words_);
+            mystl::swap(size_, rhs.size_);
+            mystl::swap(capacity_, rhs.capacity_);
+        }
+        static void swap(reference x, reference y) noexcept { mystl::swap(x, y); }
+
+    public: // 整体的位运算，逐字进行；二元运算要求两侧 size() 相同
+        void flip() noexcept {
+            const size_type n = __words_for(size_);
+            for (size_type i = 0; i < n; ++i) words_[i] = ~words_[i];
+            clear_tail();
+        }
+
+        vector& operator&=(const vector& rhs) noexcept {
+            const size_type n = __words_for(size_);
+            for (size_type i = 0; i < n; ++i) words_[i] &= rhs.words_[i];
+            return *this;
+        }
+        vector& operator|=(const vector& rhs) noexcept {
+            const size_type n = __words_for(size_);
+            for (size_type i = 0; i < n; ++i) words_[i] |= rhs.words_[i];
+            return *this;
+        }
+        vector& operator^=(const vector& rhs) noexcept {
+            const size_type n = __words_for(size_);
+            for (size_type i = 0; i < n; ++i) words_[i] ^= rhs.words_[i];
+            return *this;
+        }
+
+        friend vector operator~(const vector& x) { vector result(x); result.flip(); return result; }
+        friend vector operator&(const vector& x, const vector& y) { vector result(x); result &= y; return result; }
+        friend vector operator|(const vector& x, const vector& y) { vector result(x); result |= y; return result; }
+        friend vector operator^(const vector& x, const vector& y) { vector result(x); result ^= y; return result; }
+
+    public: // 比较
+        bool operator==(const vector& rhs) const noexcept {
+            return size_ == rhs.size_ && (size_ == 0 || std::memcmp(words_, rhs.words_, __words_for(size_) * sizeof(__bit_word)) == 0);
+        }
+        bool operator!=(const vector& rhs) const noexcept { return !(*this == rhs); }
+    };
+
+} // namespace mystl
@@ -31,7 +31,7 @@ namespace mystl {
     // 跨traits
     template<class ForwardIterator>
     inline void destroy(ForwardIterator beg, ForwardIterator end) {
-        using is_POD_type = typename type_traits<ForwardIterator>::is_POD_type;
+        using is_POD_type = typename type_traits<value_type_t<ForwardIterator>>::is_POD_type;
         _destroy_aux(beg, end, is_POD_type());
     }
 
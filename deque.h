@@ -269,8 +269,8 @@ namespace mystl {
         using const_reverse_iterator = __reverse_iterator<const_iterator>;
     private:
         using map_pointer = pointer *;                      // 中控数组指针
-        using node_allocator = simpleAlloc<value_type>;     // 缓存区空间构造器
-        using map_allocator = simpleAlloc<pointer>;         // 中控数组空间构造器
+        using node_allocator = typename __rebind_alloc<Alloc, value_type>::type;    // 缓存区空间构造器
+        using map_allocator = typename __rebind_alloc<Alloc, pointer>::type;        // 中控数组空间构造器
 
     private:
         iterator begin_;                                     // 第一个节点（缓存区）
@@ -299,8 +299,8 @@ namespace mystl {
        
         // reallocate
         void        require_capacity(size_type n, bool front);
-        void        reallocate_map_at_front(size_type need);
-        void        reallocate_map_at_back(size_type need);
+        void        reallocate_map(size_type need, bool front);
+        void        release_spare_nodes() noexcept;
     
     private: // aux_interface for ctor
         size_type initial_map_size() const noexcept {return 8U; }
@@ -382,7 +382,7 @@ namespace mystl {
             rhs.map_ = nullptr;
             rhs.map_size_ = 0;
         }
-        deque &operator=(deque&& rhs); 
+        deque &operator=(deque&& rhs) noexcept;
     
     public:// getter
         const_iterator begin() const noexcept { return begin_; }
@@ -431,6 +431,15 @@ namespace mystl {
         void     push_front(value_type&& value) { emplace_front(mystl::move(value)); }
         void     push_back(value_type&& value)  { emplace_back(mystl::move(value)); }
 
+    public:// 两端批量弹出，要求 n <= size()；按缓冲区分段析构，清空的缓冲区一次释放
+        void pop_front_n(size_type n);
+        void pop_back_n(size_type n);
+        // 先把元素按弹出顺序移动到 out 再弹出，返回写入后的 out
+        template<class OutputIterator>
+        OutputIterator pop_front_n(size_type n, OutputIterator out);
+        template<class OutputIterator>
+        OutputIterator pop_back_n(size_type n, OutputIterator out);
+
     private:// aux_interface for assign
         void fill_assign(size_type, const value_type &);
         template<class Integer>
@@ -481,6 +490,18 @@ namespace mystl {
         template <class FIter>
         void        insert_dispatch(iterator, FIter, FIter, forward_iterator_tag);
 
+    private: // aux_interface for append_range / prepend_range
+        template <class FIter>
+        void        segment_copy(iterator, FIter, size_type);
+        template <class IIter>
+        void        append_dispatch(IIter, IIter, input_iterator_tag);
+        template <class FIter>
+        void        append_dispatch(FIter, FIter, forward_iterator_tag);
+        template <class IIter>
+        void        prepend_dispatch(IIter, IIter, input_iterator_tag);
+        template <class FIter>
+        void        prepend_dispatch(FIter, FIter, forward_iterator_tag);
+
     public:// insert
         iterator insert(iterator, const value_type &);
         iterator insert(iterator, value_type &&);
@@ -491,6 +512,17 @@ namespace mystl {
             range_insert(pos, first, last, is_integral<InputIterator>());
         }
     
+    public:// 两端批量插入，空间一次备齐，再按缓冲区分段构造
+        template<class InputIterator>
+        void append_range(InputIterator first, InputIterator last) {
+            append_dispatch(first, last, iterator_category_t<InputIterator>());
+        }
+        // 插入后 [first, last) 保持原有顺序位于头部
+        template<class InputIterator>
+        void prepend_range(InputIterator first, InputIterator last) {
+            prepend_dispatch(first, last, iterator_category_t<InputIterator>());
+        }
+
     public:// erase
         iterator erase(iterator);
         iterator erase(iterator, iterator);
@@ -529,15 +561,11 @@ namespace mystl {
 
     // 移动赋值运算符
     template <class T, class Alloc>
-    deque<T, Alloc>& deque<T, Alloc>::operator=(deque&& rhs)
+    deque<T, Alloc>& deque<T, Alloc>::operator=(deque&& rhs) noexcept
     {
-        clear();
-        begin_ = mystl::move(rhs.begin_);
-        end_ = mystl::move(rhs.end_);
-        map_ = rhs.map_;
-        map_size_ = rhs.map_size_;
-        rhs.map_ = nullptr;
-        rhs.map_size_ = 0;
+        // 原有的元素和空间交给临时对象释放
+        deque temp(mystl::move(rhs));
+        swap(temp);
         return *this;
     }
 
@@ -546,7 +574,10 @@ namespace mystl {
     void deque<T, Alloc>::create_nodes(map_pointer nstart, map_pointer nfinish) {
         map_pointer cur;
         try {
-            for (cur = nstart; cur <= nfinish; ++cur) * cur = allocate_node();
+            // 已有缓冲区（erase 后留下的备用缓冲区）直接复用
+            for (cur = nstart; cur <= nfinish; ++cur) {
+                if (*cur == nullptr) *cur = allocate_node();
+            }
         } catch (std::exception &) {
             destroy_nodes(nstart, cur);
             throw;
@@ -656,59 +687,49 @@ namespace mystl {
 
     // ----------------------------空间分配模块----------------------------------------
 
-    // reallocate_map_at_front 函数
-    template <class T, class Alloc>
-    void deque<T, Alloc>::reallocate_map_at_front(size_type need_buffer)
-    {
-        const size_type new_map_size = mystl::max(map_size_ << 1,
-                                                    map_size_ + need_buffer + DEQUE_MAP_INIT_SIZE);
-        map_pointer new_map = create_map(new_map_size);
-        const size_type old_buffer = end_.node - begin_.node + 1;
-        const size_type new_buffer = old_buffer + need_buffer;
-
-        // 另新的 map 中的指针指向原来的 buffer，并开辟新的 buffer
-        auto begin = new_map + (new_map_size - new_buffer) / 2;
-        auto mid = begin + need_buffer;
-        auto end = mid + old_buffer;
-        create_nodes(begin, mid - 1);
-        for (auto begin1 = mid, begin2 = begin_.node; begin1 != end; ++begin1, ++begin2)
-            *begin1 = *begin2;
-
-        // 更新数据
-        map_allocator::deallocate(map_, map_size_);
-        map_ = new_map;
-        map_size_ = new_map_size;
-        begin_ = iterator(*mid + (begin_.cur - begin_.first), mid);
-        end_ = iterator(*(end - 1) + (end_.cur - end_.first), end - 1);
-    }
-
-    // reallocate_map_at_back 函数
+    // 中控数组在 front 一侧不足 need_buffer 个空槽时调用，返回后该侧至少有 need_buffer 个空槽
+    // 已用的节点不超过中控数组的一半时就地平移到中央（SGI reallocate_map 的做法），否则按倍增分配新的中控数组，
+    // 使两端交替或单向滑动（尾进头出）的负载下中控数组不会无限增长，均摊 O(1)
     template <class T, class Alloc>
-    void deque<T, Alloc>::reallocate_map_at_back(size_type need_buffer)
+    void deque<T, Alloc>::reallocate_map(size_type need_buffer, bool front)
     {
-        const size_type new_map_size = mystl::max(map_size_ << 1,
-                                                    map_size_ + need_buffer + DEQUE_MAP_INIT_SIZE);
-        map_pointer new_map = create_map(new_map_size);
         const size_type old_buffer = end_.node - begin_.node + 1;
         const size_type new_buffer = old_buffer + need_buffer;
+        const difference_type begin_off = begin_.cur - begin_.first;
+        const difference_type end_off = end_.cur - end_.first;
 
-        // 另新的 map 中的指针指向原来的 buffer，并开辟新的 buffer
-        auto begin = new_map + ((new_map_size - new_buffer) / 2);
-        auto mid = begin + old_buffer;
-        auto end = mid + need_buffer;
-        for (auto begin1 = begin, begin2 = begin_.node; begin1 != mid; ++begin1, ++begin2)
-            *begin1 = *begin2;
-        create_nodes(mid, end - 1);
+        map_pointer new_nstart;
+        if (map_size_ > 2 * new_buffer)
+        {
+            // 备用缓冲区的槽位会被覆盖，先释放
+            release_spare_nodes();
+            new_nstart = map_ + (map_size_ - new_buffer) / 2 + (front ? need_buffer : 0);
+            if (new_nstart < begin_.node)
+                mystl::copy(begin_.node, end_.node + 1, new_nstart);
+            else
+                mystl::copy_backward(begin_.node, end_.node + 1, new_nstart + old_buffer);
+            for (auto cur = map_; cur < new_nstart; ++cur) *cur = nullptr;
+            for (auto cur = new_nstart + old_buffer; cur < map_ + map_size_; ++cur) *cur = nullptr;
+        }
+        else
+        {
+            const size_type new_map_size = mystl::max(map_size_ << 1,
+                                                      map_size_ + need_buffer + DEQUE_MAP_INIT_SIZE);
+            map_pointer new_map = create_map(new_map_size);
+            release_spare_nodes();
+            new_nstart = new_map + (new_map_size - new_buffer) / 2 + (front ? need_buffer : 0);
+            mystl::copy(begin_.node, end_.node + 1, new_nstart);
+            map_allocator::deallocate(map_, map_size_);
+            map_ = new_map;
+            map_size_ = new_map_size;
+        }
 
-        // 更新数据
-        map_allocator::deallocate(map_, map_size_);
-        map_ = new_map;
-        map_size_ = new_map_size;
-        begin_ = iterator(*begin + (begin_.cur - begin_.first), begin);
-        end_ = iterator(*(mid - 1) + (end_.cur - end_.first), mid - 1);
+        begin_.set_node(new_nstart);
+        begin_.cur = begin_.first + begin_off;
+        end_.set_node(new_nstart + old_buffer - 1);
+        end_.cur = end_.first + end_off;
     }
 
-
     // require_capacity 函数
     template <class T, class Alloc>
     void deque<T, Alloc>::require_capacity(size_type n, bool front)
@@ -717,24 +738,36 @@ namespace mystl {
         {
             const size_type need_buffer = (n - (begin_.cur - begin_.first)) / buffer_size() + 1;
             if (need_buffer > static_cast<size_type>(begin_.node - map_))
-            {
-                reallocate_map_at_front(need_buffer);
-                return;
-            }
+                reallocate_map(need_buffer, true);
             create_nodes(begin_.node - need_buffer, begin_.node - 1);
         }
         else if (!front && (static_cast<size_type>(end_.last - end_.cur - 1) < n))
         {
             const size_type need_buffer = (n - (end_.last - end_.cur - 1)) / buffer_size() + 1;
             if (need_buffer > static_cast<size_type>((map_ + map_size_) - end_.node - 1))
-            {
-                reallocate_map_at_back(need_buffer);
-                return;
-            }
+                reallocate_map(need_buffer, false);
             create_nodes(end_.node + 1, end_.node + need_buffer);
         }
     }
 
+    // 释放 [begin_.node, end_.node] 之外的备用缓冲区
+    template <class T, class Alloc>
+    void deque<T, Alloc>::release_spare_nodes() noexcept
+    {
+        for (auto cur = map_; cur < begin_.node; ++cur)
+        {
+            if (*cur == nullptr) continue;
+            deallocate_node(*cur);
+            *cur = nullptr;
+        }
+        for (auto cur = end_.node + 1; cur < map_ + map_size_; ++cur)
+        {
+            if (*cur == nullptr) continue;
+            deallocate_node(*cur);
+            *cur = nullptr;
+        }
+    }
+
     // ------------------------------空间分配模块----------------------------------------
     
 
@@ -753,6 +786,7 @@ namespace mystl {
         else {
             require_capacity(1, true);
             try {
+                --begin_;
                 construct(begin_.cur, value);
             } catch(...)
             {
@@ -813,6 +847,88 @@ namespace mystl {
     }
 
 
+    // 从头部弹出 n 个元素
+    template <class T, class Alloc>
+    void deque<T, Alloc>::pop_front_n(size_type n)
+    {
+        if (n == 0) return;
+        const iterator new_begin = begin_ + static_cast<difference_type>(n);
+        if (begin_.node == new_begin.node)
+        {
+            mystl::destroy(begin_.cur, new_begin.cur);
+        }
+        else
+        {
+            mystl::destroy(begin_.cur, begin_.last);
+            for (map_pointer cur = begin_.node + 1; cur < new_begin.node; ++cur)
+                mystl::destroy(*cur, *cur + buffer_size());
+            mystl::destroy(new_begin.first, new_begin.cur);
+            destroy_nodes(begin_.node, new_begin.node - 1);
+        }
+        begin_ = new_begin;
+    }
+
+    // 从尾部弹出 n 个元素
+    template <class T, class Alloc>
+    void deque<T, Alloc>::pop_back_n(size_type n)
+    {
+        if (n == 0) return;
+        const iterator new_end = end_ - static_cast<difference_type>(n);
+        if (new_end.node == end_.node)
+        {
+            mystl::destroy(new_end.cur, end_.cur);
+        }
+        else
+        {
+            mystl::destroy(new_end.cur, new_end.last);
+            for (map_pointer cur = new_end.node + 1; cur < end_.node; ++cur)
+                mystl::destroy(*cur, *cur + buffer_size());
+            mystl::destroy(end_.first, end_.cur);
+            destroy_nodes(new_end.node + 1, end_.node);
+        }
+        end_ = new_end;
+    }
+
+    // 每个缓冲区内的一段调用一次 mystl::move
+    template <class T, class Alloc>
+    template <class OutputIterator>
+    OutputIterator deque<T, Alloc>::pop_front_n(size_type n, OutputIterator out)
+    {
+        iterator cur = begin_;
+        for (size_type left = n; left > 0;)
+        {
+            const size_type len = mystl::min(left, static_cast<size_type>(cur.last - cur.cur));
+            out = mystl::move(cur.cur, cur.cur + len, out);
+            left -= len;
+            cur += static_cast<difference_type>(len);
+        }
+        pop_front_n(n);
+        return out;
+    }
+
+    // 从尾部起逆序写出，与逐个 back()、pop_back() 的顺序相同
+    template <class T, class Alloc>
+    template <class OutputIterator>
+    OutputIterator deque<T, Alloc>::pop_back_n(size_type n, OutputIterator out)
+    {
+        iterator cur = end_;
+        for (size_type left = n; left > 0;)
+        {
+            if (cur.cur == cur.first)
+            {
+                cur.set_node(cur.node - 1);
+                cur.cur = cur.last;
+            }
+            const size_type len = mystl::min(left, static_cast<size_type>(cur.cur - cur.first));
+            for (value_type* const stop = cur.cur - len; cur.cur != stop; ++out)
+                *out = mystl::move(*--cur.cur);
+            left -= len;
+        }
+        pop_back_n(n);
+        return out;
+    }
+
+
 // -----------------------------------insert方法------------------------------------------
 
     // 在 position 处插入元素
@@ -898,12 +1014,12 @@ namespace mystl {
         const size_type elems_before = position - begin_;
         if (elems_before < (size() / 2))
         {
-            mystl::copy_backward(begin_, position, next);
+            mystl::move_backward(begin_, position, next);
             pop_front();
         }
         else
         {
-            mystl::copy(next, end_, position);
+            mystl::move(next, end_, position);
             pop_back();
         }
         return begin_ + elems_before;
@@ -915,6 +1031,8 @@ namespace mystl {
     typename deque<T, Alloc>::iterator
     deque<T, Alloc>::erase(iterator first, iterator last)
     {
+        // 空区间直接返回，否则下面的 move 会把元素移动赋值给自身
+        if (first == last) return first;
         if (first == begin_ && last == end_)
         {
             clear();
@@ -926,16 +1044,16 @@ namespace mystl {
             const size_type elems_before = first - begin_;
             if (elems_before < ((size() - len) / 2))
             {
-                mystl::copy_backward(begin_, first, last);
+                mystl::move_backward(begin_, first, last);
                 auto new_begin = begin_ + len;
-                destroy(begin_.cur, new_begin.cur);
+                mystl::destroy(begin_, new_begin);
                 begin_ = new_begin;
             }
             else
             {
-                mystl::copy(last, end_, first);
+                mystl::move(last, end_, first);
                 auto new_end = end_ - len;
-                destroy(new_end.cur, end_.cur);
+                mystl::destroy(new_end, end_);
                 end_ = new_end;
             }
             return begin_ + elems_before;
@@ -956,21 +1074,32 @@ namespace mystl {
     }
 
 
-    // 减小容器容量
+    // 减小容器容量：释放备用缓冲区，中控数组超过所需的 4 倍时换成较小的中控数组
     template <class T, class Alloc>
     void deque<T, Alloc>::shrink_to_fit() noexcept
     {
         // 至少会留下头部缓冲区
-        for (auto cur = map_; cur < begin_.node; ++cur)
-        {
-            deallocate_node(*cur);
-            *cur = nullptr;
-        }
-        for (auto cur = end_.node + 1; cur < map_ + map_size_; ++cur)
-        {
-            deallocate_node(*cur);
-            *cur = nullptr;
+        release_spare_nodes();
+        const size_type used = end_.node - begin_.node + 1;
+        const size_type new_map_size = mystl::max(initial_map_size(), used + 2);
+        if (map_size_ <= new_map_size * 4) return;
+        map_pointer new_map;
+        try {
+            new_map = create_map(new_map_size);
+        } catch (...) {
+            return;         // 分配失败时保持原样
         }
+        map_pointer new_nstart = new_map + (new_map_size - used) / 2;
+        mystl::copy(begin_.node, end_.node + 1, new_nstart);
+        const difference_type begin_off = begin_.cur - begin_.first;
+        const difference_type end_off = end_.cur - end_.first;
+        map_allocator::deallocate(map_, map_size_);
+        map_ = new_map;
+        map_size_ = new_map_size;
+        begin_.set_node(new_nstart);
+        begin_.cur = begin_.first + begin_off;
+        end_.set_node(new_nstart + used - 1);
+        end_.cur = end_.first + end_off;
     }
 
     // 清空 deque
@@ -980,7 +1109,7 @@ namespace mystl {
         // clear 会保留头部的缓冲区
         for (map_pointer cur = begin_.node + 1; cur < end_.node; ++cur)
         {
-            destroy(*cur, *cur + buffer_size());
+            mystl::destroy(*cur, *cur + buffer_size());
         }
         if (begin_.node != end_.node)
         { // 有两个以上的缓冲区
@@ -991,8 +1120,8 @@ namespace mystl {
         {
             mystl::destroy(begin_.cur, end_.cur);
         }
+        end_ = begin_;      // 先收拢到头部缓冲区，其余缓冲区由 shrink_to_fit 释放
         shrink_to_fit();
-        end_ = begin_;
     }
 
 
@@ -1164,7 +1293,7 @@ namespace mystl {
         value_type value_copy = value_type(mystl::forward<Args>(args)...);
         if (elems_before < (size() / 2))
         { // 在前半段插入
-            emplace_front(front());
+            emplace_front(mystl::move(front()));
             auto front1 = begin_;
             ++front1;
             auto front2 = front1;
@@ -1172,17 +1301,17 @@ namespace mystl {
             position = begin_ + elems_before;
             auto pos = position;
             ++pos;
-            mystl::copy(front2, pos, front1);
+            mystl::move(front2, pos, front1);
         }
         else
         { // 在后半段插入
-            emplace_back(back());
+            emplace_back(mystl::move(back()));
             auto back1 = end_;
             --back1;
             auto back2 = back1;
             --back2;
             position = begin_ + elems_before;
-            mystl::copy_backward(position, back2, back1);
+            mystl::move_backward(position, back2, back1);
         }
         *position = mystl::move(value_copy);
         return position;
@@ -1209,15 +1338,15 @@ namespace mystl {
         if (elems_before >= n)
         {
             auto begin_n = begin_ + n;
-            mystl::uninitialized_copy(begin_, begin_n, new_begin);
+            mystl::uninitialized_move_if_noexcept(begin_, begin_n, new_begin);
             begin_ = new_begin;
-            mystl::copy(begin_n, position, old_begin);
+            mystl::move(begin_n, position, old_begin);
             mystl::fill(position - n, position, value_copy);
         }
         else
         {
             mystl::uninitialized_fill(
-            mystl::uninitialized_copy(begin_, position, new_begin), begin_, value_copy);
+            mystl::uninitialized_move_if_noexcept(begin_, position, new_begin), begin_, value_copy);
             begin_ = new_begin;
             mystl::fill(old_begin, position, value_copy);
         }
@@ -1242,15 +1371,15 @@ namespace mystl {
         if (elems_after > n)
         {
             auto end_n = end_ - n;
-            mystl::uninitialized_copy(end_n, end_, end_);
+            mystl::uninitialized_move_if_noexcept(end_n, end_, end_);
             end_ = new_end;
-            mystl::copy_backward(position, end_n, old_end);
+            mystl::move_backward(position, end_n, old_end);
             mystl::fill(position, position + n, value_copy);
         }
         else
         {
             mystl::uninitialized_fill(end_, position + n, value_copy);
-            mystl::uninitialized_copy(position, end_, position + n);
+            mystl::uninitialized_move_if_noexcept(position, end_, position + n);
             end_ = new_end;
             mystl::fill(position, old_end, value_copy);
         }
@@ -1285,9 +1414,9 @@ namespace mystl {
             if (elems_before >= n)
             {
                 auto begin_n = begin_ + n;
-                mystl::uninitialized_copy(begin_, begin_n, new_begin);
+                mystl::uninitialized_move_if_noexcept(begin_, begin_n, new_begin);
                 begin_ = new_begin;
-                mystl::copy(begin_n, position, old_begin);
+                mystl::move(begin_n, position, old_begin);
                 mystl::copy(first, last, position - n);
             }
             else
@@ -1295,7 +1424,7 @@ namespace mystl {
                 auto mid = first;
                 mystl::advance(mid, n - elems_before);
                 mystl::uninitialized_copy(first, mid,
-                                        mystl::uninitialized_copy(begin_, position, new_begin));
+                                        mystl::uninitialized_move_if_noexcept(begin_, position, new_begin));
                 begin_ = new_begin;
                 mystl::copy(mid, last, old_begin);
             }
@@ -1320,17 +1449,17 @@ namespace mystl {
             if (elems_after > n)
             {
                 auto end_n = end_ - n;
-                mystl::uninitialized_copy(end_n, end_, end_);
+                mystl::uninitialized_move_if_noexcept(end_n, end_, end_);
                 end_ = new_end;
-                mystl::copy_backward(position, end_n, old_end);
+                mystl::move_backward(position, end_n, old_end);
                 mystl::copy(first, last, position);
             }
             else
             {
                 auto mid = first;
                 mystl::advance(mid, elems_after);
-                mystl::uninitialized_copy(position, end_,
-                                        mystl::uninitialized_copy(mid, last, end_));
+                mystl::uninitialized_move_if_noexcept(position, end_,
+                                                      mystl::uninitialized_copy(mid, last, end_));
                 end_ = new_end;
                 mystl::copy(first, mid, position);
             }
@@ -1377,45 +1506,105 @@ namespace mystl {
     insert_dispatch(iterator position, FIter first, FIter last, forward_iterator_tag)
     {
         if (last <= first)  return;
-        const size_type n = mystl::distance(first, last);
         if (position.cur == begin_.cur)
         {
-            require_capacity(n, true);
-            auto new_begin = begin_ - n;
-            try
-            {
-            mystl::uninitialized_copy(first, last, new_begin);
-            begin_ = new_begin;
-            }
-            catch (...)
-            {
-            if(new_begin.node != begin_.node)
-                destroy_nodes(new_begin.node, begin_.node - 1);
-            throw;
-            }
+            prepend_dispatch(first, last, forward_iterator_tag{});
+            return;
         }
         else if (position.cur == end_.cur)
         {
-            require_capacity(n, false);
-            auto new_end = end_ + n;
-            try
+            append_dispatch(first, last, forward_iterator_tag{});
+            return;
+        }
+        copy_insert(position, first, last, mystl::distance(first, last));
+    }
+
+    // 把从 first 起的 n 个元素构造到 pos 起的未初始化空间：每个缓冲区内的一段调用一次 uninitialized_copy，
+    // 元素可平凡复制且来源是指针时整段 memmove
+    template <class T, class Alloc>
+    template <class FIter>
+    void deque<T, Alloc>::segment_copy(iterator pos, FIter first, size_type n)
+    {
+        iterator cur = pos;
+        try
+        {
+            while (n > 0)
             {
-            mystl::uninitialized_copy(first, last, end_);
-            end_ = new_end;
+                const size_type len = mystl::min(n, static_cast<size_type>(cur.last - cur.cur));
+                FIter mid = first;
+                mystl::advance(mid, len);
+                mystl::uninitialized_copy(first, mid, cur.cur);
+                first = mid;
+                n -= len;
+                cur += static_cast<difference_type>(len);
             }
-            catch (...)
-            {
-            if(new_end.node != end_.node)
-                destroy_nodes(end_.node + 1, new_end.node);
+        }
+        catch (...)
+        {
+            mystl::destroy(pos, cur);
             throw;
-            }
         }
-        else
+    }
+
+    template <class T, class Alloc>
+    template <class IIter>
+    void deque<T, Alloc>::append_dispatch(IIter first, IIter last, input_iterator_tag)
+    {
+        size_type n = 0;
+        try
+        {
+            for (; first != last; ++first, ++n)
+                emplace_back(*first);
+        }
+        catch (...)
         {
-            copy_insert(position, first, last, n);
+            for (; n > 0; --n) pop_back();
+            throw;
         }
     }
 
+    template <class T, class Alloc>
+    template <class FIter>
+    void deque<T, Alloc>::append_dispatch(FIter first, FIter last, forward_iterator_tag)
+    {
+        const size_type n = mystl::distance(first, last);
+        if (n == 0) return;
+        require_capacity(n, false);
+        segment_copy(end_, first, n);
+        end_ += static_cast<difference_type>(n);
+    }
+
+    // 逐个压入头部后整段翻转，恢复原有顺序
+    template <class T, class Alloc>
+    template <class IIter>
+    void deque<T, Alloc>::prepend_dispatch(IIter first, IIter last, input_iterator_tag)
+    {
+        size_type n = 0;
+        try
+        {
+            for (; first != last; ++first, ++n)
+                emplace_front(*first);
+        }
+        catch (...)
+        {
+            for (; n > 0; --n) pop_front();
+            throw;
+        }
+        mystl::reverse(begin_, begin_ + static_cast<difference_type>(n));
+    }
+
+    template <class T, class Alloc>
+    template <class FIter>
+    void deque<T, Alloc>::prepend_dispatch(FIter first, FIter last, forward_iterator_tag)
+    {
+        const size_type n = mystl::distance(first, last);
+        if (n == 0) return;
+        require_capacity(n, true);
+        iterator new_begin = begin_ - static_cast<difference_type>(n);
+        segment_copy(new_begin, first, n);
+        begin_ = new_begin;
+    }
+
 
     // 重载比较操作符
     template <class T>
@@ -1463,4 +1652,4 @@ namespace mystl {
         lhs.swap(rhs);
     }
 
-} // namespace mystl
\ No newline at end of file
+} // namespace mystl
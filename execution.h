@@ -0,0 +1,348 @@
+#pragma once
+
+#include "iterator.h"
+#include "algobase.h"
+#include "type_traits.h"
+#include "algorithm.h"
+#include "numeric.h"
+#include "thread_pool.h"
+#include "deque.h"
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+// 执行策略与并行算法
+// execution::seq 串行执行；execution::par 在 thread_pool 上执行，par.on(pool) 可指定线程池。
+// 并行版本把区间切成约 __par_chunk_bytes 字节的块交给线程池，块内仍是串行算法；
+// 迭代器不是随机访问、区间不足一块或线程池只有一个执行者时直接退回串行版本。
+// 与标准库相同，par 下的函数对象会被并发调用，reduce / inclusive_scan 的 op 须满足结合律
+namespace mystl {
+    namespace execution {
+        class sequenced_policy {};
+
+        class parallel_policy {
+        private:
+            thread_pool* pool_ = nullptr;
+
+        public:
+            constexpr parallel_policy() noexcept = default;
+            constexpr explicit parallel_policy(thread_pool& pool) noexcept : pool_(&pool) {}
+
+            parallel_policy on(thread_pool& pool) const noexcept { return parallel_policy(pool); }
+            thread_pool& pool() const { return pool_ ? *pool_ : thread_pool::default_pool(); }
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+    }
+
+    template<class T>
+    struct is_execution_policy : false_type {};
+
+    template<>
+    struct is_execution_policy<execution::sequenced_policy> : true_type {};
+
+    template<>
+    struct is_execution_policy<execution::parallel_policy> : true_type {};
+
+    template<class Policy, class T>
+    using __enable_if_policy_t = enable_if_t<is_execution_policy<typename std::decay<Policy>::type>::value, T>;
+
+    template<class Policy>
+    constexpr bool __is_parallel_policy_v = is_same<typename std::decay<Policy>::type, execution::parallel_policy>::value;
+
+    template<class... Iters>
+    constexpr bool __all_random_access_v =
+        (is_same<iterator_category_t<Iters>, random_access_iterator_tag>::value && ...);
+
+    // 每块的大小，取 L2 缓存的一部分，使块内的读写都在缓存中完成
+    constexpr size_t __par_chunk_bytes = 64 * 1024;
+
+    template<class T>
+    inline size_t __par_grain() {
+        return sizeof(T) >= __par_chunk_bytes ? 1 : __par_chunk_bytes / sizeof(T);
+    }
+
+    // 返回并行执行所用的线程池，不值得并行时返回 nullptr
+    template<class Policy>
+    inline thread_pool* __par_pool(const Policy& policy, ptrdiff_t n, size_t grain) {
+        if (n <= static_cast<ptrdiff_t>(grain)) return nullptr;
+        thread_pool& pool = policy.pool();
+        return pool.concurrency() > 1 ? &pool : nullptr;
+    }
+
+    // 块内按连续段处理：deque 的块可能跨越缓冲区，拆成若干指针区间，避免逐元素的边界判断
+    template<class RandomIter, class Function>
+    inline void __for_each_segment(RandomIter first, RandomIter last, Function f) {
+        f(first, last);
+    }
+
+    template<class T, class Function>
+    inline void __for_each_segment(__deque_iterator<T, T&, T*> first, __deque_iterator<T, T&, T*> last, Function f) {
+        mystl::__deque_for_each_segment(first, last, f);
+    }
+}
+
+
+// for_each、transform、copy、fill
+namespace mystl {
+    template<class Policy, class ForwardIter, class Function>
+    __enable_if_policy_t<Policy, void> for_each(Policy&& policy, ForwardIter first, ForwardIter last, Function f) {
+        if constexpr (__is_parallel_policy_v<Policy> && __all_random_access_v<ForwardIter>) {
+            const ptrdiff_t n = last - first;
+            if (thread_pool* pool = mystl::__par_pool(policy, n, __par_grain<value_type_t<ForwardIter>>())) {
+                pool->parallel_for(0, n, __par_grain<value_type_t<ForwardIter>>(), [&](size_t b, size_t e) {
+                    mystl::__for_each_segment(first + b, first + e, [&](auto s, auto t) {
+                        for (; s != t; ++s) f(*s);
+                    });
+                });
+                return;
+            }
+        }
+        mystl::for_each(first, last, f);
+    }
+
+    template<class Policy, class ForwardIter1, class ForwardIter2, class UnaryOperation>
+    __enable_if_policy_t<Policy, ForwardIter2> transform(Policy&& policy, ForwardIter1 first, ForwardIter1 last,
+                                                         ForwardIter2 result, UnaryOperation op) {
+        if constexpr (__is_parallel_policy_v<Policy> && __all_random_access_v<ForwardIter1, ForwardIter2>) {
+            const ptrdiff_t n = last - first;
+            if (thread_pool* pool = mystl::__par_pool(policy, n, __par_grain<value_type_t<ForwardIter1>>())) {
+                pool->parallel_for(0, n, __par_grain<value_type_t<ForwardIter1>>(), [&](size_t b, size_t e) {
+                    mystl::transform(first + b, first + e, result + b, op);
+                });
+                return result + n;
+            }
+        }
+        return mystl::transform(first, last, result, op);
+    }
+
+    template<class Policy, class ForwardIter1, class ForwardIter2, class ForwardIter3, class BinaryOperation>
+    __enable_if_policy_t<Policy, ForwardIter3> transform(Policy&& policy, ForwardIter1 first1, ForwardIter1 last1,
+                                                         ForwardIter2 first2, ForwardIter3 result, BinaryOperation op) {
+        if constexpr (__is_parallel_policy_v<Policy> &&
+                      __all_random_access_v<ForwardIter1, ForwardIter2, ForwardIter3>) {
+            const ptrdiff_t n = last1 - first1;
+            if (thread_pool* pool = mystl::__par_pool(policy, n, __par_grain<value_type_t<ForwardIter1>>())) {
+                pool->parallel_for(0, n, __par_grain<value_type_t<ForwardIter1>>(), [&](size_t b, size_t e) {
+                    mystl::transform(first1 + b, first1 + e, first2 + b, result + b, op);
+                });
+                return result + n;
+            }
+        }
+        return mystl::transform(first1, last1, first2, result, op);
+    }
+
+    template<class Policy, class ForwardIter1, class ForwardIter2>
+    __enable_if_policy_t<Policy, ForwardIter2> copy(Policy&& policy, ForwardIter1 first, ForwardIter1 last,
+                                                    ForwardIter2 result) {
+        if constexpr (__is_parallel_policy_v<Policy> && __all_random_access_v<ForwardIter1, ForwardIter2>) {
+            const ptrdiff_t n = last - first;
+            if (thread_pool* pool = mystl::__par_pool(policy, n, __par_grain<value_type_t<ForwardIter1>>())) {
+                pool->parallel_for(0, n, __par_grain<value_type_t<ForwardIter1>>(), [&](size_t b, size_t e) {
+                    mystl::copy(first + b, first + e, result + b);
+                });
+                return result + n;
+            }
+        }
+        return mystl::copy(first, last, result);
+    }
+
+    template<class Policy, class ForwardIter, class T>
+    __enable_if_policy_t<Policy, void> fill(Policy&& policy, ForwardIter first, ForwardIter last, const T& value) {
+        if constexpr (__is_parallel_policy_v<Policy> && __all_random_access_v<ForwardIter>) {
+            const ptrdiff_t n = last - first;
+            if (thread_pool* pool = mystl::__par_pool(policy, n, __par_grain<value_type_t<ForwardIter>>())) {
+                pool->parallel_for(0, n, __par_grain<value_type_t<ForwardIter>>(), [&](size_t b, size_t e) {
+                    mystl::__for_each_segment(first + b, first + e, [&](auto s, auto t) { mystl::fill(s, t, value); });
+                });
+                return;
+            }
+        }
+        mystl::fill(first, last, value);
+    }
+}
+
+
+// reduce、inclusive_scan
+// reduce 二分递归求和，各块以块首元素为初值，init 只在最后参与一次；
+// inclusive_scan 分三步：并行求各块之和，串行求块前缀，再并行对各块带前缀扫描
+namespace mystl {
+    template<class RandomIter, class T, class BinaryOperation>
+    T __par_reduce(thread_pool& pool, RandomIter first, RandomIter last, size_t grain, BinaryOperation& op) {
+        if (static_cast<size_t>(last - first) <= grain) {
+            T acc = *first;
+            for (++first; first != last; ++first) acc = op(mystl::move(acc), *first);
+            return acc;
+        }
+        RandomIter mid = first + (last - first) / 2;
+        std::optional<T> left, right;
+        pool.invoke([&] { left.emplace(mystl::__par_reduce<RandomIter, T>(pool, first, mid, grain, op)); },
+                    [&] { right.emplace(mystl::__par_reduce<RandomIter, T>(pool, mid, last, grain, op)); });
+        return op(mystl::move(*left), mystl::move(*right));
+    }
+
+    template<class Policy, class ForwardIter, class T, class BinaryOperation>
+    __enable_if_policy_t<Policy, T> reduce(Policy&& policy, ForwardIter first, ForwardIter last, T init,
+                                           BinaryOperation op) {
+        if constexpr (__is_parallel_policy_v<Policy> && __all_random_access_v<ForwardIter>) {
+            const ptrdiff_t n = last - first;
+            const size_t grain = __par_grain<value_type_t<ForwardIter>>();
+            if (thread_pool* pool = mystl::__par_pool(policy, n, grain)) {
+                return op(mystl::move(init), mystl::__par_reduce<ForwardIter, T>(*pool, first, last, grain, op));
+            }
+        }
+        return mystl::reduce(first, last, mystl::move(init), op);
+    }
+
+    template<class Policy, class ForwardIter, class T>
+    inline __enable_if_policy_t<Policy, T> reduce(Policy&& policy, ForwardIter first, ForwardIter last, T init) {
+        return mystl::reduce(policy, first, last, mystl::move(init), mystl::plus<void>());
+    }
+
+    template<class Policy, class ForwardIter>
+    inline __enable_if_policy_t<Policy, value_type_t<ForwardIter>> reduce(Policy&& policy, ForwardIter first,
+                                                                          ForwardIter last) {
+        return mystl::reduce(policy, first, last, value_type_t<ForwardIter>());
+    }
+
+    // init 为空时首块不带前缀，T 即为元素类型
+    template<class RandomIter1, class RandomIter2, class BinaryOperation, class T>
+    RandomIter2 __par_inclusive_scan(thread_pool& pool, RandomIter1 first, RandomIter1 last, RandomIter2 result,
+                                     size_t grain, BinaryOperation& op, std::optional<T> init) {
+        const size_t n = static_cast<size_t>(last - first);
+        const size_t blocks = (n + grain - 1) / grain;
+        std::vector<std::optional<T>> prefix(blocks);
+
+        // 各块之和，最后一块不需要
+        pool.parallel_for(0, blocks - 1, 1, [&](size_t b, size_t e) {
+            for (size_t i = b; i < e; ++i) {
+                RandomIter1 cur = first + i * grain;
+                const RandomIter1 end = cur + grain;
+                T acc = *cur;
+                for (++cur; cur != end; ++cur) acc = op(mystl::move(acc), *cur);
+                prefix[i + 1].emplace(mystl::move(acc));
+            }
+        });
+        prefix[0] = mystl::move(init);
+        for (size_t i = 1; i < blocks; ++i) {
+            if (prefix[i - 1]) prefix[i] = op(*prefix[i - 1], mystl::move(*prefix[i]));
+        }
+
+        pool.parallel_for(0, blocks, 1, [&](size_t b, size_t e) {
+            for (size_t i = b; i < e; ++i) {
+                const size_t begin = i * grain, end = mystl::min(begin + grain, n);
+                if (prefix[i]) {
+                    mystl::inclusive_scan(first + begin, first + end, result + begin, op, *prefix[i]);
+                } else {
+                    mystl::inclusive_scan(first + begin, first + end, result + begin, op);
+                }
+            }
+        });
+        return result + n;
+    }
+
+    template<class Policy, class ForwardIter1, class ForwardIter2, class BinaryOperation, class T>
+    __enable_if_policy_t<Policy, ForwardIter2> inclusive_scan(Policy&& policy, ForwardIter1 first, ForwardIter1 last,
+                                                              ForwardIter2 result, BinaryOperation op, T init) {
+        if constexpr (__is_parallel_policy_v<Policy> && __all_random_access_v<ForwardIter1, ForwardIter2>) {
+            const ptrdiff_t n = last - first;
+            const size_t grain = __par_grain<value_type_t<ForwardIter1>>();
+            if (thread_pool* pool = mystl::__par_pool(policy, n, grain)) {
+                return mystl::__par_inclusive_scan(*pool, first, last, result, grain, op,
+                                                   std::optional<T>(mystl::move(init)));
+            }
+        }
+        return mystl::inclusive_scan(first, last, result, op, mystl::move(init));
+    }
+
+    template<class Policy, class ForwardIter1, class ForwardIter2, class BinaryOperation>
+    __enable_if_policy_t<Policy, ForwardIter2> inclusive_scan(Policy&& policy, ForwardIter1 first, ForwardIter1 last,
+                                                              ForwardIter2 result, BinaryOperation op) {
+        if constexpr (__is_parallel_policy_v<Policy> && __all_random_access_v<ForwardIter1, ForwardIter2>) {
+            const ptrdiff_t n = last - first;
+            const size_t grain = __par_grain<value_type_t<ForwardIter1>>();
+            if (thread_pool* pool = mystl::__par_pool(policy, n, grain)) {
+                return mystl::__par_inclusive_scan(*pool, first, last, result, grain, op,
+                                                   std::optional<value_type_t<ForwardIter1>>());
+            }
+        }
+        return mystl::inclusive_scan(first, last, result, op);
+    }
+
+    template<class Policy, class ForwardIter1, class ForwardIter2>
+    inline __enable_if_policy_t<Policy, ForwardIter2> inclusive_scan(Policy&& policy, ForwardIter1 first,
+                                                                     ForwardIter1 last, ForwardIter2 result) {
+        return mystl::inclusive_scan(policy, first, last, result, mystl::plus<void>());
+    }
+}
+
+
+// sort：并行快速排序
+// 划分后两侧作为 fork-join 任务递归，区间不超过一块或深度超限时交给串行的内省排序；
+// deque 与串行版本相同，先按段移到连续的临时区间再排序
+namespace mystl {
+    template<class RandomIter, class Compare>
+    void __par_sort_loop(thread_pool& pool, RandomIter first, RandomIter last, size_t leaf, ptrdiff_t depth_limit,
+                         Compare& comp) {
+        if (static_cast<size_t>(last - first) <= leaf || depth_limit == 0) {
+            mystl::__sort(first, last, comp);
+            return;
+        }
+        RandomIter cut = mystl::__unguarded_partition_pivot(first, last, comp);
+        pool.invoke([&] { mystl::__par_sort_loop(pool, first, cut, leaf, depth_limit - 1, comp); },
+                    [&] { mystl::__par_sort_loop(pool, cut, last, leaf, depth_limit - 1, comp); });
+    }
+
+    template<class RandomIter, class Compare>
+    void __par_sort_range(thread_pool& pool, RandomIter first, RandomIter last, Compare& comp) {
+        const ptrdiff_t n = last - first;
+        const size_t leaf = __par_grain<value_type_t<RandomIter>>();
+        if (n <= static_cast<ptrdiff_t>(leaf) || pool.concurrency() == 1) {
+            mystl::__sort(first, last, comp);
+            return;
+        }
+        mystl::__par_sort_loop(pool, first, last, leaf, mystl::__lg(n) * 2, comp);
+    }
+
+    struct __par_sort_fn {
+        thread_pool& pool;
+
+        template<class RandomIter, class Compare>
+        void operator()(RandomIter first, RandomIter last, Compare& comp) const {
+            mystl::__par_sort_range(pool, first, last, comp);
+        }
+    };
+
+    template<class RandomIter, class Compare>
+    inline void __par_sort(thread_pool& pool, RandomIter first, RandomIter last, Compare& comp) {
+        mystl::__par_sort_range(pool, first, last, comp);
+    }
+
+    template<class T, class Compare>
+    inline void __par_sort(thread_pool& pool, __deque_iterator<T, T&, T*> first, __deque_iterator<T, T&, T*> last,
+                           Compare& comp) {
+        if (static_cast<size_t>(last - first) <= __par_grain<T>() || pool.concurrency() == 1) {
+            mystl::sort(first, last, comp);
+            return;
+        }
+        mystl::__deque_segmented_sort(first, last, comp, __par_sort_fn{pool});
+    }
+
+    template<class Policy, class RandomIter, class Compare>
+    __enable_if_policy_t<Policy, void> sort(Policy&& policy, RandomIter first, RandomIter last, Compare comp) {
+        if constexpr (__is_parallel_policy_v<Policy>) {
+            mystl::__par_sort(policy.pool(), first, last, comp);
+        } else {
+            mystl::sort(first, last, comp);
+        }
+    }
+
+    template<class Policy, class RandomIter>
+    inline __enable_if_policy_t<Policy, void> sort(Policy&& policy, RandomIter first, RandomIter last) {
+        mystl::sort(policy, first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+
+} // namespace mystl
@@ -0,0 +1,338 @@
+#pragma once
+
+#include "flat_tree.h"
+#include "pair.h"
+#include "vector.h"
+
+#include <initializer_list>
+#include <stdexcept>
+
+// flat_map：键与值分别有序存放在两个 vector 中的映射
+// 键数组单独存放，二分查找只触及键，一个缓存行能容纳更多候选；找到下标后再访问值数组。
+// 解引用迭代器得到 pair<const Key&, T&> 代理而不是真实的 pair 对象。
+// 单个插入、删除需要移动其后的元素，插入和删除会使所有迭代器失效
+namespace mystl {
+
+    // operator-> 需要返回指针，代理对象是临时量，由它持有后再取地址
+    template<class Reference>
+    struct __flat_map_arrow {
+        Reference ref;
+        const Reference* operator->() const noexcept { return &ref; }
+    };
+
+    // Value 为 T 或 const T，分别对应 iterator 与 const_iterator
+    template<class Key, class T, class Value>
+    struct __flat_map_iterator {
+        using iterator = __flat_map_iterator<Key, T, T>;
+        using const_iterator = __flat_map_iterator<Key, T, const T>;
+        using self = __flat_map_iterator;
+
+        using iterator_category = random_access_iterator_tag;
+        using value_type = pair<Key, T>;
+        using reference = pair<const Key&, Value&>;
+        using pointer = __flat_map_arrow<reference>;
+        using difference_type = ptrdiff_t;
+
+        // 数据成员：键数组与值数组中同一下标的位置
+        const Key* key;
+        Value* value;
+
+        __flat_map_iterator() noexcept : key(nullptr), value(nullptr) {}
+        __flat_map_iterator(const Key* k, Value* v) noexcept : key(k), value(v) {}
+        __flat_map_iterator(const iterator& rhs) noexcept : key(rhs.key), value(rhs.value) {}
+
+        reference operator*() const noexcept { return reference(*key, *value); }
+        pointer operator->() const noexcept { return pointer{operator*()}; }
+        reference operator[](difference_type n) const noexcept { return reference(key[n], value[n]); }
+
+        self& operator++() noexcept { ++key; ++value; return *this; }
+        self operator++(int) noexcept { self temp = *this; ++*this; return temp; }
+        self& operator--() noexcept { --key; --value; return *this; }
+        self operator--(int) noexcept { self temp = *this; --*this; return temp; }
+        self& operator+=(difference_type n) noexcept { key += n; value += n; return *this; }
+        self& operator-=(difference_type n) noexcept { key -= n; value -= n; return *this; }
+        self operator+(difference_type n) const noexcept { return self(key + n, value + n); }
+        self operator-(difference_type n) const noexcept { return self(key - n, value - n); }
+        difference_type operator-(const self& rhs) const noexcept { return key - rhs.key; }
+
+        bool operator==(const self& rhs) const noexcept { return key == rhs.key; }
+        bool operator!=(const self& rhs) const noexcept { return key != rhs.key; }
+        bool operator<(const self& rhs) const noexcept { return key < rhs.key; }
+        bool operator>(const self& rhs) const noexcept { return key > rhs.key; }
+        bool operator<=(const self& rhs) const noexcept { return key <= rhs.key; }
+        bool operator>=(const self& rhs) const noexcept { return key >= rhs.key; }
+    };
+
+    template<class Key, class T, class Compare = mystl::less<Key>>
+    class flat_map {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = pair<Key, T>;
+        using key_compare = Compare;
+        using key_container_type = vector<Key>;
+        using mapped_container_type = vector<T>;
+        using iterator = __flat_map_iterator<Key, T, T>;
+        using const_iterator = __flat_map_iterator<Key, T, const T>;
+        using reverse_iterator = __reverse_iterator<iterator>;
+        using const_reverse_iterator = __reverse_iterator<const_iterator>;
+        using reference = typename iterator::reference;
+        using const_reference = typename const_iterator::reference;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private:
+        // 取出批量插入临时数组中元素的键
+        struct key_of_value {
+            const Key& operator()(const value_type& x) const { return x.first; }
+        };
+
+        key_container_type keys_;
+        mapped_container_type values_;
+        Compare comp_;
+
+    public: // 构造函数
+        flat_map() : keys_(), values_(), comp_() {}
+        explicit flat_map(const Compare& comp) : keys_(), values_(), comp_(comp) {}
+
+        // 任意顺序的输入：整体排序去重（重复键保留最先出现的），O(n log n)
+        template<class InputIterator>
+        flat_map(InputIterator first, InputIterator last, const Compare& comp = Compare()) : comp_(comp) {
+            vector<value_type> run(first, last);
+            value_type* end = mystl::__flat_sort_unique(run.begin(), run.end(), key_of_value(), comp_);
+            assign_run(run.begin(), end);
+        }
+
+        flat_map(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+            : flat_map(ilist.begin(), ilist.end(), comp) {}
+
+        // 键数组已严格递增时直接接管两个数组，两者长度必须相同
+        flat_map(sorted_unique_t, key_container_type keys, mapped_container_type values,
+                 const Compare& comp = Compare())
+            : keys_(mystl::move(keys)), values_(mystl::move(values)), comp_(comp) {}
+
+        flat_map& operator=(std::initializer_list<value_type> ilist) {
+            flat_map temp(ilist, comp_);
+            swap(temp);
+            return *this;
+        }
+
+    public: // 迭代器相关操作
+        iterator               begin()        noexcept { return iterator(keys_.begin(), values_.begin()); }
+        const_iterator         begin()  const noexcept { return const_iterator(keys_.begin(), values_.begin()); }
+        iterator               end()          noexcept { return iterator(keys_.end(), values_.end()); }
+        const_iterator         end()    const noexcept { return const_iterator(keys_.end(), values_.end()); }
+        reverse_iterator       rbegin()       noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator       rend()         noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend()   const noexcept { return const_reverse_iterator(begin()); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return keys_.empty(); }
+        size_type size() const noexcept { return keys_.size(); }
+        void reserve(size_type n) {
+            keys_.reserve(n);
+            values_.reserve(n);
+        }
+        key_compare key_comp() const { return comp_; }
+
+        // 底层的键数组与值数组，下标一一对应
+        const key_container_type& keys() const noexcept { return keys_; }
+        const mapped_container_type& values() const noexcept { return values_; }
+
+    public: // 查找
+        iterator lower_bound(const key_type& key) { return at_index(key_lower_bound(key)); }
+        const_iterator lower_bound(const key_type& key) const { return at_index(key_lower_bound(key)); }
+        iterator upper_bound(const key_type& key) {
+            return at_index(mystl::upper_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin());
+        }
+        const_iterator upper_bound(const key_type& key) const {
+            return at_index(mystl::upper_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin());
+        }
+        pair<iterator, iterator> equal_range(const key_type& key) {
+            const size_type i = key_lower_bound(key);
+            return pair<iterator, iterator>(at_index(i), at_index(i + found(i, key)));
+        }
+        pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+            const size_type i = key_lower_bound(key);
+            return pair<const_iterator, const_iterator>(at_index(i), at_index(i + found(i, key)));
+        }
+        iterator find(const key_type& key) {
+            const size_type i = key_lower_bound(key);
+            return found(i, key) ? at_index(i) : end();
+        }
+        const_iterator find(const key_type& key) const {
+            const size_type i = key_lower_bound(key);
+            return found(i, key) ? at_index(i) : end();
+        }
+        size_type count(const key_type& key) const { return found(key_lower_bound(key), key); }
+        bool contains(const key_type& key) const { return found(key_lower_bound(key), key); }
+
+        mapped_type& at(const key_type& key) {
+            const size_type i = key_lower_bound(key);
+            if (!found(i, key)) throw std::out_of_range("flat_map::at");
+            return values_[i];
+        }
+        const mapped_type& at(const key_type& key) const {
+            const size_type i = key_lower_bound(key);
+            if (!found(i, key)) throw std::out_of_range("flat_map::at");
+            return values_[i];
+        }
+
+        mapped_type& operator[](const key_type& key) { return try_emplace(key).first->second; }
+        mapped_type& operator[](key_type&& key) { return try_emplace(mystl::move(key)).first->second; }
+
+    public: // 插入
+        pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+        pair<iterator, bool> insert(value_type&& value) {
+            return try_emplace(mystl::move(value.first), mystl::move(value.second));
+        }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args&&... args) { return insert(value_type(mystl::forward<Args>(args)...)); }
+
+        // 键已存在时不构造 mapped_type，也不移动 args
+        template<class K, class... Args>
+        pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+            const key_type& k = key;
+            const size_type i = key_lower_bound(k);
+            if (found(i, k)) return pair<iterator, bool>(at_index(i), false);
+            return pair<iterator, bool>(insert_at(i, mystl::forward<K>(key), mystl::forward<Args>(args)...), true);
+        }
+
+        template<class M>
+        pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+            const size_type i = key_lower_bound(key);
+            if (found(i, key)) {
+                values_[i] = mystl::forward<M>(obj);
+                return pair<iterator, bool>(at_index(i), false);
+            }
+            return pair<iterator, bool>(insert_at(i, key, mystl::forward<M>(obj)), true);
+        }
+
+        // 批量插入：新元素排序去重后与原数组归并，O(n + m log m)，而不是 m 次 O(n) 的插入；
+        // 已存在的键保持原值
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            vector<value_type> run(first, last);
+            value_type* end = mystl::__flat_sort_unique(run.begin(), run.end(), key_of_value(), comp_);
+            merge_run(run.begin(), end);
+        }
+        void insert(std::initializer_list<value_type> ilist) { insert(ilist.begin(), ilist.end()); }
+
+        // 输入已按键严格递增时跳过排序，O(n + m)
+        template<class InputIterator>
+        void insert(sorted_unique_t, InputIterator first, InputIterator last) {
+            vector<value_type> run(first, last);
+            merge_run(run.begin(), run.end());
+        }
+
+    public: // 删除，返回被删元素的后继
+        iterator erase(const_iterator pos) {
+            const size_type i = static_cast<size_type>(pos.key - keys_.begin());
+            keys_.erase(keys_.begin() + i);
+            values_.erase(values_.begin() + i);
+            return at_index(i);
+        }
+        iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+        iterator erase(const_iterator first, const_iterator last) {
+            const size_type i = static_cast<size_type>(first.key - keys_.begin());
+            const size_type j = static_cast<size_type>(last.key - keys_.begin());
+            keys_.erase(keys_.begin() + i, keys_.begin() + j);
+            values_.erase(values_.begin() + i, values_.begin() + j);
+            return at_index(i);
+        }
+        size_type erase(const key_type& key) {
+            const size_type i = key_lower_bound(key);
+            if (!found(i, key)) return 0;
+            erase(const_iterator(at_index(i)));
+            return 1;
+        }
+
+        void clear() noexcept {
+            keys_.clear();
+            values_.clear();
+        }
+        void swap(flat_map& rhs) noexcept {
+            keys_.swap(rhs.keys_);
+            values_.swap(rhs.values_);
+            mystl::swap(comp_, rhs.comp_);
+        }
+
+    public: // 比较
+        friend bool operator==(const flat_map& lhs, const flat_map& rhs) {
+            return lhs.keys_ == rhs.keys_ && lhs.values_ == rhs.values_;
+        }
+        friend bool operator!=(const flat_map& lhs, const flat_map& rhs) { return !(lhs == rhs); }
+        friend bool operator<(const flat_map& lhs, const flat_map& rhs) {
+            return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+    private:
+        size_type key_lower_bound(const key_type& key) const {
+            return static_cast<size_type>(mystl::lower_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin());
+        }
+        bool found(size_type i, const key_type& key) const { return i != keys_.size() && !comp_(key, keys_[i]); }
+
+        iterator at_index(size_type i) { return iterator(keys_.begin() + i, values_.begin() + i); }
+        const_iterator at_index(size_type i) const { return const_iterator(keys_.begin() + i, values_.begin() + i); }
+
+        // 值数组插入失败时撤销键数组的插入，保持两者长度一致
+        template<class K, class... Args>
+        iterator insert_at(size_type i, K&& key, Args&&... args) {
+            keys_.insert(keys_.begin() + i, key_type(mystl::forward<K>(key)));
+            try {
+                values_.insert(values_.begin() + i, mapped_type(mystl::forward<Args>(args)...));
+            } catch (...) {
+                keys_.erase(keys_.begin() + i);
+                throw;
+            }
+            return at_index(i);
+        }
+
+        void assign_run(value_type* first, value_type* last) {
+            const size_type n = static_cast<size_type>(last - first);
+            keys_.reserve(n);
+            values_.reserve(n);
+            for (; first != last; ++first) {
+                keys_.push_back(mystl::move(first->first));
+                values_.push_back(mystl::move(first->second));
+            }
+        }
+
+        // [first, last) 已有序唯一
+        void merge_run(value_type* first, value_type* last) {
+            last = mystl::__flat_drop_existing(first, last, keys_.begin(), keys_.end(), key_of_value(), comp_);
+            if (first == last) return;
+            // 归并到新数组：容量不足时 reserve 本来也要整体搬迁一次
+            flat_map merged(comp_);
+            merged.reserve(keys_.size() + static_cast<size_type>(last - first));
+            size_type i = 0;
+            const size_type n = keys_.size();
+            while (i != n && first != last) {
+                if (comp_(first->first, keys_[i])) {
+                    merged.keys_.push_back(mystl::move(first->first));
+                    merged.values_.push_back(mystl::move(first->second));
+                    ++first;
+                } else {
+                    merged.keys_.push_back(mystl::move(keys_[i]));
+                    merged.values_.push_back(mystl::move(values_[i]));
+                    ++i;
+                }
+            }
+            for (; i != n; ++i) {
+                merged.keys_.push_back(mystl::move(keys_[i]));
+                merged.values_.push_back(mystl::move(values_[i]));
+            }
+            merged.assign_run(first, last);
+            swap(merged);
+        }
+    };
+
+    template<class Key, class T, class Compare>
+    inline void swap(flat_map<Key, T, Compare>& lhs, flat_map<Key, T, Compare>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
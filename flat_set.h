@@ -0,0 +1,196 @@
+#pragma once
+
+#include "flat_tree.h"
+#include "pair.h"
+#include "vector.h"
+
+#include <initializer_list>
+
+// flat_set：元素有序存放在一个 vector 中的集合
+// 查找是连续内存上的二分，遍历是顺序扫描，没有逐节点的内存开销；
+// 单个插入、删除需要移动其后的元素，适合构建后以查找为主的场景。
+// 插入和删除会使所有迭代器失效
+namespace mystl {
+
+    template<class Key, class Compare = mystl::less<Key>>
+    class flat_set {
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using key_compare = Compare;
+        using value_compare = Compare;
+        using container_type = vector<Key>;
+        using pointer = const Key*;
+        using const_pointer = const Key*;
+        using reference = const Key&;
+        using const_reference = const Key&;
+        using iterator = typename container_type::const_iterator;
+        using const_iterator = typename container_type::const_iterator;
+        using reverse_iterator = typename container_type::const_reverse_iterator;
+        using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private:
+        container_type keys_;
+        Compare comp_;
+
+    public: // 构造函数
+        flat_set() : keys_(), comp_() {}
+        explicit flat_set(const Compare& comp) : keys_(), comp_(comp) {}
+
+        // 任意顺序的输入：整体排序去重，O(n log n)
+        template<class InputIterator>
+        flat_set(InputIterator first, InputIterator last, const Compare& comp = Compare())
+            : keys_(first, last), comp_(comp) {
+            sort_unique();
+        }
+
+        explicit flat_set(container_type keys, const Compare& comp = Compare())
+            : keys_(mystl::move(keys)), comp_(comp) {
+            sort_unique();
+        }
+
+        // 输入已严格递增时直接接管
+        flat_set(sorted_unique_t, container_type keys, const Compare& comp = Compare())
+            : keys_(mystl::move(keys)), comp_(comp) {}
+
+        flat_set(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+            : flat_set(ilist.begin(), ilist.end(), comp) {}
+
+        flat_set& operator=(std::initializer_list<value_type> ilist) {
+            keys_ = container_type(ilist);
+            sort_unique();
+            return *this;
+        }
+
+    public: // 迭代器相关操作
+        const_iterator         begin()  const noexcept { return keys_.begin(); }
+        const_iterator         end()    const noexcept { return keys_.end(); }
+        const_reverse_iterator rbegin() const noexcept { return keys_.rbegin(); }
+        const_reverse_iterator rend()   const noexcept { return keys_.rend(); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return keys_.empty(); }
+        size_type size() const noexcept { return keys_.size(); }
+        size_type capacity() const noexcept { return keys_.capacity(); }
+        void reserve(size_type n) { keys_.reserve(n); }
+        void shrink_to_fit() { keys_.shrink_to_fit(); }
+        key_compare key_comp() const { return comp_; }
+
+        // 底层有序数组，可直接交给按指针工作的算法
+        const container_type& keys() const noexcept { return keys_; }
+
+        // 取走底层数组，容器变为空
+        container_type extract() && {
+            container_type result(mystl::move(keys_));
+            keys_.clear();
+            return result;
+        }
+
+    public: // 查找
+        const_iterator lower_bound(const key_type& key) const {
+            return mystl::lower_bound(keys_.begin(), keys_.end(), key, comp_);
+        }
+        const_iterator upper_bound(const key_type& key) const {
+            return mystl::upper_bound(keys_.begin(), keys_.end(), key, comp_);
+        }
+        pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+            const_iterator it = lower_bound(key);
+            return pair<const_iterator, const_iterator>(it, it != end() && !comp_(key, *it) ? it + 1 : it);
+        }
+        const_iterator find(const key_type& key) const {
+            const_iterator it = lower_bound(key);
+            return it != end() && !comp_(key, *it) ? it : end();
+        }
+        size_type count(const key_type& key) const { return find(key) != end(); }
+        bool contains(const key_type& key) const { return find(key) != end(); }
+
+    public: // 插入
+        pair<iterator, bool> insert(const value_type& value) { return emplace_unique(value); }
+        pair<iterator, bool> insert(value_type&& value) { return emplace_unique(mystl::move(value)); }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args&&... args) { return emplace_unique(value_type(mystl::forward<Args>(args)...)); }
+
+        // 批量插入：新元素排序去重后与原数组归并，O(n + m log m)，而不是 m 次 O(n) 的插入
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            container_type run(first, last);
+            merge_run(run, false);
+        }
+        void insert(std::initializer_list<value_type> ilist) { insert(ilist.begin(), ilist.end()); }
+
+        // 输入已严格递增时跳过排序，O(n + m)
+        template<class InputIterator>
+        void insert(sorted_unique_t, InputIterator first, InputIterator last) {
+            container_type run(first, last);
+            merge_run(run, true);
+        }
+
+    public: // 删除，返回被删元素的后继
+        iterator erase(const_iterator pos) { return keys_.erase(const_cast<Key*>(pos)); }
+        iterator erase(const_iterator first, const_iterator last) {
+            return keys_.erase(const_cast<Key*>(first), const_cast<Key*>(last));
+        }
+        size_type erase(const key_type& key) {
+            const_iterator it = find(key);
+            if (it == end()) return 0;
+            erase(it);
+            return 1;
+        }
+
+        void clear() noexcept { keys_.clear(); }
+        void swap(flat_set& rhs) noexcept {
+            keys_.swap(rhs.keys_);
+            mystl::swap(comp_, rhs.comp_);
+        }
+
+    public: // 比较
+        friend bool operator==(const flat_set& lhs, const flat_set& rhs) { return lhs.keys_ == rhs.keys_; }
+        friend bool operator!=(const flat_set& lhs, const flat_set& rhs) { return !(lhs == rhs); }
+        friend bool operator<(const flat_set& lhs, const flat_set& rhs) {
+            return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+    private:
+        void sort_unique() {
+            Key* last = mystl::__flat_sort_unique(keys_.begin(), keys_.end(), identity<Key>(), comp_);
+            keys_.erase(last, keys_.end());
+        }
+
+        template<class V>
+        pair<iterator, bool> emplace_unique(V&& value) {
+            Key* it = const_cast<Key*>(lower_bound(value));
+            if (it != keys_.end() && !comp_(value, *it)) return pair<iterator, bool>(it, false);
+            return pair<iterator, bool>(keys_.insert(it, mystl::forward<V>(value)), true);
+        }
+
+        void merge_run(container_type& run, bool sorted) {
+            Key* last = run.end();
+            if (!sorted) last = mystl::__flat_sort_unique(run.begin(), last, identity<Key>(), comp_);
+            last = mystl::__flat_drop_existing(run.begin(), last, keys_.begin(), keys_.end(), identity<Key>(), comp_);
+            const size_type m = static_cast<size_type>(last - run.begin());
+            if (m == 0) return;
+            // 归并到新数组：容量不足时 reserve 本来也要整体搬迁一次
+            container_type merged;
+            merged.reserve(keys_.size() + m);
+            Key* i = keys_.begin();
+            Key* j = run.begin();
+            while (i != keys_.end() && j != last) {
+                if (comp_(*j, *i)) merged.push_back(mystl::move(*j++));
+                else merged.push_back(mystl::move(*i++));
+            }
+            for (; i != keys_.end(); ++i) merged.push_back(mystl::move(*i));
+            for (; j != last; ++j) merged.push_back(mystl::move(*j));
+            keys_.swap(merged);
+        }
+    };
+
+    template<class Key, class Compare>
+    inline void swap(flat_set<Key, Compare>& lhs, flat_set<Key, Compare>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "algorithm.h"
+#include "functional.h"
+
+// flat_map 与 flat_set 共用的部分：有序唯一标记，以及批量插入时对新元素的整理
+// 批量插入的新元素先放进临时数组，稳定排序并去重（等价键保留最先出现的），
+// 再剔除容器中已有的键，最后与原有元素做一次 O(n + m) 的归并
+namespace mystl {
+
+    // 调用方保证输入已按键严格递增，构造与插入时跳过排序和去重
+    struct sorted_unique_t {
+        explicit sorted_unique_t() = default;
+    };
+    inline constexpr sorted_unique_t sorted_unique{};
+
+    // 稳定排序后去重，返回去重后的末尾
+    template<class RandomIter, class KeyOfValue, class Compare>
+    RandomIter __flat_sort_unique(RandomIter first, RandomIter last, KeyOfValue key_of, const Compare& comp) {
+        if (first == last) return last;
+        mystl::stable_sort(first, last, [&](const auto& a, const auto& b) { return comp(key_of(a), key_of(b)); });
+        RandomIter result = first;
+        while (++first != last) {
+            if (comp(key_of(*result), key_of(*first)) && ++result != first) *result = mystl::move(*first);
+        }
+        return ++result;
+    }
+
+    // 从有序唯一的 [first, last) 中剔除在有序键数组 [kfirst, klast) 里已存在的键，返回新的末尾
+    template<class RandomIter, class KeyIter, class KeyOfValue, class Compare>
+    RandomIter __flat_drop_existing(RandomIter first, RandomIter last, KeyIter kfirst, KeyIter klast,
+                                    KeyOfValue key_of, const Compare& comp) {
+        RandomIter result = first;
+        for (; first != last; ++first) {
+            while (kfirst != klast && comp(*kfirst, key_of(*first))) ++kfirst;
+            if (kfirst != klast && !comp(key_of(*first), *kfirst)) continue;
+            if (result != first) *result = mystl::move(*first);
+            ++result;
+        }
+        return result;
+    }
+
+} // namespace mystl
@@ -1,4 +1,4 @@
-#pragma
+#pragma once
 
 #include <cstddef>
 
@@ -15,14 +15,70 @@ namespace mystl {
     template<class T>
     struct less : public binary_functoin<T, T, bool>
     {
-        bool operator()(const T& x, const T& y) const {return x >= y;}
+        bool operator()(const T& x, const T& y) const {return x < y;}
+    };
+
+    // 透明比较器，直接比较两侧的值，用于异构查找与二分查找的默认比较
+    template<>
+    struct less<void>
+    {
+        using is_transparent = void;
+
+        template<class T, class U>
+        bool operator()(const T& x, const U& y) const {return x < y;}
     };
 
     template<class T>
-    struct greater : public binary_function<T, T, bool>
+    struct greater : public binary_functoin<T, T, bool>
     {
-        bool operator()(const T& x, const T& y) const {return x < y;}
+        bool operator()(const T& x, const T& y) const {return x > y;}
+    };
+
+    template<class T>
+    struct equal_to : public binary_functoin<T, T, bool>
+    {
+        bool operator()(const T& x, const T& y) const {return x == y;}
+    };
+
+    // 透明比较器，可用于异构查找
+    template<>
+    struct equal_to<void>
+    {
+        using is_transparent = void;
+
+        template<class T, class U>
+        bool operator()(const T& x, const U& y) const {return x == y;}
     };
 
+    template<class T>
+    struct plus : public binary_functoin<T, T, T>
+    {
+        T operator()(const T& x, const T& y) const {return x + y;}
+    };
+
+    // 透明版本，结果类型由 x + y 决定
+    template<>
+    struct plus<void>
+    {
+        using is_transparent = void;
+
+        template<class T, class U>
+        auto operator()(T&& x, U&& y) const -> decltype(static_cast<T&&>(x) + static_cast<U&&>(y))
+        {return static_cast<T&&>(x) + static_cast<U&&>(y);}
+    };
+
+    // 取出元素自身作为键，用于 set 类容器
+    template<class T>
+    struct identity
+    {
+        const T& operator()(const T& x) const {return x;}
+    };
+
+    // 取出 pair 的 first 作为键，用于 map 类容器
+    template<class Pair>
+    struct select1st
+    {
+        const typename Pair::first_type& operator()(const Pair& x) const {return x.first;}
+    };
 
-}
\ No newline at end of file
+}
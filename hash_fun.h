@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+// 哈希函数对象
+// 整数与指针直接返回自身，位混合交给哈希表完成；
+// 字符串使用 FNV-1a，并可透明地接受 std::string、std::string_view 与 const char*
+namespace mystl {
+
+    template<class Key>
+    struct hash {};
+
+#define MYSTL_TRIVIAL_HASH(type) \
+    template<> struct hash<type> { \
+        size_t operator()(type x) const noexcept { return static_cast<size_t>(x); } \
+    };
+
+    MYSTL_TRIVIAL_HASH(bool)
+    MYSTL_TRIVIAL_HASH(char)
+    MYSTL_TRIVIAL_HASH(signed char)
+    MYSTL_TRIVIAL_HASH(unsigned char)
+    MYSTL_TRIVIAL_HASH(wchar_t)
+    MYSTL_TRIVIAL_HASH(char16_t)
+    MYSTL_TRIVIAL_HASH(char32_t)
+    MYSTL_TRIVIAL_HASH(short)
+    MYSTL_TRIVIAL_HASH(unsigned short)
+    MYSTL_TRIVIAL_HASH(int)
+    MYSTL_TRIVIAL_HASH(unsigned int)
+    MYSTL_TRIVIAL_HASH(long)
+    MYSTL_TRIVIAL_HASH(unsigned long)
+    MYSTL_TRIVIAL_HASH(long long)
+    MYSTL_TRIVIAL_HASH(unsigned long long)
+
+#undef MYSTL_TRIVIAL_HASH
+
+    template<class T>
+    struct hash<T*> {
+        size_t operator()(T* p) const noexcept { return reinterpret_cast<size_t>(p); }
+    };
+
+    inline size_t __hash_bytes(const char* s, size_t n) noexcept {
+        size_t h = static_cast<size_t>(14695981039346656037ULL);
+        for (size_t i = 0; i < n; ++i) {
+            h ^= static_cast<unsigned char>(s[i]);
+            h *= static_cast<size_t>(1099511628211ULL);
+        }
+        return h;
+    }
+
+    struct __string_hash {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view s) const noexcept { return __hash_bytes(s.data(), s.size()); }
+        size_t operator()(const std::string& s) const noexcept { return __hash_bytes(s.data(), s.size()); }
+        size_t operator()(const char* s) const noexcept { return __hash_bytes(s, strlen(s)); }
+    };
+
+    template<> struct hash<std::string> : __string_hash {};
+    template<> struct hash<std::string_view> : __string_hash {};
+
+} // namespace mystl
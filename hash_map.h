@@ -0,0 +1,173 @@
+#pragma once
+
+#include "hashtable.h"
+#include "hash_fun.h"
+#include "functional.h"
+#include "pair.h"
+
+#include <initializer_list>
+#include <stdexcept>
+
+// hash_map：基于开放寻址 hashtable 的无序映射
+// 元素直接存放在 slot 数组中，插入不为单个元素分配内存；
+// 扩容会移动元素，因此插入可能使迭代器与引用失效，删除不会
+namespace mystl {
+
+    template<class Key, class T, class HashFcn = mystl::hash<Key>,
+             class EqualKey = mystl::equal_to<Key>, class Alloc = simpleAlloc<pair<const Key, T>>>
+    class hash_map {
+    private:
+        using rep_type = hashtable<pair<const Key, T>, Key, HashFcn,
+                                   select1st<pair<const Key, T>>, EqualKey, Alloc>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = typename rep_type::value_type;
+        using hasher = typename rep_type::hasher;
+        using key_equal = typename rep_type::key_equal;
+        using pointer = typename rep_type::pointer;
+        using const_pointer = typename rep_type::const_pointer;
+        using reference = typename rep_type::reference;
+        using const_reference = typename rep_type::const_reference;
+        using iterator = typename rep_type::iterator;
+        using const_iterator = typename rep_type::const_iterator;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        template<class K>
+        using key_arg = typename rep_type::template key_arg<K>;
+
+    private:
+        rep_type t_;
+
+    public: // 构造函数
+        hash_map() = default;
+        explicit hash_map(size_type n, const hasher& hf = hasher(), const key_equal& eq = key_equal())
+            : t_(n, hf, eq) {}
+
+        template<class InputIterator>
+        hash_map(InputIterator first, InputIterator last, size_type n = 0) : t_(n) {
+            insert(first, last);
+        }
+
+        hash_map(std::initializer_list<value_type> ilist) : t_(ilist.size()) {
+            insert(ilist.begin(), ilist.end());
+        }
+
+        hash_map& operator=(std::initializer_list<value_type> ilist) {
+            clear();
+            insert(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+    public: // 迭代器相关操作
+        iterator       begin()       noexcept { return t_.begin(); }
+        const_iterator begin() const noexcept { return t_.begin(); }
+        iterator       end()         noexcept { return t_.end(); }
+        const_iterator end()   const noexcept { return t_.end(); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return t_.empty(); }
+        size_type size() const noexcept { return t_.size(); }
+        size_type capacity() const noexcept { return t_.capacity(); }
+        float load_factor() const noexcept { return t_.load_factor(); }
+        void reserve(size_type n) { t_.reserve(n); }
+        void rehash(size_type n) { t_.rehash(n); }
+        hasher hash_function() const { return t_.hash_function(); }
+        key_equal key_eq() const { return t_.key_eq(); }
+
+    public: // 查找，HashFcn 与 EqualKey 均透明时可用与 Key 可比较的任意类型查找
+        template<class K = key_type>
+        iterator find(const key_arg<K>& key) { return t_.find(key); }
+        template<class K = key_type>
+        const_iterator find(const key_arg<K>& key) const { return t_.find(key); }
+        template<class K = key_type>
+        size_type count(const key_arg<K>& key) const { return t_.count(key); }
+        template<class K = key_type>
+        bool contains(const key_arg<K>& key) const { return t_.contains(key); }
+
+        template<class K = key_type>
+        mapped_type& at(const key_arg<K>& key) {
+            iterator it = find(key);
+            if (it == end()) throw std::out_of_range("hash_map::at");
+            return it->second;
+        }
+        template<class K = key_type>
+        const mapped_type& at(const key_arg<K>& key) const {
+            const_iterator it = find(key);
+            if (it == end()) throw std::out_of_range("hash_map::at");
+            return it->second;
+        }
+
+        mapped_type& operator[](const key_type& key) { return try_emplace(key).first->second; }
+        mapped_type& operator[](key_type&& key) { return try_emplace(mystl::move(key)).first->second; }
+
+    public: // 插入
+        pair<iterator, bool> insert(const value_type& value) { return t_.insert_unique(value); }
+        pair<iterator, bool> insert(value_type&& value) { return t_.insert_unique(mystl::move(value)); }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            for (; first != last; ++first) t_.insert_unique(*first);
+        }
+        void insert(std::initializer_list<value_type> ilist) { insert(ilist.begin(), ilist.end()); }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args&&... args) {
+            return t_.emplace_unique(mystl::forward<Args>(args)...);
+        }
+
+        // 键已存在时不构造 mapped_type，也不移动 args
+        template<class K, class... Args>
+        pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+            pair<size_type, bool> res = t_.find_or_prepare_insert(key);
+            if (res.second) {
+                t_.emplace_at(res.first, mystl::forward<K>(key), mapped_type(mystl::forward<Args>(args)...));
+            }
+            return pair<iterator, bool>(t_.iterator_at(res.first), res.second);
+        }
+
+        template<class M>
+        pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+            pair<iterator, bool> res = try_emplace(key, mystl::forward<M>(obj));
+            if (!res.second) res.first->second = mystl::forward<M>(obj);
+            return res;
+        }
+
+    public: // 删除
+        iterator erase(const_iterator pos) noexcept {
+            iterator next(pos.ctrl, const_cast<value_type*>(pos.slot));
+            ++next;
+            t_.erase(pos);
+            return next;
+        }
+        iterator erase(iterator pos) noexcept { return erase(const_iterator(pos)); }
+        iterator erase(const_iterator first, const_iterator last) noexcept { return t_.erase(first, last); }
+
+        template<class K = key_type>
+        size_type erase(const key_arg<K>& key) { return t_.erase_key(key); }
+
+        void clear() noexcept { t_.clear(); }
+        void swap(hash_map& rhs) noexcept { t_.swap(rhs.t_); }
+
+    public: // 比较，元素个数相同且每个键值对都能在对方中找到
+        friend bool operator==(const hash_map& lhs, const hash_map& rhs) {
+            if (lhs.size() != rhs.size()) return false;
+            for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+                const_iterator other = rhs.find(it->first);
+                if (other == rhs.end() || !(other->second == it->second)) return false;
+            }
+            return true;
+        }
+        friend bool operator!=(const hash_map& lhs, const hash_map& rhs) { return !(lhs == rhs); }
+    };
+
+    template<class Key, class T, class HashFcn, class EqualKey, class Alloc>
+    inline void swap(hash_map<Key, T, HashFcn, EqualKey, Alloc>& lhs,
+                     hash_map<Key, T, HashFcn, EqualKey, Alloc>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "hashtable.h"
+#include "hash_fun.h"
+#include "functional.h"
+#include "pair.h"
+
+#include <initializer_list>
+
+// hash_set：基于开放寻址 hashtable 的无序集合，元素不可修改，iterator 与 const_iterator 相同
+namespace mystl {
+
+    template<class Key, class HashFcn = mystl::hash<Key>,
+             class EqualKey = mystl::equal_to<Key>, class Alloc = simpleAlloc<Key>>
+    class hash_set {
+    private:
+        using rep_type = hashtable<Key, Key, HashFcn, identity<Key>, EqualKey, Alloc>;
+
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using hasher = typename rep_type::hasher;
+        using key_equal = typename rep_type::key_equal;
+        using pointer = typename rep_type::const_pointer;
+        using const_pointer = typename rep_type::const_pointer;
+        using reference = typename rep_type::const_reference;
+        using const_reference = typename rep_type::const_reference;
+        using iterator = typename rep_type::const_iterator;
+        using const_iterator = typename rep_type::const_iterator;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        template<class K>
+        using key_arg = typename rep_type::template key_arg<K>;
+
+    private:
+        rep_type t_;
+
+    public: // 构造函数
+        hash_set() = default;
+        explicit hash_set(size_type n, const hasher& hf = hasher(), const key_equal& eq = key_equal())
+            : t_(n, hf, eq) {}
+
+        template<class InputIterator>
+        hash_set(InputIterator first, InputIterator last, size_type n = 0) : t_(n) {
+            insert(first, last);
+        }
+
+        hash_set(std::initializer_list<value_type> ilist) : t_(ilist.size()) {
+            insert(ilist.begin(), ilist.end());
+        }
+
+        hash_set& operator=(std::initializer_list<value_type> ilist) {
+            clear();
+            insert(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+    public: // 迭代器相关操作
+        iterator begin() const noexcept { return t_.begin(); }
+        iterator end()   const noexcept { return t_.end(); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return t_.empty(); }
+        size_type size() const noexcept { return t_.size(); }
+        size_type capacity() const noexcept { return t_.capacity(); }
+        float load_factor() const noexcept { return t_.load_factor(); }
+        void reserve(size_type n) { t_.reserve(n); }
+        void rehash(size_type n) { t_.rehash(n); }
+        hasher hash_function() const { return t_.hash_function(); }
+        key_equal key_eq() const { return t_.key_eq(); }
+
+    public: // 查找，HashFcn 与 EqualKey 均透明时可用与 Key 可比较的任意类型查找
+        template<class K = key_type>
+        iterator find(const key_arg<K>& key) const { return t_.find(key); }
+        template<class K = key_type>
+        size_type count(const key_arg<K>& key) const { return t_.count(key); }
+        template<class K = key_type>
+        bool contains(const key_arg<K>& key) const { return t_.contains(key); }
+
+    public: // 插入
+        pair<iterator, bool> insert(const value_type& value) {
+            pair<typename rep_type::iterator, bool> res = t_.insert_unique(value);
+            return pair<iterator, bool>(res.first, res.second);
+        }
+        pair<iterator, bool> insert(value_type&& value) {
+            pair<typename rep_type::iterator, bool> res = t_.insert_unique(mystl::move(value));
+            return pair<iterator, bool>(res.first, res.second);
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            for (; first != last; ++first) t_.insert_unique(*first);
+        }
+        void insert(std::initializer_list<value_type> ilist) { insert(ilist.begin(), ilist.end()); }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args&&... args) {
+            pair<typename rep_type::iterator, bool> res = t_.emplace_unique(mystl::forward<Args>(args)...);
+            return pair<iterator, bool>(res.first, res.second);
+        }
+
+    public: // 删除
+        iterator erase(const_iterator pos) noexcept {
+            const_iterator next = pos;
+            ++next;
+            t_.erase(pos);
+            return next;
+        }
+        iterator erase(const_iterator first, const_iterator last) noexcept { return t_.erase(first, last); }
+
+        template<class K = key_type>
+        size_type erase(const key_arg<K>& key) { return t_.erase_key(key); }
+
+        void clear() noexcept { t_.clear(); }
+        void swap(hash_set& rhs) noexcept { t_.swap(rhs.t_); }
+
+    public: // 比较
+        friend bool operator==(const hash_set& lhs, const hash_set& rhs) {
+            if (lhs.size() != rhs.size()) return false;
+            for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+                if (!rhs.contains(*it)) return false;
+            }
+            return true;
+        }
+        friend bool operator!=(const hash_set& lhs, const hash_set& rhs) { return !(lhs == rhs); }
+    };
+
+    template<class Key, class HashFcn, class EqualKey, class Alloc>
+    inline void swap(hash_set<Key, HashFcn, EqualKey, Alloc>& lhs,
+                     hash_set<Key, HashFcn, EqualKey, Alloc>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
@@ -0,0 +1,632 @@
+#pragma once
+
+#include "iterator.h"
+#include "allocator.h"
+#include "algobase.h"
+#include "construct.h"
+#include "pair.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// 开放寻址哈希表（Swiss table）
+// 元素直接存放在连续的 slot 数组中，另有一个等长的控制字节数组：
+//     空位    1000 0000
+//     已删除  1111 1110
+//     哨兵    1111 1111
+//     已占用  0xxx xxxx   低 7 位为哈希值的 H2 部分
+// 查找时以 H1 决定起始位置，一次比较一组（SSE2 下 16 个）控制字节，
+// 只有 H2 相同的 slot 才需要真正比较键
+// 容量恒为 2^k - 1，控制字节数组末尾是哨兵，其后复制了开头的 W - 1 个字节，
+// 这样从任意位置开始读取一组都不会越界
+namespace mystl {
+    using __ctrl_t = signed char;
+
+    enum : __ctrl_t {
+        __ctrl_empty = -128,
+        __ctrl_deleted = -2,
+        __ctrl_sentinel = -1,
+    };
+
+    inline bool __ctrl_is_full(__ctrl_t c) noexcept { return c >= 0; }
+    inline bool __ctrl_is_empty_or_deleted(__ctrl_t c) noexcept { return c < __ctrl_sentinel; }
+
+    // 组内匹配结果，每个 slot 占 1 << Shift 位
+    template<class T, int Shift>
+    struct __group_mask {
+        T mask;
+
+        explicit __group_mask(T m) noexcept : mask(m) {}
+        explicit operator bool() const noexcept { return mask != 0; }
+
+        int lowest() const noexcept { return trailing_zeros(); }
+        void next() noexcept { mask &= (mask - 1); }
+
+        int trailing_zeros() const noexcept { return __builtin_ctzll(mask) >> Shift; }
+        int leading_zeros() const noexcept {
+            constexpr int extra = 64 - int(sizeof(T) * 8);
+            return (__builtin_clzll(static_cast<unsigned long long>(mask)) - extra) >> Shift;
+        }
+    };
+
+#if defined(__SSE2__)
+    struct __group {
+        static constexpr size_t width = 16;
+        using mask_type = __group_mask<uint16_t, 0>;   // 16 个 slot 恰好占满 16 位，leading_zeros 不会把多余的高位算进去
+
+        __m128i ctrl;
+
+        explicit __group(const __ctrl_t* pos) noexcept
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+        mask_type match(__ctrl_t h2) const noexcept {
+            return mask_type(static_cast<uint16_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))));
+        }
+        mask_type match_empty() const noexcept { return match(__ctrl_empty); }
+        mask_type match_empty_or_deleted() const noexcept {
+            return mask_type(static_cast<uint16_t>(
+                _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(__ctrl_sentinel), ctrl))));
+        }
+        // 开头连续的空位或已删除位个数
+        size_t count_leading_empty_or_deleted() const noexcept {
+            return static_cast<size_t>(__builtin_ctz(match_empty_or_deleted().mask + 1));
+        }
+    };
+#else
+    // 无 SSE2 时用 64 位整数一次处理 8 个控制字节（要求小端）
+    struct __group {
+        static constexpr size_t width = 8;
+        using mask_type = __group_mask<uint64_t, 3>;
+
+        static constexpr uint64_t msbs = 0x8080808080808080ULL;
+        static constexpr uint64_t lsbs = 0x0101010101010101ULL;
+
+        uint64_t ctrl;
+
+        explicit __group(const __ctrl_t* pos) noexcept { memcpy(&ctrl, pos, sizeof(ctrl)); }
+
+        // 可能有假阳性，但只会落在已占用的 slot 上，调用者总会再比较键
+        mask_type match(__ctrl_t h2) const noexcept {
+            uint64_t x = ctrl ^ (lsbs * static_cast<unsigned char>(h2));
+            return mask_type((x - lsbs) & ~x & msbs);
+        }
+        mask_type match_empty() const noexcept { return mask_type((ctrl & (~ctrl << 6)) & msbs); }
+        mask_type match_empty_or_deleted() const noexcept { return mask_type((ctrl & (~ctrl << 7)) & msbs); }
+        size_t count_leading_empty_or_deleted() const noexcept {
+            constexpr uint64_t gaps = 0x00FEFEFEFEFEFEFEULL;
+            return (__builtin_ctzll(((~ctrl & (ctrl >> 7)) | gaps) + 1) + 7) >> 3;
+        }
+    };
+#endif
+
+    // 空表共享的控制字节：哨兵后跟一组空位，空表因此无需分配内存
+    inline __ctrl_t* __empty_group() noexcept {
+        alignas(16) static const __ctrl_t group[16] = {
+            __ctrl_sentinel, __ctrl_empty, __ctrl_empty, __ctrl_empty,
+            __ctrl_empty, __ctrl_empty, __ctrl_empty, __ctrl_empty,
+            __ctrl_empty, __ctrl_empty, __ctrl_empty, __ctrl_empty,
+            __ctrl_empty, __ctrl_empty, __ctrl_empty, __ctrl_empty};
+        return const_cast<__ctrl_t*>(group);
+    }
+
+    // 以组为单位的二次探测：依次跳过 W、2W、3W ... 个位置，容量为 2^k - 1 时可遍历所有组
+    struct __probe_seq {
+        size_t mask_;
+        size_t offset_;
+        size_t index_;
+
+        __probe_seq(size_t hash, size_t mask) noexcept : mask_(mask), offset_(hash & mask), index_(0) {}
+
+        size_t offset() const noexcept { return offset_; }
+        size_t offset(size_t i) const noexcept { return (offset_ + i) & mask_; }
+        void next() noexcept {
+            index_ += __group::width;
+            offset_ = (offset_ + index_) & mask_;
+        }
+    };
+
+    // 打散用户哈希值，使 std::hash<int> 这类恒等哈希也能均匀分布
+    inline size_t __hash_mix(size_t h) noexcept {
+        uint64_t x = static_cast<uint64_t>(h) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(x ^ (x >> 32));
+    }
+    inline size_t __hash_h1(size_t h) noexcept { return h >> 7; }
+    inline __ctrl_t __hash_h2(size_t h) noexcept { return static_cast<__ctrl_t>(h & 0x7F); }
+
+    // 最大负载因子 7/8，且至少保留一个空位，保证探测总能终止
+    inline size_t __capacity_to_growth(size_t cap) noexcept { return cap - (cap + 1) / 8; }
+
+    // 容纳 n 个元素所需的最小容量，结果为 2^k - 1 且不小于 W - 1
+    inline size_t __normalize_capacity(size_t n) noexcept {
+        size_t cap = __group::width - 1;
+        while (__capacity_to_growth(cap) < n) cap = cap * 2 + 1;
+        return cap;
+    }
+}
+
+
+// 迭代器定义
+namespace mystl {
+    template<class Value, class Ref, class Ptr>
+    struct __hashtable_iterator {
+        using iterator = __hashtable_iterator<Value, Value &, Value *>;
+        using const_iterator = __hashtable_iterator<Value, const Value &, const Value *>;
+        using self = __hashtable_iterator;
+
+        using iterator_category = forward_iterator_tag;
+        using value_type = Value;
+        using pointer = Ptr;
+        using reference = Ref;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        // 数据成员
+        __ctrl_t* ctrl;
+        Value* slot;
+
+        __hashtable_iterator() noexcept : ctrl(nullptr), slot(nullptr) {}
+        __hashtable_iterator(__ctrl_t* c, Value* s) noexcept : ctrl(c), slot(s) {}
+        __hashtable_iterator(const iterator& rhs) noexcept : ctrl(rhs.ctrl), slot(rhs.slot) {}
+        self& operator=(const self&) = default;
+
+        reference operator*() const noexcept { return *slot; }
+        pointer operator->() const noexcept { return slot; }
+
+        self& operator++() noexcept {
+            ++ctrl;
+            ++slot;
+            skip_empty_or_deleted();
+            return *this;
+        }
+        self operator++(int) noexcept {
+            self temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        // 按组跳过空位与已删除位，遇到哨兵时停下
+        void skip_empty_or_deleted() noexcept {
+            while (__ctrl_is_empty_or_deleted(*ctrl)) {
+                size_t shift = __group(ctrl).count_leading_empty_or_deleted();
+                ctrl += shift;
+                slot += shift;
+            }
+        }
+
+        bool operator==(const self& rhs) const noexcept { return ctrl == rhs.ctrl; }
+        bool operator!=(const self& rhs) const noexcept { return ctrl != rhs.ctrl; }
+    };
+}
+
+
+// hashtable 定义，供 hash_map 与 hash_set 使用
+// ExtractKey 从元素中取出键，HashFcn 与 EqualKey 同时带有 is_transparent 时支持异构查找
+namespace mystl {
+    template<class HashFcn, class EqualKey, class = void>
+    struct __is_transparent_lookup : false_type {};
+
+    template<class HashFcn, class EqualKey>
+    struct __is_transparent_lookup<HashFcn, EqualKey,
+        std::void_t<typename HashFcn::is_transparent, typename EqualKey::is_transparent>> : true_type {};
+
+    // 别名模板在类实例化后直接展开为 K，因此 K 仍可由实参推导
+    template<bool Transparent>
+    struct __key_arg {
+        template<class K, class KeyType>
+        using type = K;
+    };
+
+    template<>
+    struct __key_arg<false> {
+        template<class K, class KeyType>
+        using type = KeyType;
+    };
+
+    template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey, class Alloc>
+    class hashtable {
+    public:
+        using value_type = Value;
+        using key_type = Key;
+        using hasher = HashFcn;
+        using key_equal = EqualKey;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using iterator = __hashtable_iterator<Value, Value &, Value *>;
+        using const_iterator = __hashtable_iterator<Value, const Value &, const Value *>;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        // 支持异构查找时，查找类接口接受任意键类型 K，否则退化为 key_type
+        template<class K>
+        using key_arg = typename __key_arg<__is_transparent_lookup<HashFcn, EqualKey>::value>::template type<K, key_type>;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+    private:
+        // 控制字节与 slot 数组都走 Alloc 的底层配置器
+        using ctrl_allocator = typename __rebind_alloc<Alloc, __ctrl_t>::type;
+        using slot_allocator = typename __rebind_alloc<Alloc, value_type>::type;
+
+        // 数据成员
+        __ctrl_t* ctrl_;
+        value_type* slots_;
+        size_type size_;
+        size_type capacity_;
+        size_type growth_left_;// 不触发扩容还能使用的空位数，已删除位不计入
+        hasher hash_;
+        key_equal equal_;
+        ExtractKey get_key_;
+
+    public: // 构造、复制、移动、析构函数
+        hashtable() noexcept : hashtable(0, hasher(), key_equal()) {}
+        explicit hashtable(size_type n, const hasher& hf = hasher(), const key_equal& eq = key_equal())
+            : ctrl_(__empty_group()), slots_(nullptr), size_(0), capacity_(0), growth_left_(0),
+              hash_(hf), equal_(eq), get_key_() {
+            if (n) initialize_slots(__normalize_capacity(n));
+        }
+
+        hashtable(const hashtable& rhs) : hashtable(rhs.size_, rhs.hash_, rhs.equal_) {
+            for (const_iterator it = rhs.begin(); it != rhs.end(); ++it) {
+                size_type h = hash_of(get_key_(*it));
+                emplace_at(prepare_insert(h), *it);
+            }
+        }
+
+        hashtable(hashtable&& rhs) noexcept
+            : ctrl_(rhs.ctrl_), slots_(rhs.slots_), size_(rhs.size_), capacity_(rhs.capacity_),
+              growth_left_(rhs.growth_left_), hash_(rhs.hash_), equal_(rhs.equal_), get_key_() {
+            rhs.reset();
+        }
+
+        hashtable& operator=(const hashtable& rhs) {
+            if (this != &rhs) {
+                hashtable temp(rhs);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        hashtable& operator=(hashtable&& rhs) noexcept {
+            if (this != &rhs) {
+                destroy_and_deallocate();
+                ctrl_ = rhs.ctrl_;
+                slots_ = rhs.slots_;
+                size_ = rhs.size_;
+                capacity_ = rhs.capacity_;
+                growth_left_ = rhs.growth_left_;
+                hash_ = rhs.hash_;
+                equal_ = rhs.equal_;
+                rhs.reset();
+            }
+            return *this;
+        }
+
+        ~hashtable() { destroy_and_deallocate(); }
+
+    public: // 迭代器相关操作
+        iterator begin() noexcept {
+            iterator it(ctrl_, slots_);
+            it.skip_empty_or_deleted();
+            return it;
+        }
+        const_iterator begin() const noexcept { return const_cast<hashtable*>(this)->begin(); }
+        iterator end() noexcept { return iterator(ctrl_ + capacity_, slots_ + capacity_); }
+        const_iterator end() const noexcept { return const_cast<hashtable*>(this)->end(); }
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type capacity() const noexcept { return capacity_; }
+        float load_factor() const noexcept {
+            return capacity_ ? static_cast<float>(size_) / static_cast<float>(capacity_) : 0.0f;
+        }
+        hasher hash_function() const { return hash_; }
+        key_equal key_eq() const { return equal_; }
+
+        // 保证插入到 n 个元素前不会再扩容
+        void reserve(size_type n) {
+            if (n > size_ + growth_left_) resize(__normalize_capacity(n));
+        }
+
+        // 重建控制字节，n 为 0 时收缩到恰好容纳现有元素，同时清除所有已删除标记
+        void rehash(size_type n) {
+            if (n == 0 && capacity_ == 0) return;
+            if (n == 0 && size_ == 0) {
+                destroy_and_deallocate();
+                reset();
+                return;
+            }
+            size_type cap = __normalize_capacity(n > size_ ? n : size_);
+            if (n == 0 || cap > capacity_) resize(cap);
+        }
+
+    public: // 查找
+        template<class K = key_type>
+        iterator find(const key_arg<K>& key) {
+            size_type idx = find_index(key, hash_of(key));
+            return idx == npos ? end() : iterator_at(idx);
+        }
+        template<class K = key_type>
+        const_iterator find(const key_arg<K>& key) const {
+            return const_cast<hashtable*>(this)->find(key);
+        }
+        template<class K = key_type>
+        size_type count(const key_arg<K>& key) const { return find(key) == end() ? 0 : 1; }
+        template<class K = key_type>
+        bool contains(const key_arg<K>& key) const { return find(key) != end(); }
+
+    public: // 插入
+        template<class... Args>
+        pair<iterator, bool> emplace_unique(Args&&... args) {
+            value_type temp(mystl::forward<Args>(args)...);
+            return insert_unique(mystl::move(temp));
+        }
+
+        pair<iterator, bool> insert_unique(const value_type& value) {
+            pair<size_type, bool> res = find_or_prepare_insert(get_key_(value));
+            if (res.second) emplace_at(res.first, value);
+            return pair<iterator, bool>(iterator_at(res.first), res.second);
+        }
+
+        pair<iterator, bool> insert_unique(value_type&& value) {
+            pair<size_type, bool> res = find_or_prepare_insert(get_key_(value));
+            if (res.second) emplace_at(res.first, mystl::move(value));
+            return pair<iterator, bool>(iterator_at(res.first), res.second);
+        }
+
+        // 找到 key 则返回其位置与 false；否则预留一个 slot 并返回 true，
+        // 调用者必须随后用 emplace_at 在该位置构造元素
+        template<class K = key_type>
+        pair<size_type, bool> find_or_prepare_insert(const key_arg<K>& key) {
+            size_type h = hash_of(key);
+            size_type idx = find_index(key, h);
+            if (idx != npos) return pair<size_type, bool>(idx, false);
+            return pair<size_type, bool>(prepare_insert(h), true);
+        }
+
+        // 在 prepare_insert 预留的 slot 上构造元素，构造失败时撤销预留
+        template<class... Args>
+        void emplace_at(size_type idx, Args&&... args) {
+            try {
+                mystl::construct(slots_ + idx, mystl::forward<Args>(args)...);
+            } catch (...) {
+                --size_;
+                erase_meta(idx);
+                throw;
+            }
+        }
+
+        iterator iterator_at(size_type idx) noexcept { return iterator(ctrl_ + idx, slots_ + idx); }
+
+    public: // 删除
+        // 删除 pos 处的元素，不使迭代器失效以外的元素移动
+        void erase(const_iterator pos) noexcept {
+            size_type idx = static_cast<size_type>(pos.slot - slots_);
+            mystl::destroy(slots_ + idx);
+            --size_;
+            erase_meta(idx);
+        }
+
+        iterator erase(const_iterator first, const_iterator last) noexcept {
+            while (first != last) {
+                const_iterator next = first;
+                ++next;
+                erase(first);
+                first = next;
+            }
+            return iterator(last.ctrl, const_cast<value_type*>(last.slot));
+        }
+
+        template<class K = key_type>
+        size_type erase_key(const key_arg<K>& key) {
+            size_type idx = find_index(key, hash_of(key));
+            if (idx == npos) return 0;
+            erase(iterator_at(idx));
+            return 1;
+        }
+
+        void clear() noexcept {
+            if (capacity_ == 0) return;
+            for (size_type i = 0; i != capacity_; ++i) {
+                if (__ctrl_is_full(ctrl_[i])) mystl::destroy(slots_ + i);
+            }
+            reset_ctrl();
+            size_ = 0;
+            growth_left_ = __capacity_to_growth(capacity_);
+        }
+
+        void swap(hashtable& rhs) noexcept {
+            mystl::swap(ctrl_, rhs.ctrl_);
+            mystl::swap(slots_, rhs.slots_);
+            mystl::swap(size_, rhs.size_);
+            mystl::swap(capacity_, rhs.capacity_);
+            mystl::swap(growth_left_, rhs.growth_left_);
+            mystl::swap(hash_, rhs.hash_);
+            mystl::swap(equal_, rhs.equal_);
+        }
+
+    private: // 辅助函数
+        template<class K>
+        size_type hash_of(const K& key) const { return __hash_mix(hash_(key)); }
+
+        template<class K>
+        size_type find_index(const K& key, size_type h) const {
+            __probe_seq seq(__hash_h1(h), capacity_);
+            const __ctrl_t h2 = __hash_h2(h);
+            while (true) {
+                __group g(ctrl_ + seq.offset());
+                for (auto m = g.match(h2); m; m.next()) {
+                    size_type idx = seq.offset(m.lowest());
+                    if (equal_(get_key_(slots_[idx]), key)) return idx;
+                }
+                if (g.match_empty()) return npos;
+                seq.next();
+            }
+        }
+
+        size_type find_first_non_full(size_type h) const noexcept {
+            __probe_seq seq(__hash_h1(h), capacity_);
+            while (true) {
+                auto m = __group(ctrl_ + seq.offset()).match_empty_or_deleted();
+                if (m) return seq.offset(m.lowest());
+                seq.next();
+            }
+        }
+
+        size_type prepare_insert(size_type h) {
+            size_type target = find_first_non_full(h);
+            if (growth_left_ == 0 && ctrl_[target] != __ctrl_deleted) {
+                rehash_and_grow_if_necessary();
+                target = find_first_non_full(h);
+            }
+            ++size_;
+            growth_left_ -= (ctrl_[target] == __ctrl_empty);
+            set_ctrl(target, __hash_h2(h));
+            return target;
+        }
+
+        // 已删除位较多时在原数组上清除已删除标记即可回收空间，否则容量翻倍。
+        // 元素移动可能抛异常时无法安全地原地整理，改为重新分配同样大小的数组
+        void rehash_and_grow_if_necessary() {
+            if (capacity_ == 0) {
+                resize(__group::width - 1);
+            } else if (size_ * 32 <= capacity_ * 25) {
+                if constexpr (std::is_nothrow_move_constructible<value_type>::value) {
+                    drop_deletes_without_resize();
+                } else {
+                    resize(capacity_);
+                }
+            } else {
+                resize(capacity_ * 2 + 1);
+            }
+        }
+
+        // 不分配内存地清除已删除标记：先把已删除位标为空位、已占用位标为已删除（表示待安置），
+        // 再把每个待安置的元素放到其探测序列中第一个非满的位置。与原位置同组时不必移动；
+        // 目标是空位时直接搬过去；目标仍是待安置元素时两者交换，并重新处理当前位置
+        void drop_deletes_without_resize() {
+            for (size_type i = 0; i != capacity_; ++i)
+                ctrl_[i] = __ctrl_is_full(ctrl_[i]) ? __ctrl_deleted : __ctrl_empty;
+            ctrl_[capacity_] = __ctrl_sentinel;
+            memcpy(ctrl_ + capacity_ + 1, ctrl_, __group::width - 1);
+
+            alignas(value_type) unsigned char buf[sizeof(value_type)];
+            value_type* temp = reinterpret_cast<value_type*>(buf);
+            for (size_type i = 0; i != capacity_; ++i) {
+                if (ctrl_[i] != __ctrl_deleted) continue;
+                const size_type h = hash_of(get_key_(slots_[i]));
+                const size_type target = find_first_non_full(h);
+                const size_type probe = __probe_seq(__hash_h1(h), capacity_).offset();
+                // 位置在探测序列中所属的组
+                auto group_of = [&](size_type pos) { return ((pos - probe) & capacity_) / __group::width; };
+                if (group_of(i) == group_of(target)) {
+                    set_ctrl(i, __hash_h2(h));
+                } else if (ctrl_[target] == __ctrl_empty) {
+                    mystl::construct(slots_ + target, mystl::move(slots_[i]));
+                    mystl::destroy(slots_ + i);
+                    set_ctrl(target, __hash_h2(h));
+                    set_ctrl(i, __ctrl_empty);
+                } else {
+                    set_ctrl(target, __hash_h2(h));
+                    mystl::construct(temp, mystl::move(slots_[i]));
+                    mystl::destroy(slots_ + i);
+                    mystl::construct(slots_ + i, mystl::move(slots_[target]));
+                    mystl::destroy(slots_ + target);
+                    mystl::construct(slots_ + target, mystl::move(*temp));
+                    mystl::destroy(temp);
+                    --i;
+                }
+            }
+            growth_left_ = __capacity_to_growth(capacity_) - size_;
+        }
+
+        // 同时写入原位与末尾的复制字节
+        void set_ctrl(size_type i, __ctrl_t h) noexcept {
+            ctrl_[i] = h;
+            ctrl_[((i - (__group::width - 1)) & capacity_) + (__group::width - 1)] = h;
+        }
+
+        // 若 idx 所在的任意一个窗口里都存在空位，说明没有探测序列曾因此处已满而越过它，
+        // 可以直接标记为空位而不必留下墓碑
+        void erase_meta(size_type idx) noexcept {
+            const size_type before = (idx - __group::width) & capacity_;
+            const auto empty_after = __group(ctrl_ + idx).match_empty();
+            const auto empty_before = __group(ctrl_ + before).match_empty();
+            const bool was_never_full = empty_before && empty_after &&
+                static_cast<size_type>(empty_after.trailing_zeros() + empty_before.leading_zeros()) < __group::width;
+            set_ctrl(idx, was_never_full ? __ctrl_empty : __ctrl_deleted);
+            growth_left_ += was_never_full;
+        }
+
+        void reset_ctrl() noexcept {
+            memset(ctrl_, __ctrl_empty, capacity_ + __group::width);
+            ctrl_[capacity_] = __ctrl_sentinel;
+        }
+
+        void initialize_slots(size_type cap) {
+            __ctrl_t* ctrl = ctrl_allocator::allocate(cap + __group::width);
+            try {
+                slots_ = slot_allocator::allocate(cap);
+            } catch (...) {
+                ctrl_allocator::deallocate(ctrl, cap + __group::width);
+                throw;
+            }
+            ctrl_ = ctrl;
+            capacity_ = cap;
+            reset_ctrl();
+            growth_left_ = __capacity_to_growth(cap) - size_;
+        }
+
+        // 把所有元素搬到容量为 new_cap 的新数组中，已删除标记随之消失
+        void resize(size_type new_cap) {
+            __ctrl_t* old_ctrl = ctrl_;
+            value_type* old_slots = slots_;
+            const size_type old_cap = capacity_;
+
+            initialize_slots(new_cap);
+            for (size_type i = 0; i != old_cap; ++i) {
+                if (!__ctrl_is_full(old_ctrl[i])) continue;
+                size_type h = hash_of(get_key_(old_slots[i]));
+                size_type target = find_first_non_full(h);
+                set_ctrl(target, __hash_h2(h));
+                mystl::construct(slots_ + target, mystl::move(old_slots[i]));
+                mystl::destroy(old_slots + i);
+            }
+            if (old_cap) {
+                ctrl_allocator::deallocate(old_ctrl, old_cap + __group::width);
+                slot_allocator::deallocate(old_slots, old_cap);
+            }
+        }
+
+        void destroy_and_deallocate() noexcept {
+            if (capacity_ == 0) return;
+            for (size_type i = 0; i != capacity_; ++i) {
+                if (__ctrl_is_full(ctrl_[i])) mystl::destroy(slots_ + i);
+            }
+            ctrl_allocator::deallocate(ctrl_, capacity_ + __group::width);
+            slot_allocator::deallocate(slots_, capacity_);
+        }
+
+        void reset() noexcept {
+            ctrl_ = __empty_group();
+            slots_ = nullptr;
+            size_ = capacity_ = growth_left_ = 0;
+        }
+    };
+
+    template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey, class Alloc>
+    constexpr typename hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::size_type
+        hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::npos;
+
+} // namespace mystl
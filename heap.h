@@ -0,0 +1,192 @@
+#pragma once
+
+#include "iterator.h"
+#include "algobase.h"
+#include "functional.h"
+
+#include <cstddef>
+
+// 堆算法：push_heap、pop_heap、make_heap、sort_heap、is_heap
+// 默认使用 less，堆顶为最大元素；所有移动均采用"空洞"方式，每层只做一次 move
+namespace mystl {
+
+    // 把 value 从 hole 处向上调整（不超过 top）
+    template<class RandomIter, class Distance, class T, class Compare>
+    void __push_heap_aux(RandomIter first, Distance hole, Distance top, T value, Compare& comp) {
+        Distance parent = (hole - 1) / 2;
+        while (hole > top && comp(*(first + parent), value)) {
+            *(first + hole) = mystl::move(*(first + parent));
+            hole = parent;
+            parent = (hole - 1) / 2;
+        }
+        *(first + hole) = mystl::move(value);
+    }
+
+    // 新元素位于 last - 1，[first, last - 1) 已是堆
+    template<class RandomIter, class Compare>
+    inline void push_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        if (last - first < 2) return;
+        value_type_t<RandomIter> value = mystl::move(*(last - 1));
+        mystl::__push_heap_aux(first, Distance((last - first) - 1), Distance(0), mystl::move(value), comp);
+    }
+
+    template<class RandomIter>
+    inline void push_heap(RandomIter first, RandomIter last) {
+        mystl::push_heap(first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+
+    // 空洞从 hole 一路下沉到叶子（每层只比较两个子节点），再把 value 向上调整
+    template<class RandomIter, class Distance, class T, class Compare>
+    void __adjust_heap(RandomIter first, Distance hole, Distance len, T value, Compare& comp) {
+        const Distance top = hole;
+        Distance second = 2 * hole + 2;
+        while (second < len) {
+            if (comp(*(first + second), *(first + (second - 1)))) --second;
+            *(first + hole) = mystl::move(*(first + second));
+            hole = second;
+            second = 2 * (second + 1);
+        }
+        if (second == len) {// 只有左子节点
+            *(first + hole) = mystl::move(*(first + (second - 1)));
+            hole = second - 1;
+        }
+        mystl::__push_heap_aux(first, hole, top, mystl::move(value), comp);
+    }
+
+    // 把堆顶移到 last - 1，[first, last - 1) 重新成为堆
+    template<class RandomIter, class Compare>
+    inline void pop_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        if (last - first < 2) return;
+        value_type_t<RandomIter> value = mystl::move(*(last - 1));
+        *(last - 1) = mystl::move(*first);
+        mystl::__adjust_heap(first, Distance(0), Distance((last - first) - 1), mystl::move(value), comp);
+    }
+
+    template<class RandomIter>
+    inline void pop_heap(RandomIter first, RandomIter last) {
+        mystl::pop_heap(first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+
+    // 自底向上建堆，O(n)
+    template<class RandomIter, class Compare>
+    void make_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        const Distance len = last - first;
+        if (len < 2) return;
+        Distance parent = (len - 2) / 2;
+        while (true) {
+            value_type_t<RandomIter> value = mystl::move(*(first + parent));
+            mystl::__adjust_heap(first, parent, len, mystl::move(value), comp);
+            if (parent == 0) return;
+            --parent;
+        }
+    }
+
+    template<class RandomIter>
+    inline void make_heap(RandomIter first, RandomIter last) {
+        mystl::make_heap(first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+
+    // 反复 pop_heap，得到按 comp 升序的序列
+    template<class RandomIter, class Compare>
+    void sort_heap(RandomIter first, RandomIter last, Compare comp) {
+        while (last - first > 1) mystl::pop_heap(first, last--, comp);
+    }
+
+    template<class RandomIter>
+    inline void sort_heap(RandomIter first, RandomIter last) {
+        mystl::sort_heap(first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+
+    template<class RandomIter, class Compare>
+    bool is_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        const Distance len = last - first;
+        for (Distance child = 1; child < len; ++child) {
+            if (comp(*(first + (child - 1) / 2), *(first + child))) return false;
+        }
+        return true;
+    }
+
+    template<class RandomIter>
+    inline bool is_heap(RandomIter first, RandomIter last) {
+        return mystl::is_heap(first, last, mystl::less<value_type_t<RandomIter>>());
+    }
+
+} // namespace mystl
+
+
+// d 叉堆算法：节点 i 的子节点为 d*i+1 ... d*i+d
+// 树高降为 log_d(n)，一个节点的子节点相邻存放，d = 4 时 int 的子节点刚好位于同一 cache line
+namespace mystl {
+
+    template<size_t D, class RandomIter, class Distance, class T, class Compare>
+    void __dary_sift_up(RandomIter first, Distance hole, T value, Compare& comp) {
+        while (hole > 0) {
+            Distance parent = (hole - 1) / Distance(D);
+            if (!comp(*(first + parent), value)) break;
+            *(first + hole) = mystl::move(*(first + parent));
+            hole = parent;
+        }
+        *(first + hole) = mystl::move(value);
+    }
+
+    template<size_t D, class RandomIter, class Distance, class T, class Compare>
+    void __dary_sift_down(RandomIter first, Distance hole, Distance len, T value, Compare& comp) {
+        while (true) {
+            const Distance child = Distance(D) * hole + 1;
+            if (child >= len) break;
+            const Distance end = mystl::min(child + Distance(D), len);
+            Distance best = child;
+            for (Distance c = child + 1; c < end; ++c) {
+                if (comp(*(first + best), *(first + c))) best = c;
+            }
+            if (!comp(value, *(first + best))) break;
+            *(first + hole) = mystl::move(*(first + best));
+            hole = best;
+        }
+        *(first + hole) = mystl::move(value);
+    }
+
+    template<size_t D, class RandomIter, class Compare>
+    inline void dary_push_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        if (last - first < 2) return;
+        value_type_t<RandomIter> value = mystl::move(*(last - 1));
+        mystl::__dary_sift_up<D>(first, Distance((last - first) - 1), mystl::move(value), comp);
+    }
+
+    template<size_t D, class RandomIter, class Compare>
+    inline void dary_pop_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        if (last - first < 2) return;
+        value_type_t<RandomIter> value = mystl::move(*(last - 1));
+        *(last - 1) = mystl::move(*first);
+        mystl::__dary_sift_down<D>(first, Distance(0), Distance((last - first) - 1), mystl::move(value), comp);
+    }
+
+    template<size_t D, class RandomIter, class Compare>
+    void dary_make_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        const Distance len = last - first;
+        if (len < 2) return;
+        for (Distance parent = (len - 2) / Distance(D); ; --parent) {
+            value_type_t<RandomIter> value = mystl::move(*(first + parent));
+            mystl::__dary_sift_down<D>(first, parent, len, mystl::move(value), comp);
+            if (parent == 0) return;
+        }
+    }
+
+    template<size_t D, class RandomIter, class Compare>
+    bool dary_is_heap(RandomIter first, RandomIter last, Compare comp) {
+        using Distance = difference_type_t<RandomIter>;
+        const Distance len = last - first;
+        for (Distance child = 1; child < len; ++child) {
+            if (comp(*(first + (child - 1) / Distance(D)), *(first + child))) return false;
+        }
+        return true;
+    }
+
+} // namespace mystl
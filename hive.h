@@ -0,0 +1,497 @@
+#pragma once
+
+#include "iterator.h"
+#include "allocator.h"
+#include "algobase.h"
+#include "construct.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>  // aligned_storage
+
+// hive：元素地址稳定的无序容器（colony / std::hive 的思路）
+// 元素放在容量按几何级数增长的块中，块由双向链表串起来；删除只析构元素并把槽位标记为空，
+// 不移动其他元素，因此除被删元素外的指针、引用、迭代器始终有效。
+// 每个块有一个跳跃计数跳表（jump-counting skipfield）：连续的空槽组成一段，段首与段尾记录段长，
+// 遍历时一次跳过整段；各段的段首槽位里存放空段链表的链接，插入时优先复用，插入、删除都是 O(1)。
+// 元素的遍历顺序不是插入顺序
+namespace mystl {
+
+    constexpr size_t __hive_min_block = 8;
+    constexpr size_t __hive_max_block = 8192;   // 块内下标与段长都用 16 位保存
+    constexpr uint16_t __hive_npos = 0xFFFF;
+
+    // 哨兵节点的跳表：只有一个恒为 0 的槽，遍历走到哨兵时停在 (哨兵, 0)
+    inline uint16_t __hive_sentinel_skip[1] = {0};
+
+    // 空段链表的链接，存放在每段段首的槽位中
+    struct __hive_free_links {
+        uint16_t prev;
+        uint16_t next;
+    };
+
+    template<class T>
+    union __hive_slot {
+        __hive_free_links links;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type value;
+    };
+
+    struct __hive_block_base {
+        __hive_block_base* prev;
+        __hive_block_base* next;
+        uint16_t* skip;     // used + 1 个有效项，skip[used] 恒为 0
+        uint16_t used;      // [0, used) 为构造过的槽位（其中可能有空槽），之后的槽位从未使用
+    };
+
+    // 除哨兵外，链表中的每个块至少有一个元素，块变空时立即释放
+    template<class T>
+    struct __hive_block : public __hive_block_base {
+        __hive_block* prev_free;    // 有空槽的块组成的链表
+        __hive_block* next_free;
+        __hive_slot<T>* slots;
+        uint16_t capacity;
+        uint16_t size;
+        uint16_t free_head;         // 第一个空段的段首，没有空段时为 __hive_npos
+
+        T* value(size_t i) noexcept { return reinterpret_cast<T*>(&slots[i].value); }
+        __hive_free_links& links(size_t i) noexcept { return slots[i].links; }
+    };
+}
+
+
+// 迭代器定义
+namespace mystl {
+    template<class T, class Ref, class Ptr>
+    struct __hive_iterator {
+        using iterator = __hive_iterator<T, T &, T *>;
+        using const_iterator = __hive_iterator<T, const T &, const T *>;
+        using self = __hive_iterator;
+
+        using iterator_category = bidirectional_iterator_tag;
+        using value_type = T;
+        using pointer = Ptr;
+        using reference = Ref;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using base_ptr = __hive_block_base *;
+        using block_ptr = __hive_block<T> *;
+
+        // 数据成员
+        base_ptr node;      // 所在块
+        size_type idx;      // 块内下标
+
+        __hive_iterator() : node(nullptr), idx(0) {}
+        __hive_iterator(base_ptr n, size_type i) : node(n), idx(i) {}
+        __hive_iterator(const iterator &rhs) : node(rhs.node), idx(rhs.idx) {}
+        self &operator=(const self &) = default;
+
+        reference operator*() const { return *static_cast<block_ptr>(node)->value(idx); }
+        pointer operator->() const { return &(operator*()); }
+
+        // 下一个槽位若是空段的段首，按段长整段跳过；走完一块后转到下一块的第一个元素
+        self &operator++() {
+            ++idx;
+            idx += node->skip[idx];
+            if (idx == node->used) {
+                node = node->next;
+                idx = node->skip[0];
+            }
+            return *this;
+        }
+
+        self operator++(int) {
+            self temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        // 前一个槽位若是空段的段尾，按段长跳到段首之前；空段一直延伸到块首时转到前一块
+        self &operator--() {
+            while (true) {
+                if (idx == 0) {
+                    node = node->prev;
+                    idx = node->used;
+                }
+                --idx;
+                const size_type run = node->skip[idx];
+                if (run == 0) return *this;
+                if (run == idx + 1) {
+                    idx = 0;
+                    continue;
+                }
+                idx -= run;
+                return *this;
+            }
+        }
+
+        self operator--(int) {
+            self temp = *this;
+            --*this;
+            return temp;
+        }
+    };
+
+    template<class T, class RefL, class PtrL, class RefR, class PtrR>
+    inline bool operator==(const __hive_iterator<T, RefL, PtrL> &lhs,
+                           const __hive_iterator<T, RefR, PtrR> &rhs) {
+        return lhs.node == rhs.node && lhs.idx == rhs.idx;
+    }
+
+    template<class T, class RefL, class PtrL, class RefR, class PtrR>
+    inline bool operator!=(const __hive_iterator<T, RefL, PtrL> &lhs,
+                           const __hive_iterator<T, RefR, PtrR> &rhs) {
+        return !(lhs == rhs);
+    }
+} // namespace mystl
+
+
+namespace mystl {
+
+    template<class T, class Alloc = simpleAlloc<T>>
+    class hive {
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = const T *;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = __hive_iterator<T, T &, T *>;
+        using const_iterator = __hive_iterator<T, const T &, const T *>;
+        using reverse_iterator = __reverse_iterator<iterator>;
+        using const_reverse_iterator = __reverse_iterator<const_iterator>;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private: // 块的创建与销毁
+        using base_node = __hive_block_base;
+        using block = __hive_block<T>;
+        using slot = __hive_slot<T>;
+        using base_allocator = typename __rebind_alloc<Alloc, base_node>::type;
+        using block_allocator = typename __rebind_alloc<Alloc, block>::type;
+        using slot_allocator = typename __rebind_alloc<Alloc, slot>::type;
+        using skip_allocator = typename __rebind_alloc<Alloc, uint16_t>::type;
+
+        block* create_block(size_type capacity);
+        void destroy_block(block* b) noexcept;
+
+    private: // 哨兵节点，只分配链接部分，used 恒为 0
+        base_node* _node;
+        block* _free_blocks;    // 有空槽的块
+        size_type _size;
+        size_type _capacity;
+
+    private: // aux interface
+        void empty_initialized();
+        void link_free_block(block* b) noexcept;
+        void unlink_free_block(block* b) noexcept;
+        void replace_run(block* b, size_type from, size_type to) noexcept;
+        void unlink_run(block* b, size_type start) noexcept;
+        void release_block(block* b) noexcept;
+
+    public: // 迭代器相关操作
+        iterator               begin()         noexcept { return iterator(_node->next, _node->next->skip[0]); }
+        const_iterator         begin()   const noexcept { return const_iterator(_node->next, _node->next->skip[0]); }
+        iterator               end()           noexcept { return iterator(_node, 0); }
+        const_iterator         end()     const noexcept { return const_iterator(_node, 0); }
+        reverse_iterator       rbegin()        noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator       rend()          noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+        const_iterator         cbegin()  const noexcept { return begin(); }
+        const_iterator         cend()    const noexcept { return end(); }
+
+        // 由元素地址得到迭代器，p 必须指向本容器中的元素；按块查找，块数为 O(log n)
+        iterator get_iterator(const_pointer p) noexcept;
+        const_iterator get_iterator(const_pointer p) const noexcept {
+            return const_cast<hive*>(this)->get_iterator(p);
+        }
+
+    public: // 容量操作
+        size_type size() const noexcept { return _size; }
+        bool empty() const noexcept { return _size == 0; }
+        size_type capacity() const noexcept { return _capacity; }
+
+    public: // 构造、复制、移动、析构函数
+        hive() { empty_initialized(); }
+        explicit hive(size_type n, const value_type& value = value_type()) {
+            empty_initialized();
+            for (; n > 0; --n) insert(value);
+        }
+
+        template<class InputIterator, class = enable_if_t<!is_integral<InputIterator>::value>>
+        hive(InputIterator first, InputIterator last) {
+            empty_initialized();
+            for (; first != last; ++first) insert(*first);
+        }
+
+        hive(std::initializer_list<value_type> il) : hive(il.begin(), il.end()) {}
+
+        hive(const hive& rhs) : hive(rhs.begin(), rhs.end()) {}
+
+        hive(hive&& rhs) noexcept {
+            empty_initialized();
+            swap(rhs);
+        }
+
+        ~hive() {
+            clear();
+            base_allocator::deallocate(_node);
+        }
+
+        hive& operator=(const hive& rhs) {
+            if (this != &rhs) {
+                hive temp(rhs);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        hive& operator=(hive&& rhs) noexcept {
+            if (this != &rhs) {
+                clear();
+                swap(rhs);
+            }
+            return *this;
+        }
+
+    public: // swap
+        void swap(hive& rhs) noexcept {
+            mystl::swap(_node, rhs._node);
+            mystl::swap(_free_blocks, rhs._free_blocks);
+            mystl::swap(_size, rhs._size);
+            mystl::swap(_capacity, rhs._capacity);
+        }
+
+    public: // 插入与删除
+        // 优先复用空槽，其次追加到最后一块，都不行时分配新块；不使任何迭代器失效
+        template<class... Args>
+        iterator emplace(Args&&... args);
+        iterator insert(const value_type& val) { return emplace(val); }
+        iterator insert(value_type&& val) { return emplace(mystl::move(val)); }
+
+        // 返回下一个元素；只有指向被删元素的迭代器失效
+        iterator erase(const_iterator pos);
+        iterator erase(const_iterator first, const_iterator last);
+        void clear() noexcept;
+    };
+
+
+    template<class T, class Alloc>
+    inline void hive<T, Alloc>::empty_initialized() {
+        _node = base_allocator::allocate();
+        _node->prev = _node;
+        _node->next = _node;
+        _node->skip = __hive_sentinel_skip;
+        _node->used = 0;
+        _free_blocks = nullptr;
+        _size = 0;
+        _capacity = 0;
+    }
+
+    template<class T, class Alloc>
+    typename hive<T, Alloc>::block* hive<T, Alloc>::create_block(size_type capacity) {
+        block* b = block_allocator::allocate();
+        try {
+            b->slots = slot_allocator::allocate(capacity);
+            try {
+                b->skip = skip_allocator::allocate(capacity + 1);
+            } catch (...) {
+                slot_allocator::deallocate(b->slots, capacity);
+                throw;
+            }
+        } catch (...) {
+            block_allocator::deallocate(b);
+            throw;
+        }
+        for (size_type i = 0; i <= capacity; ++i) b->skip[i] = 0;
+        b->used = 0;
+        b->capacity = static_cast<uint16_t>(capacity);
+        b->size = 0;
+        b->free_head = __hive_npos;
+        b->prev_free = b->next_free = nullptr;
+        return b;
+    }
+
+    template<class T, class Alloc>
+    void hive<T, Alloc>::destroy_block(block* b) noexcept {
+        skip_allocator::deallocate(b->skip, b->capacity + 1);
+        slot_allocator::deallocate(b->slots, b->capacity);
+        block_allocator::deallocate(b);
+    }
+
+    template<class T, class Alloc>
+    inline void hive<T, Alloc>::link_free_block(block* b) noexcept {
+        b->prev_free = nullptr;
+        b->next_free = _free_blocks;
+        if (_free_blocks) _free_blocks->prev_free = b;
+        _free_blocks = b;
+    }
+
+    template<class T, class Alloc>
+    inline void hive<T, Alloc>::unlink_free_block(block* b) noexcept {
+        if (b->prev_free) b->prev_free->next_free = b->next_free;
+        else _free_blocks = b->next_free;
+        if (b->next_free) b->next_free->prev_free = b->prev_free;
+    }
+
+    // 空段的段首由 from 变为 to，链表中的位置不变
+    template<class T, class Alloc>
+    inline void hive<T, Alloc>::replace_run(block* b, size_type from, size_type to) noexcept {
+        const __hive_free_links links = b->links(from);
+        b->links(to) = links;
+        if (links.prev != __hive_npos) b->links(links.prev).next = static_cast<uint16_t>(to);
+        else b->free_head = static_cast<uint16_t>(to);
+        if (links.next != __hive_npos) b->links(links.next).prev = static_cast<uint16_t>(to);
+    }
+
+    template<class T, class Alloc>
+    inline void hive<T, Alloc>::unlink_run(block* b, size_type start) noexcept {
+        const __hive_free_links links = b->links(start);
+        if (links.prev != __hive_npos) b->links(links.prev).next = links.next;
+        else b->free_head = links.next;
+        if (links.next != __hive_npos) b->links(links.next).prev = links.prev;
+    }
+
+    template<class T, class Alloc>
+    void hive<T, Alloc>::release_block(block* b) noexcept {
+        if (b->free_head != __hive_npos) unlink_free_block(b);
+        b->prev->next = b->next;
+        b->next->prev = b->prev;
+        _capacity -= b->capacity;
+        destroy_block(b);
+    }
+
+    template<class T, class Alloc>
+    template<class... Args>
+    typename hive<T, Alloc>::iterator hive<T, Alloc>::emplace(Args&&... args) {
+        if (block* b = _free_blocks) {// 取第一个空段的段首，段缩短一格
+            const size_type i = b->free_head;
+            const size_type run = b->skip[i];
+            const __hive_free_links links = b->links(i);
+            construct(b->value(i), mystl::forward<Args>(args)...);
+            b->skip[i] = 0;
+            if (run > 1) {
+                b->skip[i + 1] = b->skip[i + run - 1] = static_cast<uint16_t>(run - 1);
+                b->links(i + 1) = links;
+                b->free_head = static_cast<uint16_t>(i + 1);
+                if (links.next != __hive_npos) b->links(links.next).prev = static_cast<uint16_t>(i + 1);
+            } else {
+                b->free_head = links.next;
+                if (links.next != __hive_npos) b->links(links.next).prev = __hive_npos;
+                else unlink_free_block(b);
+            }
+            ++b->size;
+            ++_size;
+            return iterator(b, i);
+        }
+
+        base_node* tail = _node->prev;
+        if (tail != _node && tail->used < static_cast<block*>(tail)->capacity) {
+            block* b = static_cast<block*>(tail);
+            const size_type i = b->used;
+            construct(b->value(i), mystl::forward<Args>(args)...);
+            ++b->used;
+            ++b->size;
+            ++_size;
+            return iterator(b, i);
+        }
+
+        // 新块容量为最后一块的两倍，不超过 __hive_max_block
+        size_type capacity = __hive_min_block;
+        if (tail != _node) {
+            capacity = 2 * static_cast<size_type>(static_cast<block*>(tail)->capacity);
+            if (capacity > __hive_max_block) capacity = __hive_max_block;
+        }
+        block* b = create_block(capacity);
+        try {
+            construct(b->value(0), mystl::forward<Args>(args)...);
+        } catch (...) {
+            destroy_block(b);
+            throw;
+        }
+        b->used = 1;
+        b->size = 1;
+        b->prev = tail;
+        b->next = _node;
+        tail->next = b;
+        _node->prev = b;
+        ++_size;
+        _capacity += capacity;
+        return iterator(b, 0);
+    }
+
+    // 被删槽位与左右相邻的空段合并，只更新合并后段首、段尾的段长以及空段链表
+    template<class T, class Alloc>
+    typename hive<T, Alloc>::iterator hive<T, Alloc>::erase(const_iterator pos) {
+        block* b = static_cast<block*>(pos.node);
+        const size_type i = pos.idx;
+        iterator next(pos.node, pos.idx);
+        ++next;
+        mystl::destroy(b->value(i));
+        --_size;
+        if (--b->size == 0) {
+            release_block(b);
+            return next;
+        }
+
+        uint16_t* skip = b->skip;
+        const size_type left = i > 0 ? skip[i - 1] : 0;
+        const size_type right = i + 1 < b->used ? skip[i + 1] : 0;
+        if (left == 0 && right == 0) {// 新的一段，挂到空段链表头部
+            skip[i] = 1;
+            b->links(i).prev = __hive_npos;
+            b->links(i).next = b->free_head;
+            if (b->free_head != __hive_npos) b->links(b->free_head).prev = static_cast<uint16_t>(i);
+            else link_free_block(b);
+            b->free_head = static_cast<uint16_t>(i);
+        } else if (right == 0) {// 接在左侧段的末尾，段首不变
+            skip[i - left] = skip[i] = static_cast<uint16_t>(left + 1);
+        } else if (left == 0) {// 成为右侧段的新段首
+            skip[i] = skip[i + right] = static_cast<uint16_t>(right + 1);
+            replace_run(b, i + 1, i);
+        } else {// 连接左右两段，右侧段从链表中移除
+            skip[i - left] = skip[i + right] = static_cast<uint16_t>(left + right + 1);
+            unlink_run(b, i + 1);
+        }
+        return next;
+    }
+
+    template<class T, class Alloc>
+    typename hive<T, Alloc>::iterator hive<T, Alloc>::erase(const_iterator first, const_iterator last) {
+        while (first != last) first = erase(first);
+        return iterator(last.node, last.idx);
+    }
+
+    template<class T, class Alloc>
+    void hive<T, Alloc>::clear() noexcept {
+        base_node* p = _node->next;
+        while (p != _node) {
+            block* b = static_cast<block*>(p);
+            p = p->next;
+            for (iterator it(b, b->skip[0]); it.node == b; ++it) mystl::destroy(&*it);
+            destroy_block(b);
+        }
+        _node->prev = _node->next = _node;
+        _free_blocks = nullptr;
+        _size = 0;
+        _capacity = 0;
+    }
+
+    template<class T, class Alloc>
+    typename hive<T, Alloc>::iterator hive<T, Alloc>::get_iterator(const_pointer p) noexcept {
+        for (base_node* n = _node->next; n != _node; n = n->next) {
+            block* b = static_cast<block*>(n);
+            const slot* s = reinterpret_cast<const slot*>(p);
+            if (s >= b->slots && s < b->slots + b->used) return iterator(b, static_cast<size_type>(s - b->slots));
+        }
+        return end();
+    }
+
+    template<class T, class Alloc>
+    inline void swap(hive<T, Alloc>& lhs, hive<T, Alloc>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "list.h"
+
+#include <cstddef>
+#include <cstring>
+
+// 侵入式链表：链接指针（list_hook）直接嵌在元素对象中，链表本身不分配任何内存
+// 一个对象可以带多个 hook，从而同时挂在多个链表上：
+//     struct conn {
+//         mystl::list_hook by_timer;
+//         mystl::list_hook by_state;
+//     };
+//     mystl::intrusive_list<conn, &conn::by_timer> timers;
+// 链表不持有元素，元素的生命周期由使用者管理
+
+namespace mystl {
+    // 链接钩子，未挂入链表时 prev/next 均为 nullptr
+    struct list_hook {
+        list_hook* prev;
+        list_hook* next;
+
+        list_hook() noexcept : prev(nullptr), next(nullptr) {}
+        // 复制对象时不复制链接关系
+        list_hook(const list_hook&) noexcept : prev(nullptr), next(nullptr) {}
+        list_hook& operator=(const list_hook&) noexcept { return *this; }
+        // 对象销毁时自动从链表中摘下
+        ~list_hook() { unlink(); }
+
+        bool is_linked() const noexcept { return next != nullptr; }
+
+        // O(1) 把自身从所在链表摘下，无需知道链表对象
+        void unlink() noexcept {
+            if (next) {
+                __list_unlink(this);
+                prev = next = nullptr;
+            }
+        }
+    };
+
+    // 由 hook 地址反推元素地址
+    // 成员指针无法用于 offsetof。Itanium C++ ABI（GCC、Clang）与 MSVC 都把数据成员指针表示为成员的字节偏移，
+    // 这里直接取出这个偏移；Hook 是模板常量，编译器会把它折叠成常数，不需要任何对象或全局状态
+    template<class T, list_hook T::*Hook>
+    struct __intrusive_node_traits {
+        using link_type = list_hook *;
+
+        static_assert(sizeof(Hook) == sizeof(ptrdiff_t), "data member pointer is not a plain offset on this ABI");
+
+        static ptrdiff_t offset() noexcept {
+            list_hook T::*hook = Hook;
+            ptrdiff_t off;
+            std::memcpy(&off, &hook, sizeof(off));
+            return off;
+        }
+        static T& value(link_type p) noexcept {
+            return *reinterpret_cast<T*>(reinterpret_cast<char*>(p) - offset());
+        }
+        static link_type node_of(T& x) noexcept { return &(x.*Hook); }
+    };
+
+
+    template<class T, list_hook T::*Hook>
+    class intrusive_list {
+    private:
+        using node_traits = __intrusive_node_traits<T, Hook>;
+        using link_type = list_hook *;
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = const T *;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = __list_iterator<T, node_traits>;
+        using const_iterator = __list_const_iterator<T, node_traits>;
+        using reverse_iterator = __reverse_iterator<iterator>;
+        using const_reverse_iterator = __reverse_iterator<const_iterator>;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private: // 哨兵 hook 内嵌在链表对象中，prev 指向尾元素，next 指向头元素
+        list_hook _head;
+
+        link_type head() const noexcept { return const_cast<link_type>(&_head); }
+        void reset() noexcept { _head.prev = _head.next = &_head; }
+
+    public: // 构造、移动、析构函数
+        intrusive_list() noexcept { reset(); }
+        intrusive_list(const intrusive_list&) = delete;
+        intrusive_list& operator=(const intrusive_list&) = delete;
+
+        intrusive_list(intrusive_list&& rhs) noexcept {
+            reset();
+            splice(end(), rhs);
+        }
+
+        intrusive_list& operator=(intrusive_list&& rhs) noexcept {
+            if (this != &rhs) {
+                clear();
+                splice(end(), rhs);
+            }
+            return *this;
+        }
+
+        ~intrusive_list() {
+            clear();
+            _head.prev = _head.next = nullptr;
+        }
+
+    public: // 迭代器相关操作
+        iterator       begin()       noexcept { return iterator(_head.next); }
+        const_iterator begin() const noexcept { return const_iterator(_head.next); }
+        iterator       end()         noexcept { return iterator(head()); }
+        const_iterator end()   const noexcept { return const_iterator(head()); }
+        reverse_iterator       rbegin()       noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator       rend()         noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend()   const noexcept { return const_reverse_iterator(begin()); }
+
+        // 由元素得到其在本链表中的迭代器，元素必须已挂在本链表上
+        static iterator iterator_to(reference x) noexcept { return iterator(node_traits::node_of(x)); }
+
+    public: // 容量操作
+        bool empty() const noexcept { return _head.next == &_head; }
+        // 元素可以自行 unlink，链表不缓存长度，size() 为 O(n)
+        size_type size() const noexcept {
+            size_type n = 0;
+            for (link_type p = _head.next; p != &_head; p = p->next) ++n;
+            return n;
+        }
+        reference front() noexcept { return node_traits::value(_head.next); }
+        const_reference front() const noexcept { return node_traits::value(_head.next); }
+        reference back() noexcept { return node_traits::value(_head.prev); }
+        const_reference back() const noexcept { return node_traits::value(_head.prev); }
+
+    public: // 添加与删除，元素必须未挂在同一 hook 对应的其他链表上
+        iterator insert(iterator pos, reference x) noexcept {
+            link_type p = node_traits::node_of(x);
+            __list_link_before(pos.node, p);
+            return iterator(p);
+        }
+        void push_back(reference x) noexcept { insert(end(), x); }
+        void push_front(reference x) noexcept { insert(begin(), x); }
+
+        // 只摘下元素，不销毁
+        iterator erase(iterator pos) noexcept {
+            link_type next = pos.node->next;
+            pos.node->unlink();
+            return iterator(next);
+        }
+        iterator erase(iterator first, iterator last) noexcept {
+            while (first != last) first = erase(first);
+            return last;
+        }
+        void remove(reference x) noexcept { node_traits::node_of(x)->unlink(); }
+        void pop_front() noexcept { erase(begin()); }
+        void pop_back() noexcept { erase(iterator(_head.prev)); }
+
+        void clear() noexcept {
+            link_type p = _head.next;
+            while (p != &_head) {
+                link_type next = p->next;
+                p->prev = p->next = nullptr;
+                p = next;
+            }
+            reset();
+        }
+
+    public: // splice，与 list 共用 __list_transfer，均为 O(1)
+        void splice(iterator pos, intrusive_list& x) noexcept {
+            if (!x.empty()) __list_transfer(pos.node, x._head.next, x.head());
+        }
+        void splice(iterator pos, intrusive_list&, iterator i) noexcept {
+            iterator j = i;
+            ++j;
+            if (pos == i || pos == j) return;
+            __list_transfer(pos.node, i.node, j.node);
+        }
+        void splice(iterator pos, intrusive_list&, iterator first, iterator last) noexcept {
+            if (first != last) __list_transfer(pos.node, first.node, last.node);
+        }
+
+        void swap(intrusive_list& rhs) noexcept {
+            intrusive_list temp;
+            temp.splice(temp.end(), rhs);
+            rhs.splice(rhs.end(), *this);
+            splice(end(), temp);
+        }
+    };
+
+    template<class T, list_hook T::*Hook>
+    inline void swap(intrusive_list<T, Hook>& lhs, intrusive_list<T, Hook>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
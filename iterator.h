@@ -143,6 +143,11 @@ namespace mystl{
             container->push_back(value);//ǵpush_back
             return *this;
         }
+        back_insert_iterator& operator=(
+            typename Container::value_type&& value) {
+            container->push_back(static_cast<typename Container::value_type&&>(value));
+            return *this;
+        }
 
         //ӿڶback_insert_iteratorãرչ
         back_insert_iterator& operator*() { return *this; }
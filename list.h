@@ -1,8 +1,9 @@
-#pragma
+#pragma once
 #include "iterator.h"
 #include "algobase.h"
 #include "type_traits.h"
 #include "allocator.h"
+#include "functional.h"
 
 
 // 节点定义
@@ -13,16 +14,58 @@ namespace mystl {
         __list_node* prev;
         __list_node* next;
     };
+
+    // 节点访问策略：节点指针类型，以及如何从节点取得元素
+    // intrusive_list 提供自己的策略以复用同一套迭代器
+    template<class T>
+    struct __list_node_traits {
+        using link_type = __list_node<T> *;
+        static T& value(link_type p) noexcept { return p->data; }
+    };
+
+    // 以下链接操作只依赖节点的 prev/next 指针，list 与 intrusive_list 共用
+
+    // 把 p 挂到 pos 之前
+    template<class Node>
+    inline void __list_link_before(Node* pos, Node* p) noexcept {
+        p->prev = pos->prev;
+        p->next = pos;
+        pos->prev->next = p;
+        pos->prev = p;
+    }
+
+    // 把 p 从所在链表摘下
+    template<class Node>
+    inline void __list_unlink(Node* p) noexcept {
+        p->prev->next = p->next;
+        p->next->prev = p->prev;
+    }
+
+    // 把 [first, last) 从原链表断开，挂到 pos 之前
+    template<class Node>
+    inline void __list_transfer(Node* pos, Node* first, Node* last) noexcept {
+        if (pos == last) return;
+        Node* tail = last->prev;
+        Node* head = pos->prev;
+        tail->next = pos;
+        pos->prev = tail; // 尾部连接
+
+        first->prev->next = last;
+        last->prev = first->prev; // 断开旧链
+
+        head->next = first;
+        first->prev = head; // 头部连接
+    }
 }
 
 
 // 迭代器定义
 namespace mystl {
-    template<class T>
+    template<class T, class NodeTraits = __list_node_traits<T>>
     struct __list_iterator {
-        using iterator = __list_iterator<T>;
-        using self = __list_iterator<T>;
-        using link_type = __list_node<T> *;
+        using iterator = __list_iterator<T, NodeTraits>;
+        using self = __list_iterator<T, NodeTraits>;
+        using link_type = typename NodeTraits::link_type;
         using iterator_category = bidirectional_iterator_tag;
         using reference = T &;
         using pointer = T *;
@@ -38,8 +81,8 @@ namespace mystl {
         bool operator==(const self &rhs) const noexcept {return node == rhs.node;}
         bool operator!=(const self &rhs) const noexcept {return node != rhs.node;}
 
-        reference operator*() const {return node->data;}
-        pointer operator->() const {return &(node->data);}
+        reference operator*() const {return NodeTraits::value(node);}
+        pointer operator->() const {return &(operator*());}
 
         self &operator++() {
             node = node->next;
@@ -66,11 +109,11 @@ namespace mystl {
     };
 
 
-    template<class T>
+    template<class T, class NodeTraits = __list_node_traits<T>>
     struct __list_const_iterator {
-        using iterator = __list_iterator<T>;
-        using self = __list_const_iterator<T>;
-        using link_type = __list_node<T> *;
+        using iterator = __list_iterator<T, NodeTraits>;
+        using self = __list_const_iterator<T, NodeTraits>;
+        using link_type = typename NodeTraits::link_type;
         using iterator_category = bidirectional_iterator_tag;
         using reference = const T &;
         using pointer = const T *;
@@ -87,15 +130,15 @@ namespace mystl {
         bool operator==(const self &rhs) const noexcept {return node == rhs.node;}
         bool operator!=(const self &rhs) const noexcept {return node != rhs.node;}
 
-        reference operator*() const {return node->data;}
-        pointer operator->() const {return &(node->data);}
+        reference operator*() const {return NodeTraits::value(node);}
+        pointer operator->() const {return &(operator*());}
 
         self &operator++() {
             node = node->next;
             return *this;
         }
 
-        self &operator++(int i) {
+        self operator++(int i) {
             self temp = *this;
             ++(*this);
             return temp;
@@ -107,7 +150,7 @@ namespace mystl {
             return *this;
         }
 
-        self &operator--(int i) {
+        self operator--(int i) {
             self temp = *this;
             --(*this);
             return temp;
@@ -117,6 +160,62 @@ namespace mystl {
 
 
 namespace mystl {
+    template<class T, class Alloc> class list;
+
+    // 节点句柄：独占一个已从 list 摘下、元素仍然存活的节点
+    // 节点内存来自静态的节点配置器，句柄不依赖原 list 对象，可以交给另一个同类型的 list 插入；
+    // 句柄被丢弃时析构元素并把节点还给 Alloc。默认的 _default_alloc 内存池不是线程安全的，
+    // 要把句柄交给另一线程持有的 list，Alloc 须是线程安全的，如 simpleAlloc<T, malloc_alloc>
+    template<class T, class Alloc>
+    class __list_node_handle {
+        friend class list<T, Alloc>;
+        using list_node = __list_node<T>;
+        using list_node_allocator = typename __rebind_alloc<Alloc, list_node>::type;
+
+    public:
+        using value_type = T;
+
+        __list_node_handle() noexcept : node_(nullptr) {}
+        __list_node_handle(__list_node_handle&& rhs) noexcept : node_(rhs.node_) { rhs.node_ = nullptr; }
+        __list_node_handle& operator=(__list_node_handle&& rhs) noexcept {
+            if (this != &rhs) {
+                reset();
+                node_ = rhs.node_;
+                rhs.node_ = nullptr;
+            }
+            return *this;
+        }
+        __list_node_handle(const __list_node_handle&) = delete;
+        __list_node_handle& operator=(const __list_node_handle&) = delete;
+        ~__list_node_handle() { reset(); }
+
+        bool empty() const noexcept { return node_ == nullptr; }
+        explicit operator bool() const noexcept { return node_ != nullptr; }
+
+        // 元素可以直接改写，再插回时不必重新构造节点
+        value_type& value() const noexcept { return node_->data; }
+
+        void swap(__list_node_handle& rhs) noexcept { mystl::swap(node_, rhs.node_); }
+
+    private:
+        explicit __list_node_handle(list_node* p) noexcept : node_(p) {}
+
+        list_node* release() noexcept {
+            list_node* p = node_;
+            node_ = nullptr;
+            return p;
+        }
+
+        void reset() noexcept {
+            if (node_) {
+                destroy(&node_->data);
+                list_node_allocator::deallocate(node_);
+                node_ = nullptr;
+            }
+        }
+
+        list_node* node_;
+    };
 
     template<class T, class Alloc = simpleAlloc<T>>
     class list {
@@ -133,27 +232,53 @@ namespace mystl {
 
         using size_type = size_t;
         using difference_type = ptrdiff_t;
+        using node_type = __list_node_handle<T, Alloc>;
 
     private: // 节点创建，销毁
         using list_node = __list_node<T>;
-        using list_node_allocator = simpleAlloc<list_node>;
+        using list_node_allocator = typename __rebind_alloc<Alloc, list_node>::type;
 
         list_node* get_node() { return list_node_allocator::allocate();}
         void rm_node(list_node* p) {list_node_allocator::deallocate(p);}
         template<class... Args>
         list_node* create_node(Args&&... args);
-        void destroy_node(list_node * p) { // 两步释放节点，释放节点的数据，释放节点本身
+        void destroy_node(list_node * p) { // 两步释放节点，释放节点的数据，节点本身优先回收进空闲节点缓存
             destroy(&p->data);
-            rm_node(p);
+            put_free_node(p);
         }
 
+        // 空闲节点缓存：元素已析构的裸节点经 next 串成单链表，create_node 优先从这里取
+        list_node* take_free_node() {
+            if (!_free) return get_node();
+            list_node* p = _free;
+            _free = p->next;
+            --_free_size;
+            return p;
+        }
+        void put_free_node(list_node* p) {
+            if (_free_size < _free_limit) {
+                p->next = _free;
+                _free = p;
+                ++_free_size;
+            } else
+                rm_node(p);
+        }
+        void trim_free_nodes(size_type n) noexcept;
+
     private: // 虚拟节点，pre指向尾节点，next指向头节点
         list_node* _node;
         size_type _size;
+        list_node* _free;           // 空闲节点缓存，不随 swap 交换
+        size_type _free_size;
+        size_type _free_limit;      // 缓存上限，默认为 0 即不缓存
     
     private: // aux interface
         void empty_initialized();
         void transfer(iterator position, iterator first, iterator last);
+
+        // 归并排序辅助函数，直接在裸节点上操作，不分配任何内存
+        template<class Compare>
+        static list_node* merge_nodes(list_node* a, list_node* b, Compare& comp);
     
     public:// resize
         void resize(size_type, const value_type &val = value_type());
@@ -193,7 +318,20 @@ namespace mystl {
         value_type& front() {return *begin();}
         value_type& back() {return *(--end());}
 
+    public: // 节点缓存
+        // 设置空闲节点缓存的上限，超出的缓存节点立即释放
+        void set_node_cache_limit(size_type n) noexcept {
+            _free_limit = n;
+            trim_free_nodes(n);
+        }
+        size_type node_cache_limit() const noexcept { return _free_limit; }
+        size_type cached_nodes() const noexcept { return _free_size; }
+        // 预先分配 n 个空闲节点，上限随之提高到至少 n
+        void reserve_nodes(size_type n);
+        void release_node_cache() noexcept { trim_free_nodes(0); }
+
     public: // swap
+        // 只交换元素，两边各自保留自己的空闲节点缓存
         void swap(list& rhs) noexcept {
             mystl::swap(_node, rhs._node);
             mystl::swap(_size, rhs._size);
@@ -216,19 +354,26 @@ namespace mystl {
         }
 
         ~list() {
+            _free_limit = 0;
             clear();
+            trim_free_nodes(0);
             rm_node(_node);
         }
         
         // 复制构造
         list(const list & rhs);
-        list& operator=(list& rhs) noexcept;
+        list& operator=(const list& rhs);
 
         // 移动构造
         list(list &&rhs) noexcept {
             empty_initialized();
             mystl::swap(_node, rhs._node);
-            _size = rhs._size;
+            mystl::swap(_size, rhs._size);
+        }
+        list& operator=(list&& rhs) noexcept {
+            list temp(mystl::move(rhs));
+            swap(temp);
+            return *this;
         }
 
     private: // aux interface for assign
@@ -268,12 +413,29 @@ namespace mystl {
     public: // insert
         iterator insert(iterator pos) {return insert(pos, value_type());}
         iterator insert(iterator pos, const value_type& val);
-        iterator insert(iterator pos, const value_type&& val);
+        iterator insert(iterator pos, value_type&& val);
 
         template<class InputIterator>
         void insert(iterator pos, InputIterator first, InputIterator last) {
             insert_dispatch(pos, first , last, is_integral<InputIterator>());
         }
+
+        // 把句柄持有的节点挂到 pos 之前，不分配；空句柄时什么也不做，返回 pos
+        iterator insert(iterator pos, node_type&& nh) noexcept {
+            if (nh.empty()) return pos;
+            list_node* p = nh.release();
+            __list_link_before(pos.node, p);
+            ++_size;
+            return iterator(p);
+        }
+
+    public: // 节点摘取
+        // 把 pos 处的节点连同元素摘下交给句柄，不析构元素也不释放节点
+        node_type extract(iterator pos) noexcept {
+            __list_unlink(pos.node);
+            --_size;
+            return node_type(pos.node);
+        }
     
     public:
         iterator erase(iterator);
@@ -285,11 +447,11 @@ namespace mystl {
     public: // 添加与删除
         void push_back(const value_type& val) {insert(end(), val);}
 
-        void push_back(const value_type&& val) {emplace_back(mystl::move(val));}
+        void push_back(value_type&& val) {emplace_back(mystl::move(val));}
 
         void push_front(const value_type& val) {insert(begin(), val);}
 
-        void push_front(const value_type&& val) { emplace_front(mystl::move(val)); }
+        void push_front(value_type&& val) { emplace_front(mystl::move(val)); }
 
         void pop_front() { iterator cur = begin(); erase(cur); }
         void pop_back() {
@@ -307,16 +469,47 @@ namespace mystl {
 
     public:// other interface
         void unique();
+        // transfer 只重接指针，元素个数由 splice 在两个 list 之间结算
         void splice(iterator pos, list &rhs) {
-            if (!rhs.empty()) transfer(pos, rhs.begin(), rhs.end());
+            if (this == &rhs || rhs.empty()) return;
+            transfer(pos, rhs.begin(), rhs.end());
+            _size += rhs._size;
+            rhs._size = 0;
         }
         void splice(iterator, list &, iterator);
-        void splice(iterator pos, list &, iterator first, iterator last) {
-            if (first != last) transfer(pos, first, last);
+        void splice(iterator pos, list &rhs, iterator first, iterator last) {
+            if (first == last) return;
+            if (this != &rhs) {
+                size_type n = mystl::distance(first, last);
+                _size += n;
+                rhs._size -= n;
+            }
+            transfer(pos, first, last);
         }
-        void merge(list &);
+        // 把 [first, last) 依次给出的 rhs 中的各个节点按顺序挂到 pos 之前，元素个数最后一次性结算
+        // 各迭代器须指向 rhs 中互不相同的元素；rhs 就是本 list 时，与 pos 相同的元素保持原位
+        template<class InputIterator>
+        void splice_batch(iterator pos, list &rhs, InputIterator first, InputIterator last) {
+            size_type n = 0;
+            for (; first != last; ++first) {
+                list_node* p = iterator(*first).node;
+                if (p == pos.node) continue;
+                __list_unlink(p);
+                __list_link_before(pos.node, p);
+                ++n;
+            }
+            if (this != &rhs) {
+                _size += n;
+                rhs._size -= n;
+            }
+        }
+        void merge(list &x) { merge(x, mystl::less<T>()); }
+        template<class Compare>
+        void merge(list &, Compare);
         void reverse();
-        void sort();
+        void sort() { sort(mystl::less<T>()); }
+        template<class Compare>
+        void sort(Compare);
         void remove(const T &);
     };
     
@@ -325,11 +518,11 @@ namespace mystl {
     template<class... Args>
     inline typename list<T, Alloc>::list_node *
     list<T, Alloc>::create_node(Args&&... args) {
-        list_node *p = get_node();
+        list_node *p = take_free_node();
         try {
             construct(&p->data, mystl::forward<Args>(args)...);
-        } catch (std::exception) {
-            rm_node(p);
+        } catch (...) {
+            put_free_node(p);
             throw;
         }
         return p;
@@ -337,12 +530,37 @@ namespace mystl {
 
     template<class T, class Alloc>
     inline void list<T, Alloc>::empty_initialized() {
+        _free = nullptr;
+        _free_size = 0;
+        _free_limit = 0;
         _node = get_node();
         _node->prev = _node;
         _node->next = _node;
         _size = 0;
     }
 
+    // 释放缓存节点直到只剩 n 个
+    template<class T, class Alloc>
+    void list<T, Alloc>::trim_free_nodes(size_type n) noexcept {
+        while (_free_size > n) {
+            list_node* p = _free;
+            _free = p->next;
+            --_free_size;
+            rm_node(p);
+        }
+    }
+
+    template<class T, class Alloc>
+    void list<T, Alloc>::reserve_nodes(size_type n) {
+        if (_free_limit < n) _free_limit = n;
+        while (_free_size < n) {
+            list_node* p = get_node();
+            p->next = _free;
+            _free = p;
+            ++_free_size;
+        }
+    }
+
     template<class T, class Alloc>
     inline void list<T, Alloc>::resize(size_type new_size, const value_type &val) {
         iterator cur = begin();
@@ -371,7 +589,7 @@ namespace mystl {
 
     // 赋值重载
     template<class T, class Alloc>
-    list<T, Alloc>& list<T, Alloc>::operator=(list& rhs) noexcept {
+    list<T, Alloc>& list<T, Alloc>::operator=(const list& rhs) {
         list temp(rhs);
         swap(temp);
         return *this;
@@ -410,22 +628,16 @@ namespace mystl {
     typename list<T, Alloc>::iterator
     list<T, Alloc>::insert(iterator pos, const value_type& val) {
         list_node * temp = create_node(val);
-        temp->next = pos.node;
-        temp->prev = pos.node->prev;
-        pos.node->prev->next = temp;
-        pos.node->prev = temp;
+        __list_link_before(pos.node, temp);
         ++_size;
         return iterator(temp);
     }
 
     template<class T, class Alloc>
     typename list<T, Alloc>::iterator
-    list<T, Alloc>::insert(iterator pos, const value_type&& val) {
+    list<T, Alloc>::insert(iterator pos, value_type&& val) {
         list_node * temp = create_node(mystl::move(val));
-        temp->next = pos.node;
-        temp->prev = pos.node->prev;
-        pos.node->prev->next = temp;
-        pos.node->prev = temp;
+        __list_link_before(pos.node, temp);
         ++_size;
         return iterator(temp);
     }
@@ -447,10 +659,7 @@ namespace mystl {
     template<class... Args>
     inline void list<T, Alloc>::emplace(iterator pos, Args&&... args) {
         list_node* p = create_node(mystl::forward<Args>(args)...);
-        p->prev = pos.node->prev;
-        p->next = pos.node;
-        pos.node->prev->next = p;
-        pos.node->prev = p;
+        __list_link_before(pos.node, p);
         ++_size;
     }
 
@@ -459,10 +668,7 @@ namespace mystl {
     void list<T, Alloc>::emplace_front(Args&&... args) {
         list_node* p = create_node(mystl::forward<Args>(args)...);
         iterator pos = begin();
-        p->prev = pos.node->prev;
-        p->next = pos.node;
-        pos.node->prev->next = p;
-        pos.node->prev = p;
+        __list_link_before(pos.node, p);
         ++_size;
     }
 
@@ -471,10 +677,7 @@ namespace mystl {
     void list<T, Alloc>::emplace_back(Args&&... args) {
         list_node* p = create_node(mystl::forward<Args>(args)...);
         iterator pos = end();
-        p->prev = pos.node->prev;
-        p->next = pos.node;
-        pos.node->prev->next = p;
-        pos.node->prev = p;
+        __list_link_before(pos.node, p);
         ++_size;
     }
 
@@ -484,9 +687,7 @@ namespace mystl {
     template<class T, class Alloc>
     inline typename list<T, Alloc>::iterator list<T, Alloc>::erase(iterator position) {
         list_node *next_node = position.node->next;
-        list_node *prev_node = position.node->prev;
-        prev_node->next = next_node;
-        next_node->prev = prev_node;
+        __list_unlink(position.node);
         destroy_node(position.node);
         --_size;
         return iterator(next_node);
@@ -500,23 +701,10 @@ namespace mystl {
         return res;
     }
 
-    // 移动链表
+    // 移动链表：把 [first, last) 从原来的 list 断开，加入到当前的 pos 位置，不改动任何一方的 _size
     template<class T, class Alloc>
     inline void list<T, Alloc>::transfer(iterator pos, iterator first, iterator last) {
-        if (pos != last) { 
-            size_type n = mystl::distance(first, last);                  // 从原来的list断开, 加入到当前的pos位置
-            list_node* tail = last.node->prev;
-            list_node* head = pos.node->prev;
-            tail->next = pos.node;
-            pos.node->prev = tail; // 尾部连接
-
-            first.node->prev->next = last.node; 
-            last.node->prev = first.node->prev; // 断开旧链
-
-            head->next = first.node;
-            first.node->prev = head; // 头部连接
-            _size += n;
-        }
+        __list_transfer(pos.node, first.node, last.node);
     }
 
     // 清空链表节点
@@ -564,32 +752,52 @@ namespace mystl {
 
 
     template<class T, class Alloc>
-    inline void list<T, Alloc>::splice(iterator position, list &, iterator i) {
+    inline void list<T, Alloc>::splice(iterator position, list &rhs, iterator i) {
         iterator j = i;
         ++j;
         // i==pos 自身无法插于自身之前
         // j==pos 已处于pos之前
         if (position == i || position == j) return;
         transfer(position, i, j);
+        if (this != &rhs) {
+            ++_size;
+            --rhs._size;
+        }
     }
 
-    // 按顺序融合链表（从小到大），可作为归并排序的辅助函数用来合并两个有序链表
+    // 按顺序融合链表（默认从小到大），可作为归并排序的辅助函数用来合并两个有序链表
+    // 节点直接摘下挂入，x 的哨兵最后整体复位，_size 一次性结算
     template<class T, class Alloc>
-    void list<T, Alloc>::merge(list &x) {
-        iterator first1 = begin();
-        iterator last1 = end();
-        iterator first2 = x.begin();
-        iterator last2 = x.end();
+    template<class Compare>
+    void list<T, Alloc>::merge(list &x, Compare comp) {
+        if (this == &x || x._node->next == x._node) return;
+        list_node* first1 = _node->next;
+        list_node* last1 = _node;
+        list_node* first2 = x._node->next;
+        list_node* last2 = x._node;
 
         while (first1 != last1 && first2 != last2) {
-            if (*first2 < *first1) {
-            iterator next = first2;
-            transfer(first1, first2, ++next);
-            first2 = next;
+            if (comp(first2->data, first1->data)) {
+                list_node* next = first2->next;
+                first2->prev = first1->prev;
+                first2->next = first1;
+                first1->prev->next = first2;
+                first1->prev = first2;
+                first2 = next;
             } else
-            ++first1;
+                first1 = first1->next;
+        }
+        if (first2 != last2) { // x 剩余部分整段接到尾部
+            list_node* tail = last2->prev;
+            first2->prev = last1->prev;
+            last1->prev->next = first2;
+            tail->next = last1;
+            last1->prev = tail;
         }
-        if (first2 != last2) transfer(last1, first2, last2);
+        _size += x._size;
+        x._node->next = x._node;
+        x._node->prev = x._node;
+        x._size = 0;
     }
 
     template<class T, class Alloc>
@@ -605,27 +813,66 @@ namespace mystl {
         }
     }
 
-    // 链表排序
+    // 合并两条以 nullptr 结尾的有序单链表（只使用 next 指针），相等时 a 在前以保证稳定
     template<class T, class Alloc>
-    void list<T, Alloc>::sort() {
+    template<class Compare>
+    typename list<T, Alloc>::list_node *
+    list<T, Alloc>::merge_nodes(list_node* a, list_node* b, Compare& comp) {
+        list_node* head = nullptr;
+        list_node** tail = &head;
+        while (a && b) {
+            if (comp(b->data, a->data)) {
+                *tail = b;
+                b = b->next;
+            } else {
+                *tail = a;
+                a = a->next;
+            }
+            tail = &(*tail)->next;
+        }
+        *tail = a ? a : b;
+        return head;
+    }
+
+    // 链表排序（自底向上的稳定归并排序）
+    // 先把环形链表拆成单链表，bin[i] 中存放长度为 2^i 的有序段，全部归并后再一次性重建 prev 指针
+    // 整个过程只改写节点指针，不创建临时 list，也不调用分配器
+    template<class T, class Alloc>
+    template<class Compare>
+    void list<T, Alloc>::sort(Compare comp) {
         if (_node->next == _node || _node->next->next == _node) return;
-        // 数据缓存区
-        // counter[n]中最多存放2^(n+1)个元素，若大于则与counter[n+1]作归并
-        list carry;
-        list counter[64];
+        _node->prev->next = nullptr;
+        list_node* head = _node->next;
+
+        list_node* bin[64];
         int fill = 0;
-        while (!empty()) {
-            carry.splice(carry.begin(), *this, begin());
+        while (head) {
+            list_node* carry = head;
+            head = head->next;
+            carry->next = nullptr;
             int i = 0;
-            while (i < fill && !counter[i].empty()) {
-            counter[i].merge(carry);
-            carry.swap(counter[i++]);
+            for (; i < fill && bin[i]; ++i) {
+                carry = merge_nodes(bin[i], carry, comp);  // bin[i] 中的元素更靠前
+                bin[i] = nullptr;
             }
-            carry.swap(counter[i]);
+            bin[i] = carry;
             if (i == fill) ++fill;
         }
-        for (int i = 1; i < fill; ++i) counter[i].merge(counter[i - 1]);
-        swap(counter[fill - 1]);
+
+        list_node* result = nullptr;
+        for (int i = 0; i < fill; ++i) {
+            if (bin[i]) result = result ? merge_nodes(bin[i], result, comp) : bin[i];
+        }
+
+        // 重建双向链接并接回哨兵节点
+        list_node* prev = _node;
+        for (list_node* cur = result; cur; cur = cur->next) {
+            prev->next = cur;
+            cur->prev = prev;
+            prev = cur;
+        }
+        prev->next = _node;
+        _node->prev = prev;
     }
 
     template<class T>
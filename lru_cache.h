@@ -0,0 +1,457 @@
+#pragma once
+
+#include "alloc.h"
+#include "allocator.h"
+#include "functional.h"
+#include "hash_fun.h"
+#include "hashtable.h"
+#include "list.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// lru_cache：按最近使用顺序淘汰的键值缓存
+// 条目存放在 list 中，表头最新、表尾最旧，命中时用 splice 把节点挪到表头，O(1) 且不分配；
+// 索引是开放寻址的 hashtable，slot 中只存 list 迭代器，键从节点中读取，不重复保存。
+// 容量以权重计：Weigher 给出每个条目的权重，默认每条记 1 即按条数限制，换成按字节估算的 Weigher 即按字节限制。
+// 插入需要淘汰时，表尾节点经节点句柄摘下、就地改写后挂回表头；索引中积累的已删除标记在原数组上清除，
+// 因此 reserve 之后的稳定状态下 put、erase 都不调用配置器。
+// sharded_lru_cache 按哈希把键分到多个各自加锁的 lru_cache 上，供多个线程共享
+namespace mystl {
+
+    // 每个条目记 1，容量即条数
+    struct lru_unit_weight {
+        template<class K, class V>
+        size_t operator()(const K&, const V&) const noexcept { return 1; }
+    };
+
+    // 命中率与查找延迟统计
+    struct lru_stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t updates = 0;
+        uint64_t evictions = 0;
+        uint64_t rejections = 0;        // 单条权重超过容量而未能放入
+        uint64_t timed_lookups = 0;     // 以下三项只在 record_latency(true) 时统计
+        uint64_t lookup_ns = 0;
+        uint64_t max_lookup_ns = 0;
+
+        double hit_rate() const noexcept {
+            const uint64_t n = hits + misses;
+            return n ? static_cast<double>(hits) / static_cast<double>(n) : 0.0;
+        }
+        double mean_lookup_ns() const noexcept {
+            return timed_lookups ? static_cast<double>(lookup_ns) / static_cast<double>(timed_lookups) : 0.0;
+        }
+
+        lru_stats& operator+=(const lru_stats& rhs) noexcept {
+            hits += rhs.hits;
+            misses += rhs.misses;
+            insertions += rhs.insertions;
+            updates += rhs.updates;
+            evictions += rhs.evictions;
+            rejections += rhs.rejections;
+            timed_lookups += rhs.timed_lookups;
+            lookup_ns += rhs.lookup_ns;
+            if (rhs.max_lookup_ns > max_lookup_ns) max_lookup_ns = rhs.max_lookup_ns;
+            return *this;
+        }
+    };
+
+    template<class Key, class T>
+    struct __lru_entry {
+        Key key;
+        T value;
+        size_t weight;
+
+        template<class V>
+        __lru_entry(const Key& k, V&& v, size_t w) : key(k), value(mystl::forward<V>(v)), weight(w) {}
+    };
+
+    template<class Key, class T, class HashFcn, class EqualKey, class Weigher, class Alloc>
+    class sharded_lru_cache;
+
+    template<class Key, class T, class HashFcn = mystl::hash<Key>, class EqualKey = mystl::equal_to<Key>,
+             class Weigher = lru_unit_weight, class Alloc = simpleAlloc<T>>
+    class lru_cache {
+        template<class, class, class, class, class, class>
+        friend class sharded_lru_cache;
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using hasher = HashFcn;
+        using key_equal = EqualKey;
+        using weigher = Weigher;
+        using size_type = size_t;
+
+    private:
+        using entry = __lru_entry<Key, T>;
+        using list_type = list<entry, typename __rebind_alloc<Alloc, entry>::type>;
+        using list_iterator = typename list_type::iterator;
+
+        struct extract_key {
+            const Key& operator()(const list_iterator& it) const noexcept { return it->key; }
+        };
+
+        using index_type = hashtable<list_iterator, Key, HashFcn, extract_key, EqualKey,
+                                     typename __rebind_alloc<Alloc, list_iterator>::type>;
+        using index_iterator = typename index_type::iterator;
+        // 索引只有在 slot 可无异常移动时才会原地清除已删除标记，reserve 之后不分配依赖于此
+        static_assert(std::is_nothrow_move_constructible<list_iterator>::value,
+                      "lru_cache index slots must be nothrow movable");
+        using clock = std::chrono::steady_clock;
+
+        // 数据成员
+        list_type items_;       // 表头最新，表尾最旧
+        index_type index_;
+        size_type capacity_;
+        size_type weight_;      // 现有条目的权重之和
+        Weigher weigh_;
+        lru_stats stats_;
+        bool timed_;
+
+    public: // 构造、析构函数，索引中的迭代器指向 items_ 的节点，因此不可复制
+        explicit lru_cache(size_type capacity, const hasher& hf = hasher(), const key_equal& eq = key_equal(),
+                           const weigher& w = weigher())
+            : index_(0, hf, eq), capacity_(capacity), weight_(0), weigh_(w), timed_(false) {}
+
+        lru_cache(const lru_cache&) = delete;
+        lru_cache& operator=(const lru_cache&) = delete;
+
+    public: // 容量相关操作
+        bool empty() const noexcept { return index_.empty(); }
+        size_type size() const noexcept { return index_.size(); }
+        size_type capacity() const noexcept { return capacity_; }
+        size_type weight() const noexcept { return weight_; }
+
+        // 调小容量时立即从表尾淘汰
+        void set_capacity(size_type n) {
+            capacity_ = n;
+            evict_to(n);
+        }
+
+        // 预留 n 个条目的索引空间与空闲节点，此后条目数不超过 n 时 put、erase 都不分配
+        void reserve(size_type n) {
+            index_.reserve(n);
+            if (n > size()) items_.reserve_nodes(n - size());
+            if (items_.node_cache_limit() < n) items_.set_node_cache_limit(n);
+        }
+
+    public: // 查找
+        // 命中时把条目挪到表头并返回值的地址，否则返回 nullptr；地址在条目被淘汰或删除前有效
+        mapped_type* get(const key_type& key) {
+            if (!timed_) return lookup(key);
+            const clock::time_point start = clock::now();
+            mapped_type* p = lookup(key);
+            record_lookup(clock::now() - start);
+            return p;
+        }
+
+        // 不改变最近使用顺序，也不计入统计
+        const mapped_type* peek(const key_type& key) const {
+            typename index_type::const_iterator pos = index_.find(key);
+            return pos == index_.end() ? nullptr : &(*pos)->value;
+        }
+
+        bool contains(const key_type& key) const { return index_.find(key) != index_.end(); }
+
+    public: // 插入、删除
+        // 插入或覆盖并移到表头，超出容量时从表尾淘汰；
+        // 单条权重超过容量时不放入（同键的旧条目一并删除），返回 false
+        template<class V>
+        bool put(const key_type& key, V&& value);
+
+        bool erase(const key_type& key) {
+            index_iterator pos = index_.find(key);
+            if (pos == index_.end()) return false;
+            erase_at(pos);
+            return true;
+        }
+
+        void clear() {
+            index_.clear();
+            items_.clear();
+            weight_ = 0;
+        }
+
+    public: // 统计
+        const lru_stats& stats() const noexcept { return stats_; }
+        void reset_stats() noexcept { stats_ = lru_stats(); }
+        // 开启后 get 以 steady_clock 计时，计入 stats 的延迟字段
+        void record_latency(bool on) noexcept { timed_ = on; }
+
+    private: // 辅助函数
+        mapped_type* lookup(const key_type& key) {
+            index_iterator pos = index_.find(key);
+            if (pos == index_.end()) {
+                ++stats_.misses;
+                return nullptr;
+            }
+            ++stats_.hits;
+            touch(*pos);
+            return &(*pos)->value;
+        }
+
+        void touch(list_iterator it) { items_.splice(items_.begin(), items_, it); }
+
+        void record_lookup(clock::duration d) noexcept {
+            const uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+            ++stats_.timed_lookups;
+            stats_.lookup_ns += ns;
+            if (ns > stats_.max_lookup_ns) stats_.max_lookup_ns = ns;
+        }
+
+        // 把表尾条目从索引中删除并扣除权重，节点留给调用者处理
+        void unindex_back() {
+            list_iterator last = items_.end();
+            --last;
+            index_.erase_key(last->key);
+            weight_ -= last->weight;
+            ++stats_.evictions;
+        }
+
+        void evict_to(size_type limit) {
+            while (weight_ > limit) {
+                unindex_back();
+                items_.pop_back();
+            }
+        }
+
+        void erase_at(index_iterator pos) {
+            list_iterator it = *pos;
+            weight_ -= it->weight;
+            index_.erase(pos);
+            items_.erase(it);
+        }
+    };
+
+    template<class Key, class T, class HashFcn, class EqualKey, class Weigher, class Alloc>
+    template<class V>
+    bool lru_cache<Key, T, HashFcn, EqualKey, Weigher, Alloc>::put(const key_type& key, V&& value) {
+        const size_type w = weigh_(key, value);
+        index_iterator pos = index_.find(key);
+        if (pos != index_.end()) {
+            if (w > capacity_) {
+                ++stats_.rejections;
+                erase_at(pos);
+                return false;
+            }
+            list_iterator it = *pos;
+            it->value = mystl::forward<V>(value);
+            weight_ = weight_ - it->weight + w;
+            it->weight = w;
+            touch(it);
+            ++stats_.updates;
+            evict_to(capacity_);    // 表头条目自身不超过容量，不会被淘汰
+            return true;
+        }
+        if (w > capacity_) {
+            ++stats_.rejections;
+            return false;
+        }
+
+        // 先腾出空间，第一个被淘汰的节点留给新条目复用
+        typename list_type::node_type spare;
+        while (weight_ + w > capacity_) {
+            unindex_back();
+            list_iterator last = items_.end();
+            --last;
+            if (spare.empty())
+                spare = items_.extract(last);
+            else
+                items_.erase(last);
+        }
+        if (spare) {
+            entry& e = spare.value();
+            e.key = key;
+            e.value = mystl::forward<V>(value);
+            e.weight = w;
+            items_.insert(items_.begin(), mystl::move(spare));
+        } else
+            items_.emplace_front(key, mystl::forward<V>(value), w);
+
+        try {
+            index_.insert_unique(items_.begin());
+        } catch (...) {
+            items_.pop_front();
+            throw;
+        }
+        weight_ += w;
+        ++stats_.insertions;
+        return true;
+    }
+
+
+    // 分片的并发 LRU 缓存：每个分片是一把 mutex 加一个 lru_cache，按键的哈希选择分片，
+    // 不同分片上的操作互不阻塞；最近使用顺序与容量都只在分片内维护。总容量精确地分给各分片，
+    // 前 capacity % n 个分片各多 1，各分片容量之和恰为 capacity；权重超过所在分片容量的条目会被拒绝。
+    // _default_alloc 的内存池不是线程安全的，因此默认以 malloc_alloc 为底层配置器
+    template<class Key, class T, class HashFcn = mystl::hash<Key>, class EqualKey = mystl::equal_to<Key>,
+             class Weigher = lru_unit_weight, class Alloc = simpleAlloc<T, malloc_alloc>>
+    class sharded_lru_cache {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using hasher = HashFcn;
+        using key_equal = EqualKey;
+        using weigher = Weigher;
+        using size_type = size_t;
+        using cache_type = lru_cache<Key, T, HashFcn, EqualKey, Weigher, Alloc>;
+
+    private:
+        // 各占独立的缓存行，避免相邻分片的锁互相伪共享
+        struct alignas(64) shard {
+            std::mutex mutex;
+            cache_type cache;
+
+            shard(size_type capacity, const hasher& hf, const key_equal& eq, const weigher& w)
+                : cache(capacity, hf, eq, w) {}
+        };
+
+        std::vector<std::unique_ptr<shard>> shards_;
+        size_type mask_;
+        hasher hash_;
+        std::atomic<bool> timed_;
+
+    public: // 构造函数，分片数向上取整到 2 的幂，再减半到不超过 capacity，避免出现容量为 0 的分片
+        explicit sharded_lru_cache(size_type capacity, size_type shards = 16, const hasher& hf = hasher(),
+                                   const key_equal& eq = key_equal(), const weigher& w = weigher())
+            : mask_(0), hash_(hf), timed_(false) {
+            size_type n = 1;
+            while (n < shards) n <<= 1;
+            while (n > 1 && n > capacity) n >>= 1;
+            mask_ = n - 1;
+            const size_type per_shard = capacity / n;
+            const size_type extra = capacity % n;
+            shards_.reserve(n);
+            for (size_type i = 0; i < n; ++i)
+                shards_.emplace_back(new shard(per_shard + (i < extra ? 1 : 0), hf, eq, w));
+        }
+
+        sharded_lru_cache(const sharded_lru_cache&) = delete;
+        sharded_lru_cache& operator=(const sharded_lru_cache&) = delete;
+
+    public: // 容量相关操作，逐个分片加锁求和
+        size_type shard_count() const noexcept { return shards_.size(); }
+
+        // 各分片容量之和
+        size_type capacity() const {
+            size_type n = 0;
+            for (const auto& s : shards_) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                n += s->cache.capacity();
+            }
+            return n;
+        }
+
+        size_type size() const {
+            size_type n = 0;
+            for (const auto& s : shards_) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                n += s->cache.size();
+            }
+            return n;
+        }
+
+        size_type weight() const {
+            size_type n = 0;
+            for (const auto& s : shards_) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                n += s->cache.weight();
+            }
+            return n;
+        }
+
+        void reserve(size_type n) {
+            const size_type per_shard = (n + mask_) / (mask_ + 1);
+            for (auto& s : shards_) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                s->cache.reserve(per_shard);
+            }
+        }
+
+    public: // 查找，命中时把值复制到 out；锁外不能持有缓存内部的地址
+        bool get(const key_type& key, mapped_type& out) {
+            shard& s = shard_for(key);
+            if (!timed_.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                return fetch(s.cache, key, out);
+            }
+            // 计时包含等锁的时间
+            const auto start = std::chrono::steady_clock::now();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            const bool hit = fetch(s.cache, key, out);
+            s.cache.record_lookup(std::chrono::steady_clock::now() - start);
+            return hit;
+        }
+
+        bool contains(const key_type& key) const {
+            shard& s = shard_for(key);
+            std::lock_guard<std::mutex> lock(s.mutex);
+            return s.cache.contains(key);
+        }
+
+    public: // 插入、删除
+        template<class V>
+        bool put(const key_type& key, V&& value) {
+            shard& s = shard_for(key);
+            std::lock_guard<std::mutex> lock(s.mutex);
+            return s.cache.put(key, mystl::forward<V>(value));
+        }
+
+        bool erase(const key_type& key) {
+            shard& s = shard_for(key);
+            std::lock_guard<std::mutex> lock(s.mutex);
+            return s.cache.erase(key);
+        }
+
+        void clear() {
+            for (auto& s : shards_) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                s->cache.clear();
+            }
+        }
+
+    public: // 统计，stats 汇总各分片
+        lru_stats stats() const {
+            lru_stats total;
+            for (const auto& s : shards_) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                total += s->cache.stats();
+            }
+            return total;
+        }
+
+        void reset_stats() {
+            for (auto& s : shards_) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                s->cache.reset_stats();
+            }
+        }
+
+        void record_latency(bool on) noexcept { timed_.store(on, std::memory_order_relaxed); }
+
+    private:
+        // 用混合后哈希值的高位选择分片，与分片内 hashtable 使用的低位（H2 与探测起点）错开
+        shard& shard_for(const key_type& key) const {
+            const uint64_t h = static_cast<uint64_t>(__hash_mix(hash_(key)));
+            return *shards_[static_cast<size_type>(h >> 40) & mask_];
+        }
+
+        static bool fetch(cache_type& cache, const key_type& key, mapped_type& out) {
+            const mapped_type* p = cache.lookup(key);
+            if (!p) return false;
+            out = *p;
+            return true;
+        }
+    };
+
+} // namespace mystl
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "iterator.h"
+#include "algobase.h"
+#include "functional.h"
+
+// 数值算法：reduce、inclusive_scan
+// reduce 不规定结合顺序，要求 op 满足结合律与交换律，以便并行版本任意分块求和
+namespace mystl {
+    template<class InputIter, class T, class BinaryOperation>
+    T reduce(InputIter first, InputIter last, T init, BinaryOperation op) {
+        for (; first != last; ++first) init = op(mystl::move(init), *first);
+        return init;
+    }
+
+    template<class InputIter, class T>
+    inline T reduce(InputIter first, InputIter last, T init) {
+        return mystl::reduce(first, last, mystl::move(init), mystl::plus<void>());
+    }
+
+    template<class InputIter>
+    inline value_type_t<InputIter> reduce(InputIter first, InputIter last) {
+        return mystl::reduce(first, last, value_type_t<InputIter>());
+    }
+
+    // result[i] = init op first[0] op ... op first[i]
+    template<class InputIter, class OutputIter, class BinaryOperation, class T>
+    OutputIter inclusive_scan(InputIter first, InputIter last, OutputIter result, BinaryOperation op, T init) {
+        for (; first != last; ++first, ++result) {
+            init = op(mystl::move(init), *first);
+            *result = init;
+        }
+        return result;
+    }
+
+    template<class InputIter, class OutputIter, class BinaryOperation>
+    OutputIter inclusive_scan(InputIter first, InputIter last, OutputIter result, BinaryOperation op) {
+        if (first == last) return result;
+        value_type_t<InputIter> acc = *first;
+        *result = acc;
+        return mystl::inclusive_scan(++first, last, ++result, op, mystl::move(acc));
+    }
+
+    template<class InputIter, class OutputIter>
+    inline OutputIter inclusive_scan(InputIter first, InputIter last, OutputIter result) {
+        return mystl::inclusive_scan(first, last, result, mystl::plus<void>());
+    }
+
+} // namespace mystl
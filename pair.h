@@ -0,0 +1,85 @@
+#pragma once
+
+#include "algobase.h"
+#include "type_traits.h"
+
+#include <type_traits>
+
+// pair：关联容器的 value_type
+namespace mystl {
+
+    template<class T1, class T2>
+    struct pair {
+        using first_type = T1;
+        using second_type = T2;
+
+        T1 first;
+        T2 second;
+
+        pair() : first(), second() {}
+        pair(const T1& a, const T2& b) : first(a), second(b) {}
+
+        template<class U1, class U2,
+                 class = typename std::enable_if<std::is_constructible<T1, U1&&>::value &&
+                                                 std::is_constructible<T2, U2&&>::value>::type>
+        pair(U1&& a, U2&& b) : first(mystl::forward<U1>(a)), second(mystl::forward<U2>(b)) {}
+
+        pair(const pair&) = default;
+        pair(pair&&) = default;
+
+        template<class U1, class U2>
+        pair(const pair<U1, U2>& p) : first(p.first), second(p.second) {}
+
+        template<class U1, class U2>
+        pair(pair<U1, U2>&& p) : first(mystl::forward<U1>(p.first)), second(mystl::forward<U2>(p.second)) {}
+
+        pair& operator=(const pair& rhs) {
+            first = rhs.first;
+            second = rhs.second;
+            return *this;
+        }
+
+        pair& operator=(pair&& rhs) {
+            first = mystl::move(rhs.first);
+            second = mystl::move(rhs.second);
+            return *this;
+        }
+
+        void swap(pair& rhs) {
+            mystl::swap(first, rhs.first);
+            mystl::swap(second, rhs.second);
+        }
+    };
+
+    template<class T1, class T2>
+    inline bool operator==(const pair<T1, T2>& x, const pair<T1, T2>& y) {
+        return x.first == y.first && x.second == y.second;
+    }
+
+    template<class T1, class T2>
+    inline bool operator!=(const pair<T1, T2>& x, const pair<T1, T2>& y) {
+        return !(x == y);
+    }
+
+    template<class T1, class T2>
+    inline bool operator<(const pair<T1, T2>& x, const pair<T1, T2>& y) {
+        return x.first < y.first || (!(y.first < x.first) && x.second < y.second);
+    }
+
+    template<class T1, class T2>
+    inline bool operator>(const pair<T1, T2>& x, const pair<T1, T2>& y) { return y < x; }
+
+    template<class T1, class T2>
+    inline bool operator<=(const pair<T1, T2>& x, const pair<T1, T2>& y) { return !(y < x); }
+
+    template<class T1, class T2>
+    inline bool operator>=(const pair<T1, T2>& x, const pair<T1, T2>& y) { return !(x < y); }
+
+    template<class T1, class T2>
+    inline pair<typename std::decay<T1>::type, typename std::decay<T2>::type>
+    make_pair(T1&& a, T2&& b) {
+        return pair<typename std::decay<T1>::type, typename std::decay<T2>::type>(
+            mystl::forward<T1>(a), mystl::forward<T2>(b));
+    }
+
+} // namespace mystl
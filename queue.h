@@ -1,6 +1,11 @@
+#pragma once
+
 #include "algobase.h"
 #include "type_traits.h"
+#include "functional.h"
 #include "deque.h"
+#include "vector.h"
+#include "heap.h"
 
 namespace mystl {
 
@@ -68,10 +73,29 @@ public: // 插入
         c_.emplace_back(mystl::forward<Args>(args)...);
     }
 
+    // 批量入队，由底层容器一次备齐空间
+    template<class InputIterator>
+    void push_range(InputIterator first, InputIterator last) {
+        c_.append_range(first, last);
+    }
+
     void pop() {
         c_.pop_front();
     }
 
+    // 批量出队：至多 n 个元素按出队顺序移动到 out，返回写入后的 out
+    template<class OutputIterator>
+    OutputIterator pop_n(size_type n, OutputIterator out) {
+        return c_.pop_front_n(mystl::min(n, c_.size()), out);
+    }
+
+    // 全部元素按出队顺序追加到 v 末尾，队列随之清空
+    template<class Alloc>
+    void drain_into(vector<value_type, Alloc>& v) {
+        v.reserve(v.size() + c_.size());
+        c_.pop_front_n(c_.size(), mystl::back_inserter(v));
+    }
+
     reference front() {
         return c_.front();
     }
@@ -147,4 +171,288 @@ void swap(queue<T, Container>& lhs, queue<T, Container>& rhs) noexcept(noexcept(
 }
 
 
+
+// 优先队列：以 Container 作为底层容器，用堆算法维护，默认堆顶为最大元素
+template<class T, class Container = mystl::vector<T>,
+         class Compare = mystl::less<typename Container::value_type>>
+class priority_queue
+{
+public:
+    using container_type = Container;
+    using value_compare = Compare;
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using reference = typename Container::reference;
+    using const_reference = typename Container::const_reference;
+
+    static_assert(std::is_same<T, value_type>::value, "the value type of Conintainer should be same with T");
+
+private:
+    container_type c_;
+    value_compare comp_;
+
+public:
+    priority_queue() = default;
+    explicit priority_queue(const Compare& comp) : c_(), comp_(comp) {}
+    priority_queue(const Compare& comp, const Container& c) : c_(c), comp_(comp) {
+        mystl::make_heap(c_.begin(), c_.end(), comp_);
+    }
+    priority_queue(const Compare& comp, Container&& c) : c_(mystl::move(c)), comp_(comp) {
+        mystl::make_heap(c_.begin(), c_.end(), comp_);
+    }
+    template<class InputIterator>
+    priority_queue(InputIterator first, InputIterator last, const Compare& comp = Compare())
+        : c_(first, last), comp_(comp) {
+        mystl::make_heap(c_.begin(), c_.end(), comp_);
+    }
+    priority_queue(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+        : c_(ilist.begin(), ilist.end()), comp_(comp) {
+        mystl::make_heap(c_.begin(), c_.end(), comp_);
+    }
+
+public:
+    const_reference top() const { return c_.front(); }
+    bool empty() const noexcept { return c_.empty(); }
+    size_type size() const noexcept { return c_.size(); }
+
+public: // 插入 & 弹出
+    void push(const value_type& val) {
+        c_.push_back(val);
+        mystl::push_heap(c_.begin(), c_.end(), comp_);
+    }
+
+    void push(value_type&& val) {
+        c_.push_back(mystl::move(val));
+        mystl::push_heap(c_.begin(), c_.end(), comp_);
+    }
+
+    template<class... Args>
+    void emplace(Args&&... args) {
+        c_.emplace_back(mystl::forward<Args>(args)...);
+        mystl::push_heap(c_.begin(), c_.end(), comp_);
+    }
+
+    void pop() {
+        mystl::pop_heap(c_.begin(), c_.end(), comp_);
+        c_.pop_back();
+    }
+
+    void clear() {
+        c_.clear();
+    }
+
+    void swap(priority_queue& rhs) noexcept
+    {
+        mystl::swap(c_, rhs.c_);
+        mystl::swap(comp_, rhs.comp_);
+    }
+};
+
+template <class T, class Container, class Compare>
+void swap(priority_queue<T, Container, Compare>& lhs, priority_queue<T, Container, Compare>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+
+// d 叉堆优先队列，接口与 priority_queue 相同
+// 树更矮、同一节点的子节点连续存放，pop 时 cache miss 更少，适合大堆
+template<class T, size_t D = 4, class Container = mystl::vector<T>,
+         class Compare = mystl::less<typename Container::value_type>>
+class dary_priority_queue
+{
+public:
+    using container_type = Container;
+    using value_compare = Compare;
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using reference = typename Container::reference;
+    using const_reference = typename Container::const_reference;
+
+    static_assert(D >= 2, "a d-ary heap needs at least two children per node");
+    static_assert(std::is_same<T, value_type>::value, "the value type of Conintainer should be same with T");
+
+private:
+    container_type c_;
+    value_compare comp_;
+
+public:
+    dary_priority_queue() = default;
+    explicit dary_priority_queue(const Compare& comp) : c_(), comp_(comp) {}
+    template<class InputIterator>
+    dary_priority_queue(InputIterator first, InputIterator last, const Compare& comp = Compare())
+        : c_(first, last), comp_(comp) {
+        mystl::dary_make_heap<D>(c_.begin(), c_.end(), comp_);
+    }
+
+public:
+    const_reference top() const { return c_.front(); }
+    bool empty() const noexcept { return c_.empty(); }
+    size_type size() const noexcept { return c_.size(); }
+
+public: // 插入 & 弹出
+    void push(const value_type& val) {
+        c_.push_back(val);
+        mystl::dary_push_heap<D>(c_.begin(), c_.end(), comp_);
+    }
+
+    void push(value_type&& val) {
+        c_.push_back(mystl::move(val));
+        mystl::dary_push_heap<D>(c_.begin(), c_.end(), comp_);
+    }
+
+    template<class... Args>
+    void emplace(Args&&... args) {
+        c_.emplace_back(mystl::forward<Args>(args)...);
+        mystl::dary_push_heap<D>(c_.begin(), c_.end(), comp_);
+    }
+
+    void pop() {
+        mystl::dary_pop_heap<D>(c_.begin(), c_.end(), comp_);
+        c_.pop_back();
+    }
+
+    void clear() {
+        c_.clear();
+    }
+
+    void swap(dary_priority_queue& rhs) noexcept
+    {
+        mystl::swap(c_, rhs.c_);
+        mystl::swap(comp_, rhs.comp_);
+    }
+};
+
+
+// 索引堆：元素以 [0, n) 中的整数 id 标识，可以按 id 修改键值
+// 默认 Compare 为 greater，堆顶为最小键，decrease_key 即把键改小（Dijkstra、定时器调度）
+// heap_ 保存 id，pos_ 记录每个 id 在 heap_ 中的位置，keys_ 按 id 存放键值
+template<class T, class Compare = mystl::greater<T>>
+class indexed_priority_queue
+{
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = size_t;
+    using const_reference = const T&;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+private:
+    mystl::vector<size_type> heap_;
+    mystl::vector<size_type> pos_;
+    mystl::vector<value_type> keys_;
+    value_compare comp_;
+
+private: // 向上/向下调整，同时维护 pos_
+    bool higher(size_type a, size_type b) const { return comp_(keys_[b], keys_[a]); }
+
+    void place(size_type i, size_type id) {
+        heap_[i] = id;
+        pos_[id] = i;
+    }
+
+    void sift_up(size_type i) {
+        const size_type id = heap_[i];
+        while (i > 0) {
+            size_type parent = (i - 1) / 2;
+            if (!higher(id, heap_[parent])) break;
+            place(i, heap_[parent]);
+            i = parent;
+        }
+        place(i, id);
+    }
+
+    void sift_down(size_type i) {
+        const size_type id = heap_[i];
+        const size_type len = heap_.size();
+        while (true) {
+            size_type child = 2 * i + 1;
+            if (child >= len) break;
+            if (child + 1 < len && higher(heap_[child + 1], heap_[child])) ++child;
+            if (!higher(heap_[child], id)) break;
+            place(i, heap_[child]);
+            i = child;
+        }
+        place(i, id);
+    }
+
+public:
+    indexed_priority_queue() = default;
+    // 预留 n 个 id
+    explicit indexed_priority_queue(size_type n, const Compare& comp = Compare())
+        : heap_(), pos_(n, npos), keys_(n), comp_(comp) {
+        heap_.reserve(n);
+    }
+
+public:
+    bool empty() const noexcept { return heap_.empty(); }
+    size_type size() const noexcept { return heap_.size(); }
+    bool contains(size_type id) const noexcept { return id < pos_.size() && pos_[id] != npos; }
+    size_type top_id() const { return heap_.front(); }
+    const_reference top() const { return keys_[heap_.front()]; }
+    const_reference key(size_type id) const { return keys_[id]; }
+
+public:
+    // 插入 id，id 不能已在堆中
+    void push(size_type id, const value_type& key) {
+        if (id >= pos_.size()) {
+            pos_.resize(id + 1, npos);
+            keys_.resize(id + 1);
+        }
+        keys_[id] = key;
+        heap_.push_back(id);
+        pos_[id] = heap_.size() - 1;
+        sift_up(heap_.size() - 1);
+    }
+
+    void pop() {
+        erase(heap_.front());
+    }
+
+    // 删除任意 id
+    void erase(size_type id) {
+        const size_type i = pos_[id];
+        const size_type last = heap_.back();
+        heap_.pop_back();
+        pos_[id] = npos;
+        if (i < heap_.size()) {
+            place(i, last);
+            sift_up(i);
+            sift_down(pos_[last]);
+        }
+    }
+
+    // 把 id 的键改为优先级不低于原值的 key，只需向上调整
+    void decrease_key(size_type id, const value_type& key) {
+        keys_[id] = key;
+        sift_up(pos_[id]);
+    }
+
+    // 把 id 的键改为优先级不高于原值的 key，只需向下调整
+    void increase_key(size_type id, const value_type& key) {
+        keys_[id] = key;
+        sift_down(pos_[id]);
+    }
+
+    // 任意修改键值；id 不在堆中时插入
+    void update(size_type id, const value_type& key) {
+        if (!contains(id)) {
+            push(id, key);
+            return;
+        }
+        keys_[id] = key;
+        sift_up(pos_[id]);
+        sift_down(pos_[id]);
+    }
+
+    void clear() {
+        for (size_type i = 0; i < heap_.size(); ++i) pos_[heap_[i]] = npos;
+        heap_.clear();
+    }
+};
+
+template<class T, class Compare>
+constexpr typename indexed_priority_queue<T, Compare>::size_type indexed_priority_queue<T, Compare>::npos;
+
 }
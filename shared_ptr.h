@@ -13,23 +13,23 @@ template<class T>
 class shared_ptr {
     using m_del = std::function<void(T*)>;
 public:
-    shared_ptr(T* p = nullptr, m_del del = [](T* p) {delete p; }) : ptr(p), ref_count(new std::atomic<size_t>(p != nullptr)), deleter(del) {}
+    shared_ptr(T* p = nullptr, m_del del = [](T* p) {delete p; }) : ref_count(new std::atomic<size_t>(1)), ptr(p), deleter(del) {}
     ~shared_ptr() {
         decrementAndDestory();
     }
 public:
     // ƹ캯
-    shared_ptr(const shared_ptr& other) : ptr(other.ptr), ref_count(other.ref_count), deleter(other.del) {
-        ++* ref_count;
+    shared_ptr(const shared_ptr& other) : ref_count(other.ref_count), ptr(other.ptr), deleter(other.deleter) {
+        if (ref_count) ++*ref_count;
     }
     shared_ptr& operator=(const shared_ptr& rhs);
 
     // ƶ캯
-    shared_ptr(const shared_ptr&& other) : ptr(other.ptr), ref_count(other.ref_count), deleter(mystl::move(other.del)) {
+    shared_ptr(shared_ptr&& other) noexcept : ref_count(other.ref_count), ptr(other.ptr), deleter(mystl::move(other.deleter)) {
         other.ptr = nullptr;
         other.ref_count = nullptr;
     }
-    shared_ptr& operator=(const shared_ptr&& rhs) noexcept;
+    shared_ptr& operator=(shared_ptr&& rhs) noexcept;
 
 public: // 
     T &operator*() const noexcept { return *ptr; }
@@ -39,8 +39,8 @@ public:
     operator bool() const noexcept { return ptr; }
 public:
     T* get() const noexcept { return ptr; }
-    size_t use_count() const noexcept { return *ref_count; }
-    bool unique() const noexcept { return *ref_count == 1; }
+    size_t use_count() const noexcept { return ptr ? size_t(*ref_count) : 0; }
+    bool unique() const noexcept { return use_count() == 1; }
     // ָ
     void reset(T* p = nullptr, const m_del& d = [](T* p) {delete p; });
 
@@ -64,16 +64,18 @@ inline void shared_ptr<T>::swap(shared_ptr& other) noexcept {
 template<class T>
 inline shared_ptr<T>& shared_ptr<T>::operator=(const shared_ptr<T>& rhs) {
     // increment first to ensure safty for self-assignment and avoid identity test
-    ++*rhs.ref_count;
+    if (rhs.ref_count) ++*rhs.ref_count;
     decrementAndDestory();
     ptr = rhs.ptr, ref_count = rhs.ref_count, deleter = rhs.deleter;
     return *this;
 }
 
 template<class T>
-inline shared_ptr<T>& shared_ptr<T>::operator=(const shared_ptr<T>&& rhs) noexcept {
-    swap(rhs);
-    rhs.decrementAndDestory();
+inline shared_ptr<T>& shared_ptr<T>::operator=(shared_ptr<T>&& rhs) noexcept {
+    if (this != &rhs) {
+        swap(rhs);
+        rhs.decrementAndDestory();
+    }
     return *this;
 }
 
@@ -83,19 +85,17 @@ inline void shared_ptr<T>::reset(T* p, const m_del& d) {
     {
         decrementAndDestory();
         ptr = p;
-        *ref_count = new std::atomic<size_t>(p == nullptr);
+        ref_count = new std::atomic<size_t>(1);
     }
     deleter = d;
 }
 
 template<class T>
 inline void shared_ptr<T>::decrementAndDestory() {
-    if (ptr && --*ref_count == 0) {
-        delete ref_count;
-        deleter(ptr);
-    }
-    else if (!ptr) {
+    // ָͬмһͷżǿʱٵɾ
+    if (ref_count && --*ref_count == 0) {
         delete ref_count;
+        if (ptr) deleter(ptr);
     }
     ptr = nullptr;
     ref_count = nullptr;
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MYSTL_SIMD_WIDTH 32
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define MYSTL_SIMD_WIDTH 16
+#endif
+
+// 连续内存上的向量化查找与比较内核，供 find、count、mismatch、equal、lexicographical_compare 使用。
+// 元素按位比较（只适用于整数、指针、枚举这类相等即按位相同的类型），以字节指针与元素个数传入；
+// 编译时开启 AVX2 用 256 位寄存器，否则用 SSE2，都没有时退回逐元素比较
+namespace mystl {
+
+#ifdef MYSTL_SIMD_WIDTH
+    struct __simd {
+#if MYSTL_SIMD_WIDTH == 32
+        using reg = __m256i;
+        using mask_type = unsigned;
+        static constexpr mask_type full_mask = 0xFFFFFFFFu;
+
+        static reg load(const unsigned char* p) { return _mm256_loadu_si256(reinterpret_cast<const reg*>(p)); }
+        static reg zero() { return _mm256_setzero_si256(); }
+        static reg bit_or(reg a, reg b) { return _mm256_or_si256(a, b); }
+        static mask_type mask(reg v) { return static_cast<mask_type>(_mm256_movemask_epi8(v)); }
+        static void store(void* p, reg v) { _mm256_storeu_si256(static_cast<reg*>(p), v); }
+
+        template<size_t Size>
+        static reg sub(reg a, reg b) {
+            if constexpr (Size == 1) return _mm256_sub_epi8(a, b);
+            else if constexpr (Size == 2) return _mm256_sub_epi16(a, b);
+            else if constexpr (Size == 4) return _mm256_sub_epi32(a, b);
+            else return _mm256_sub_epi64(a, b);
+        }
+
+        template<size_t Size, class Bits>
+        static reg splat(Bits x) {
+            if constexpr (Size == 1) return _mm256_set1_epi8(static_cast<char>(x));
+            else if constexpr (Size == 2) return _mm256_set1_epi16(static_cast<short>(x));
+            else if constexpr (Size == 4) return _mm256_set1_epi32(static_cast<int>(x));
+            else return _mm256_set1_epi64x(static_cast<long long>(x));
+        }
+
+        template<size_t Size>
+        static reg equal(reg a, reg b) {
+            if constexpr (Size == 1) return _mm256_cmpeq_epi8(a, b);
+            else if constexpr (Size == 2) return _mm256_cmpeq_epi16(a, b);
+            else if constexpr (Size == 4) return _mm256_cmpeq_epi32(a, b);
+            else return _mm256_cmpeq_epi64(a, b);
+        }
+#else
+        using reg = __m128i;
+        using mask_type = unsigned;
+        static constexpr mask_type full_mask = 0xFFFFu;
+
+        static reg load(const unsigned char* p) { return _mm_loadu_si128(reinterpret_cast<const reg*>(p)); }
+        static reg zero() { return _mm_setzero_si128(); }
+        static reg bit_or(reg a, reg b) { return _mm_or_si128(a, b); }
+        static mask_type mask(reg v) { return static_cast<mask_type>(_mm_movemask_epi8(v)); }
+        static void store(void* p, reg v) { _mm_storeu_si128(static_cast<reg*>(p), v); }
+
+        template<size_t Size>
+        static reg sub(reg a, reg b) {
+            if constexpr (Size == 1) return _mm_sub_epi8(a, b);
+            else if constexpr (Size == 2) return _mm_sub_epi16(a, b);
+            else if constexpr (Size == 4) return _mm_sub_epi32(a, b);
+            else return _mm_sub_epi64(a, b);
+        }
+
+        template<size_t Size, class Bits>
+        static reg splat(Bits x) {
+            if constexpr (Size == 1) return _mm_set1_epi8(static_cast<char>(x));
+            else if constexpr (Size == 2) return _mm_set1_epi16(static_cast<short>(x));
+            else if constexpr (Size == 4) return _mm_set1_epi32(static_cast<int>(x));
+            else return _mm_set1_epi64x(static_cast<long long>(x));
+        }
+
+        // SSE2 没有 64 位比较：两个 32 位半段都相等才算相等
+        template<size_t Size>
+        static reg equal(reg a, reg b) {
+            if constexpr (Size == 1) return _mm_cmpeq_epi8(a, b);
+            else if constexpr (Size == 2) return _mm_cmpeq_epi16(a, b);
+            else if constexpr (Size == 4) return _mm_cmpeq_epi32(a, b);
+            else {
+                const reg eq32 = _mm_cmpeq_epi32(a, b);
+                return _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        }
+#endif
+        static constexpr size_t width = MYSTL_SIMD_WIDTH;
+    };
+#endif
+
+    template<size_t Size>
+    struct __simd_bits;
+    template<> struct __simd_bits<1> { using type = unsigned char; };
+    template<> struct __simd_bits<2> { using type = unsigned short; };
+    template<> struct __simd_bits<4> { using type = unsigned int; };
+    template<> struct __simd_bits<8> { using type = unsigned long long; };
+
+    template<size_t Size>
+    inline typename __simd_bits<Size>::type __simd_load_bits(const unsigned char* p) {
+        typename __simd_bits<Size>::type x;
+        std::memcpy(&x, p, Size);
+        return x;
+    }
+
+    // 返回 [p, p + n * Size) 中第一个等于 value 的元素下标，不存在时返回 n
+    template<size_t Size>
+    size_t __simd_find(const unsigned char* p, size_t n, typename __simd_bits<Size>::type value) {
+        if constexpr (Size == 1) {
+            if (n == 0) return 0;// 空区间时 p 可能为空指针，不能传给 memchr
+            const void* hit = std::memchr(p, value, n);
+            return hit ? static_cast<size_t>(static_cast<const unsigned char*>(hit) - p) : n;
+        }
+        size_t i = 0;
+#ifdef MYSTL_SIMD_WIDTH
+        constexpr size_t per = __simd::width / Size;
+        const __simd::reg needle = __simd::splat<Size>(value);
+        // 每次检查四个寄存器，命中后再逐个定位
+        for (; i + 4 * per <= n; i += 4 * per) {
+            const unsigned char* q = p + i * Size;
+            const __simd::reg e0 = __simd::equal<Size>(__simd::load(q), needle);
+            const __simd::reg e1 = __simd::equal<Size>(__simd::load(q + __simd::width), needle);
+            const __simd::reg e2 = __simd::equal<Size>(__simd::load(q + 2 * __simd::width), needle);
+            const __simd::reg e3 = __simd::equal<Size>(__simd::load(q + 3 * __simd::width), needle);
+            if (__simd::mask(__simd::bit_or(__simd::bit_or(e0, e1), __simd::bit_or(e2, e3)))) break;
+        }
+        for (; i + per <= n; i += per) {
+            const __simd::mask_type m = __simd::mask(__simd::equal<Size>(__simd::load(p + i * Size), needle));
+            if (m) return i + static_cast<size_t>(__builtin_ctz(m)) / Size;
+        }
+#endif
+        for (; i < n; ++i) {
+            if (__simd_load_bits<Size>(p + i * Size) == value) return i;
+        }
+        return n;
+    }
+
+    // 统计 [p, p + n * Size) 中等于 value 的元素个数
+    // 比较结果每条通道为 -1，累加到通道计数器上，在通道溢出前求一次横向和
+    template<size_t Size>
+    size_t __simd_count(const unsigned char* p, size_t n, typename __simd_bits<Size>::type value) {
+        using bits_type = typename __simd_bits<Size>::type;
+        size_t i = 0, result = 0;
+#ifdef MYSTL_SIMD_WIDTH
+        constexpr size_t per = __simd::width / Size;
+        constexpr size_t max_rounds = Size == 1 ? 0xFF : Size == 2 ? 0xFFFF : Size == 4 ? 0xFFFFFFFF : static_cast<size_t>(-1);
+        const __simd::reg needle = __simd::splat<Size>(value);
+        while (i + per <= n) {
+            size_t rounds = (n - i) / per;
+            if (rounds > max_rounds) rounds = max_rounds;
+            __simd::reg acc = __simd::zero();
+            for (; rounds > 0; --rounds, i += per) {
+                acc = __simd::sub<Size>(acc, __simd::equal<Size>(__simd::load(p + i * Size), needle));
+            }
+            bits_type lanes[per];
+            __simd::store(lanes, acc);
+            for (size_t k = 0; k < per; ++k) result += lanes[k];
+        }
+#endif
+        for (; i < n; ++i) result += (__simd_load_bits<Size>(p + i * Size) == value);
+        return result;
+    }
+
+    // 返回 a、b 前 n 个字节中第一个不同字节的下标，全部相同时返回 n
+    inline size_t __simd_mismatch(const unsigned char* a, const unsigned char* b, size_t n) {
+        size_t i = 0;
+#ifdef MYSTL_SIMD_WIDTH
+        for (; i + __simd::width <= n; i += __simd::width) {
+            const __simd::mask_type m = __simd::mask(__simd::equal<1>(__simd::load(a + i), __simd::load(b + i)));
+            if (m != __simd::full_mask) return i + static_cast<size_t>(__builtin_ctz(~m));
+        }
+#endif
+        for (; i < n; ++i) {
+            if (a[i] != b[i]) return i;
+        }
+        return n;
+    }
+
+} // namespace mystl
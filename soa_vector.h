@@ -0,0 +1,397 @@
+#pragma once
+
+#include "algobase.h"
+#include "allocator.h"
+#include "construct.h"
+#include "iterator.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// soa_vector：按列存放的记录数组（structure of arrays）
+// soa_vector<int, float, char> 相当于 vector<tuple<int, float, char>>，但每个字段各占一段连续内存，
+// 只扫描一两个字段时不会把其他字段带进缓存，单列也可以直接交给向量化的循环。
+// 各列共用 size 与 capacity，扩容沿用 vector 的翻倍策略，所有列一起重新分配。
+// 解引用得到 tuple<Fields&...> 代理，可用结构化绑定拆开；扩容会使所有迭代器与列视图失效
+namespace mystl {
+
+    // 一列的连续视图，不拥有内存
+    template<class T>
+    struct soa_span {
+        using element_type = T;
+        using size_type = size_t;
+        using iterator = T*;
+
+        T* ptr;
+        size_type count;
+
+        T* data() const noexcept { return ptr; }
+        size_type size() const noexcept { return count; }
+        bool empty() const noexcept { return count == 0; }
+        T* begin() const noexcept { return ptr; }
+        T* end() const noexcept { return ptr + count; }
+        T& operator[](size_type n) const noexcept { return ptr[n]; }
+    };
+
+    // 迭代器只记录所属容器与下标，解引用时再到各列取值
+    template<class Vector, bool Const>
+    struct __soa_iterator {
+        using iterator = __soa_iterator<Vector, false>;
+        using self = __soa_iterator;
+        using container_pointer = typename std::conditional<Const, const Vector*, Vector*>::type;
+
+        using iterator_category = random_access_iterator_tag;
+        using value_type = typename Vector::value_type;
+        using reference = typename std::conditional<Const, typename Vector::const_reference,
+                                                    typename Vector::reference>::type;
+        using pointer = void;
+        using difference_type = ptrdiff_t;
+        using size_type = size_t;
+
+        // 数据成员
+        container_pointer v;
+        size_type i;
+
+        __soa_iterator() noexcept : v(nullptr), i(0) {}
+        __soa_iterator(container_pointer vec, size_type n) noexcept : v(vec), i(n) {}
+        __soa_iterator(const iterator& rhs) noexcept : v(rhs.v), i(rhs.i) {}
+
+        reference operator*() const noexcept { return (*v)[i]; }
+        reference operator[](difference_type n) const noexcept { return (*v)[i + n]; }
+
+        self& operator++() noexcept { ++i; return *this; }
+        self operator++(int) noexcept { self temp = *this; ++i; return temp; }
+        self& operator--() noexcept { --i; return *this; }
+        self operator--(int) noexcept { self temp = *this; --i; return temp; }
+        self& operator+=(difference_type n) noexcept { i += n; return *this; }
+        self& operator-=(difference_type n) noexcept { i -= n; return *this; }
+        self operator+(difference_type n) const noexcept { return self(v, i + n); }
+        self operator-(difference_type n) const noexcept { return self(v, i - n); }
+        difference_type operator-(const self& rhs) const noexcept {
+            return static_cast<difference_type>(i) - static_cast<difference_type>(rhs.i);
+        }
+
+        bool operator==(const self& rhs) const noexcept { return i == rhs.i; }
+        bool operator!=(const self& rhs) const noexcept { return i != rhs.i; }
+        bool operator<(const self& rhs) const noexcept { return i < rhs.i; }
+        bool operator>(const self& rhs) const noexcept { return i > rhs.i; }
+        bool operator<=(const self& rhs) const noexcept { return i <= rhs.i; }
+        bool operator>=(const self& rhs) const noexcept { return i >= rhs.i; }
+    };
+
+    // 把 [first, first + n) 移到未初始化的 result；移动可能抛异常时退回复制，
+    // 使扩容失败时原数据保持不变。中途抛出异常时析构已构造的元素
+    template<class T>
+    void __soa_uninitialized_relocate(T* first, size_t n, T* result) {
+        size_t i = 0;
+        try {
+            for (; i < n; ++i) {
+                if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value)
+                    mystl::construct(result + i, mystl::move(first[i]));
+                else
+                    mystl::construct(result + i, static_cast<const T&>(first[i]));
+            }
+        } catch (...) {
+            mystl::destroy(result, result + i);
+            throw;
+        }
+    }
+
+    template<class T>
+    void __soa_uninitialized_copy(const T* first, size_t n, T* result) {
+        size_t i = 0;
+        try {
+            for (; i < n; ++i) mystl::construct(result + i, first[i]);
+        } catch (...) {
+            mystl::destroy(result, result + i);
+            throw;
+        }
+    }
+
+    template<class... Fields>
+    class soa_vector {
+        static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields&...>;
+        using const_reference = std::tuple<const Fields&...>;
+        using iterator = __soa_iterator<soa_vector, false>;
+        using const_iterator = __soa_iterator<soa_vector, true>;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        template<size_t I>
+        using field_type = typename std::tuple_element<I, value_type>::type;
+
+        static constexpr size_type field_count = sizeof...(Fields);
+
+    private:
+        using columns_type = std::tuple<Fields*...>;
+        using indices = std::index_sequence_for<Fields...>;
+
+        columns_type columns_;
+        size_type size_;
+        size_type capacity_;
+
+    public: // 构造、析构与赋值
+        soa_vector() noexcept : columns_(), size_(0), capacity_(0) {}
+
+        explicit soa_vector(size_type n) : soa_vector() { resize(n); }
+
+        soa_vector(const soa_vector& rhs) : soa_vector() {
+            columns_type fresh = allocate_columns(rhs.size_);
+            try {
+                copy_columns(rhs.columns_, rhs.size_, fresh, indices());
+            } catch (...) {
+                deallocate_columns(fresh, rhs.size_);
+                throw;
+            }
+            columns_ = fresh;
+            size_ = capacity_ = rhs.size_;
+        }
+
+        soa_vector(soa_vector&& rhs) noexcept : columns_(rhs.columns_), size_(rhs.size_), capacity_(rhs.capacity_) {
+            rhs.columns_ = columns_type();
+            rhs.size_ = rhs.capacity_ = 0;
+        }
+
+        ~soa_vector() {
+            clear();
+            deallocate_columns(columns_, capacity_);
+        }
+
+        soa_vector& operator=(const soa_vector& rhs) {
+            if (this != &rhs) {
+                soa_vector temp(rhs);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        soa_vector& operator=(soa_vector&& rhs) noexcept {
+            soa_vector temp(mystl::move(rhs));
+            swap(temp);
+            return *this;
+        }
+
+    public: // 迭代器
+        iterator       begin()        noexcept { return iterator(this, 0); }
+        const_iterator begin()  const noexcept { return const_iterator(this, 0); }
+        iterator       end()          noexcept { return iterator(this, size_); }
+        const_iterator end()    const noexcept { return const_iterator(this, size_); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend()   const noexcept { return end(); }
+
+    public: // 容量
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type capacity() const noexcept { return capacity_; }
+
+        void reserve(size_type n) {
+            if (n > capacity_) reallocate(n);
+        }
+
+        void shrink_to_fit() {
+            if (size_ < capacity_) reallocate(size_);
+        }
+
+        // 新增的记录各字段值初始化
+        void resize(size_type n) {
+            if (n < size_) {
+                destroy_range(n, size_, indices());
+                size_ = n;
+                return;
+            }
+            reserve(n);
+            while (size_ < n) emplace_back(Fields()...);
+        }
+
+    public: // 元素访问
+        reference operator[](size_type n) noexcept { return make_reference(n, indices()); }
+        const_reference operator[](size_type n) const noexcept { return make_const_reference(n, indices()); }
+        reference front() noexcept { return (*this)[0]; }
+        const_reference front() const noexcept { return (*this)[0]; }
+        reference back() noexcept { return (*this)[size_ - 1]; }
+        const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+        // 第 I 列的连续视图与首地址
+        template<size_t I>
+        soa_span<field_type<I>> column() noexcept { return soa_span<field_type<I>>{std::get<I>(columns_), size_}; }
+        template<size_t I>
+        soa_span<const field_type<I>> column() const noexcept {
+            return soa_span<const field_type<I>>{std::get<I>(columns_), size_};
+        }
+        template<size_t I>
+        field_type<I>* data() noexcept { return std::get<I>(columns_); }
+        template<size_t I>
+        const field_type<I>* data() const noexcept { return std::get<I>(columns_); }
+
+    public: // 插入与删除
+        void push_back(const value_type& record) {
+            std::apply([this](const Fields&... fields) { emplace_back(fields...); }, record);
+        }
+        void push_back(value_type&& record) {
+            std::apply([this](Fields&... fields) { emplace_back(mystl::move(fields)...); }, record);
+        }
+
+        // 每个参数构造对应的一个字段；参数可以引用容器自身的元素
+        template<class... Args>
+        reference emplace_back(Args&&... args) {
+            static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back takes one argument per field");
+            if (size_ == capacity_) {
+                grow_and_emplace(mystl::forward<Args>(args)...);
+            } else {
+                construct_record(columns_, size_, indices(), mystl::forward<Args>(args)...);
+            }
+            ++size_;
+            return back();
+        }
+
+        void pop_back() {
+            --size_;
+            destroy_range(size_, size_ + 1, indices());
+        }
+
+        void clear() noexcept {
+            destroy_range(0, size_, indices());
+            size_ = 0;
+        }
+
+        void swap(soa_vector& rhs) noexcept {
+            mystl::swap(columns_, rhs.columns_);
+            mystl::swap(size_, rhs.size_);
+            mystl::swap(capacity_, rhs.capacity_);
+        }
+
+    public: // 比较
+        friend bool operator==(const soa_vector& lhs, const soa_vector& rhs) {
+            return lhs.size_ == rhs.size_ && lhs.columns_equal(rhs, indices());
+        }
+        friend bool operator!=(const soa_vector& lhs, const soa_vector& rhs) { return !(lhs == rhs); }
+
+    private:
+        template<size_t... I>
+        reference make_reference(size_type n, std::index_sequence<I...>) noexcept {
+            return reference(std::get<I>(columns_)[n]...);
+        }
+        template<size_t... I>
+        const_reference make_const_reference(size_type n, std::index_sequence<I...>) const noexcept {
+            return const_reference(std::get<I>(columns_)[n]...);
+        }
+
+        template<size_t... I>
+        bool columns_equal(const soa_vector& rhs, std::index_sequence<I...>) const {
+            return (mystl::equal(std::get<I>(columns_), std::get<I>(columns_) + size_, std::get<I>(rhs.columns_)) && ...);
+        }
+
+        static columns_type allocate_columns(size_type n) {
+            columns_type fresh;
+            allocate_columns(fresh, n, indices());
+            return fresh;
+        }
+
+        // 某列分配失败时释放已分配的列
+        template<size_t... I>
+        static void allocate_columns(columns_type& fresh, size_type n, std::index_sequence<I...>) {
+            fresh = columns_type();
+            try {
+                ((std::get<I>(fresh) = simpleAlloc<Fields>::allocate(n)), ...);
+            } catch (...) {
+                deallocate_columns(fresh, n);
+                throw;
+            }
+        }
+
+        static void deallocate_columns(columns_type& cols, size_type n) noexcept {
+            std::apply([n](Fields*... p) { (simpleAlloc<Fields>::deallocate(p, n), ...); }, cols);
+        }
+
+        template<size_t... I>
+        void destroy_range(size_type first, size_type last, std::index_sequence<I...>) noexcept {
+            (mystl::destroy(std::get<I>(columns_) + first, std::get<I>(columns_) + last), ...);
+        }
+
+        // 以下三个函数逐列构造，第 k 列抛出异常时析构前 k 列已构造的部分，再重新抛出
+        template<size_t... I>
+        static void copy_columns(const columns_type& src, size_type n, columns_type& dst, std::index_sequence<I...>) {
+            size_type done = 0;
+            try {
+                ((mystl::__soa_uninitialized_copy(std::get<I>(src), n, std::get<I>(dst)), ++done), ...);
+            } catch (...) {
+                ((I < done ? mystl::destroy(std::get<I>(dst), std::get<I>(dst) + n) : void()), ...);
+                throw;
+            }
+        }
+
+        template<size_t... I>
+        static void relocate_columns(const columns_type& src, size_type n, columns_type& dst, std::index_sequence<I...>) {
+            size_type done = 0;
+            try {
+                ((mystl::__soa_uninitialized_relocate(std::get<I>(src), n, std::get<I>(dst)), ++done), ...);
+            } catch (...) {
+                ((I < done ? mystl::destroy(std::get<I>(dst), std::get<I>(dst) + n) : void()), ...);
+                throw;
+            }
+        }
+
+        template<size_t... I, class... Args>
+        static void construct_record(columns_type& cols, size_type n, std::index_sequence<I...>, Args&&... args) {
+            size_type done = 0;
+            try {
+                ((mystl::construct(std::get<I>(cols) + n, mystl::forward<Args>(args)), ++done), ...);
+            } catch (...) {
+                ((I < done ? mystl::destroy(std::get<I>(cols) + n) : void()), ...);
+                throw;
+            }
+        }
+
+        // 所有列一起搬到容量为 new_capacity 的新空间，失败时原数据不变
+        void reallocate(size_type new_capacity) {
+            columns_type fresh = allocate_columns(new_capacity);
+            try {
+                relocate_columns(columns_, size_, fresh, indices());
+            } catch (...) {
+                deallocate_columns(fresh, new_capacity);
+                throw;
+            }
+            destroy_range(0, size_, indices());
+            deallocate_columns(columns_, capacity_);
+            columns_ = fresh;
+            capacity_ = new_capacity;
+        }
+
+        // 与 vector 相同：容量为 0 时申请 1，否则翻倍。
+        // 先在新空间构造新记录再搬迁旧记录，参数引用旧元素时依然有效
+        template<class... Args>
+        void grow_and_emplace(Args&&... args) {
+            const size_type new_capacity = capacity_ ? 2 * capacity_ : 1;
+            columns_type fresh = allocate_columns(new_capacity);
+            try {
+                construct_record(fresh, size_, indices(), mystl::forward<Args>(args)...);
+            } catch (...) {
+                deallocate_columns(fresh, new_capacity);
+                throw;
+            }
+            try {
+                relocate_columns(columns_, size_, fresh, indices());
+            } catch (...) {
+                std::apply([this](Fields*... p) { (mystl::destroy(p + size_), ...); }, fresh);
+                deallocate_columns(fresh, new_capacity);
+                throw;
+            }
+            destroy_range(0, size_, indices());
+            deallocate_columns(columns_, capacity_);
+            columns_ = fresh;
+            capacity_ = new_capacity;
+        }
+    };
+
+    template<class... Fields>
+    inline void swap(soa_vector<Fields...>& lhs, soa_vector<Fields...>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "algorithm.h"
+#include "functional.h"
+#include "vector.h"
+
+#include <cstddef>
+
+// sorted_index：只读的有序查找表，元素按 Eytzinger（BFS / 堆）顺序存放。
+// 下标 k 的两个孩子是 2k、2k+1，查找路径上前几层集中在数组开头，常驻缓存；
+// 往下走时 k 的取值范围是连续的一段，可以提前若干层预取，因此在数组远大于缓存时
+// 比在有序数组上二分更快。构建一次，查找多次，不支持修改
+namespace mystl {
+
+    template<class Key, class Compare = mystl::less<Key>>
+    class sorted_index {
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using key_compare = Compare;
+        using size_type = size_t;
+        using const_pointer = const Key*;
+        using const_reference = const Key&;
+
+    private:
+        // 一个缓存行能放下的元素个数，预取 k * block 即预取往下第 log2(block) 层的孩子
+        static constexpr size_type block = sizeof(Key) >= 64 ? 1 : 64 / sizeof(Key);
+
+        vector<Key> tree_;  // tree_[0] 不用，tree_[1..n] 为 Eytzinger 顺序
+        size_type size_;
+        Compare comp_;
+
+    public:
+        sorted_index() : tree_(1), size_(0), comp_() {}
+
+        explicit sorted_index(const vector<Key>& keys, const Compare& comp = Compare())
+            : sorted_index(keys.begin(), keys.end(), comp) {}
+
+        template<class InputIterator>
+        sorted_index(InputIterator first, InputIterator last, const Compare& comp = Compare())
+            : comp_(comp) {
+            vector<Key> sorted(first, last);
+            mystl::sort(sorted.begin(), sorted.end(), comp_);
+            size_ = sorted.size();
+            tree_.resize(size_ + 1);
+            size_type i = 0;
+            build(sorted, i, 1);
+        }
+
+        size_type size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        key_compare key_comp() const { return comp_; }
+
+        // 第一个不小于 key 的元素，不存在时返回 nullptr
+        const_pointer lower_bound(const Key& key) const {
+            const Key* base = tree_.begin();
+            size_type k = 1;
+            while (k <= size_) {
+                __builtin_prefetch(base + k * block);
+                k = 2 * k + static_cast<size_type>(comp_(base[k], key));
+            }
+            // 最后一次向左走的位置即为答案：去掉 k 末尾的 1 和紧接的一个 0
+            k >>= __builtin_ffsll(static_cast<long long>(~k));
+            return k == 0 ? nullptr : base + k;
+        }
+
+        const_pointer find(const Key& key) const {
+            const_pointer p = lower_bound(key);
+            return p && !comp_(key, *p) ? p : nullptr;
+        }
+
+        bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    private:
+        // 中序遍历隐式完全二叉树，依次填入有序元素
+        void build(vector<Key>& sorted, size_type& i, size_type k) {
+            if (k > size_) return;
+            build(sorted, i, 2 * k);
+            tree_[k] = mystl::move(sorted[i++]);
+            build(sorted, i, 2 * k + 1);
+        }
+    };
+
+} // namespace mystl
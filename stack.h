@@ -1,6 +1,7 @@
 #pragma
 #include "deque.h"
 #include "algobase.h"
+#include "vector.h"
 
 namespace mystl {
     template<class T, class Container = mystl::deque<T>>
@@ -69,6 +70,17 @@ namespace mystl {
         void push(const value_type& val) {this_.push_back(val);}
         void push(value_type&& val) {this_.push_back(mystl::move(val));}
         void pop() {this_.pop_back();}
+        // 批量出栈：至多 n 个元素按出栈顺序（栈顶在前）移动到 out，返回写入后的 out
+        template<class OutputIterator>
+        OutputIterator pop_n(size_type n, OutputIterator out) {
+            return this_.pop_back_n(mystl::min(n, this_.size()), out);
+        }
+        // 全部元素按出栈顺序追加到 v 末尾，栈随之清空
+        template<class Alloc>
+        void drain_into(vector<value_type, Alloc>& v) {
+            v.reserve(v.size() + this_.size());
+            this_.pop_back_n(this_.size(), mystl::back_inserter(v));
+        }
         template<class... Args>
         void emplace_back(Args&&... args) {
             this_.emplace_back(mystl::forward<Args>(args)...);
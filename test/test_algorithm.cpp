@@ -0,0 +1,324 @@
+#include <gtest/gtest.h>
+#include "../algorithm.h"
+#include "../vector.h"
+#include "../deque.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ::mystl;
+
+class AlgorithmTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+namespace {
+std::vector<int> random_ints(size_t n, int mod, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<int> v(n);
+  for (auto& x : v) x = static_cast<int>(gen() % mod);
+  return v;
+}
+}  // namespace
+
+TEST_F(AlgorithmTest, sort) {
+  for (size_t n : {0, 1, 2, 15, 16, 17, 100, 10000}) {
+    for (int mod : {3, 1000000}) {
+      auto ref = random_ints(n, mod, static_cast<unsigned>(n));
+      vector<int> v(ref.data(), ref.data() + ref.size());
+      mystl::sort(v.begin(), v.end());
+      std::sort(ref.begin(), ref.end());
+      ASSERT_TRUE(std::equal(ref.begin(), ref.end(), v.begin()));
+    }
+  }
+
+  int array[] = {5, 3, 9, 1, 7};
+  mystl::sort(array, array + 5, mystl::greater<int>());
+  int expect[] = {9, 7, 5, 3, 1};
+  ASSERT_TRUE(std::equal(array, array + 5, expect));
+}
+
+// 已有序、逆序、锯齿等易使快排退化的输入
+TEST_F(AlgorithmTest, sort_patterns) {
+  const int n = 50000;
+  std::vector<int> asc(n), desc(n), organ(n), saw(n);
+  for (int i = 0; i < n; ++i) {
+    asc[i] = i;
+    desc[i] = n - i;
+    organ[i] = i < n / 2 ? i : n - i;
+    saw[i] = i % 64;
+  }
+  for (auto* p : {&asc, &desc, &organ, &saw}) {
+    std::vector<int> ref = *p;
+    std::sort(ref.begin(), ref.end());
+    mystl::sort(p->data(), p->data() + n);
+    ASSERT_TRUE(*p == ref);
+  }
+}
+
+TEST_F(AlgorithmTest, sort_deque) {
+  for (size_t n : {10, 100, 1000, 20000}) {
+    auto ref = random_ints(n, 1000, 3);
+    deque<int> d;
+    for (int x : ref) d.push_back(x);
+    d.pop_front();// 使首元素不位于缓冲区开头
+    ref.erase(ref.begin());
+    mystl::sort(d.begin(), d.end());
+    std::sort(ref.begin(), ref.end());
+    for (size_t i = 0; i < ref.size(); ++i) ASSERT_TRUE(d[i] == ref[i]);
+
+    deque<int> d2;
+    for (int x : ref) d2.push_front(x);
+    mystl::stable_sort(d2.begin() + 1, d2.end() - 1, mystl::greater<int>());
+    for (size_t i = 2; i + 1 < d2.size(); ++i) ASSERT_TRUE(d2[i - 1] >= d2[i]);
+  }
+}
+
+TEST_F(AlgorithmTest, stable_sort) {
+  using P = std::pair<int, int>;
+  std::mt19937 gen(11);
+  std::vector<P> v;
+  for (int i = 0; i < 5000; ++i) v.emplace_back(static_cast<int>(gen() % 50), i);
+  auto ref = v;
+  auto by_first = [](const P& a, const P& b) { return a.first < b.first; };
+  mystl::stable_sort(v.data(), v.data() + v.size(), by_first);
+  std::stable_sort(ref.begin(), ref.end(), by_first);
+  ASSERT_TRUE(v == ref);
+
+  vector<std::string> s = {"pear", "fig", "apple", "kiwi", "plum", "date", "lime", "yam"};
+  mystl::stable_sort(s.begin(), s.end(),
+                     [](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+  vector<std::string> expect = {"fig", "yam", "pear", "kiwi", "plum", "date", "lime", "apple"};
+  ASSERT_TRUE(s == expect);
+}
+
+TEST_F(AlgorithmTest, partial_sort) {
+  auto ref = random_ints(1000, 100000, 5);
+  vector<int> v(ref.data(), ref.data() + ref.size());
+  mystl::partial_sort(v.begin(), v.begin() + 10, v.end());
+  std::partial_sort(ref.begin(), ref.begin() + 10, ref.end());
+  ASSERT_TRUE(std::equal(ref.begin(), ref.begin() + 10, v.begin()));
+  ASSERT_TRUE(std::is_permutation(ref.begin(), ref.end(), v.begin()));
+}
+
+TEST_F(AlgorithmTest, nth_element) {
+  for (size_t n : {1, 5, 100, 10000}) {
+    auto ref = random_ints(n, 50, static_cast<unsigned>(n));
+    std::sort(ref.begin(), ref.end());
+    for (size_t k : {size_t(0), n / 2, n - 1}) {
+      auto v = random_ints(n, 50, static_cast<unsigned>(n));
+      int* first = v.data();
+      mystl::nth_element(first, first + k, first + n);
+      ASSERT_TRUE(v[k] == ref[k]);
+      for (size_t i = 0; i < k; ++i) ASSERT_TRUE(v[i] <= v[k]);
+      for (size_t i = k + 1; i < n; ++i) ASSERT_TRUE(v[k] <= v[i]);
+    }
+  }
+}
+
+TEST_F(AlgorithmTest, bound_rotate) {
+  int array[] = {1, 2, 2, 2, 5, 7};
+  ASSERT_TRUE(mystl::lower_bound(array, array + 6, 2) == array + 1);
+  ASSERT_TRUE(mystl::upper_bound(array, array + 6, 2) == array + 4);
+  ASSERT_TRUE(mystl::lower_bound(array, array + 6, 8) == array + 6);
+
+  int r[] = {1, 2, 3, 4, 5};
+  ASSERT_TRUE(mystl::rotate(r, r + 2, r + 5) == r + 3);
+  int expect[] = {3, 4, 5, 1, 2};
+  ASSERT_TRUE(std::equal(r, r + 5, expect));
+}
+
+TEST_F(AlgorithmTest, binary_search) {
+  for (size_t n : {0, 1, 2, 3, 7, 8, 100, 1000, 100000}) {
+    auto v = random_ints(n, static_cast<int>(n / 2 + 1), static_cast<unsigned>(n) + 7);
+    std::sort(v.begin(), v.end());
+    const int* first = v.data();
+    const int* last = v.data() + n;
+    for (int key = -1; key <= static_cast<int>(n / 2 + 2); ++key) {
+      ASSERT_TRUE(mystl::lower_bound(first, last, key) == std::lower_bound(first, last, key));
+      ASSERT_TRUE(mystl::upper_bound(first, last, key) == std::upper_bound(first, last, key));
+      auto r = mystl::equal_range(first, last, key);
+      auto e = std::equal_range(first, last, key);
+      ASSERT_TRUE(r.first == e.first && r.second == e.second);
+      ASSERT_TRUE(mystl::binary_search(first, last, key) == std::binary_search(first, last, key));
+    }
+  }
+
+  // 自定义比较与非随机访问迭代器
+  int desc[] = {9, 7, 7, 4, 1};
+  ASSERT_TRUE(mystl::lower_bound(desc, desc + 5, 7, mystl::greater<int>()) == desc + 1);
+  ASSERT_TRUE(mystl::upper_bound(desc, desc + 5, 7, mystl::greater<int>()) == desc + 3);
+  ASSERT_TRUE(!mystl::binary_search(desc, desc + 5, 5, mystl::greater<int>()));
+
+  deque<int> d;
+  for (int i = 0; i < 1000; ++i) d.push_back(i * 2);
+  ASSERT_TRUE(mystl::lower_bound(d.begin(), d.end(), 501) - d.begin() == 251);
+  ASSERT_TRUE(mystl::binary_search(d.begin(), d.end(), 500));
+}
+
+TEST_F(AlgorithmTest, radix_sort) {
+  std::mt19937_64 gen(13);
+  for (size_t n : {0, 1, 50, 1000, 100000}) {
+    std::vector<uint32_t> u32(n);
+    std::vector<int64_t> i64(n);
+    std::vector<float> f(n);
+    std::vector<double> d(n);
+    for (size_t i = 0; i < n; ++i) {
+      u32[i] = static_cast<uint32_t>(gen());
+      i64[i] = static_cast<int64_t>(gen());
+      f[i] = static_cast<float>(static_cast<int32_t>(gen() % 200000) - 100000) / 7.0f;
+      d[i] = static_cast<double>(static_cast<int64_t>(gen())) * 1e-9;
+    }
+    vector<uint32_t> mu(u32.data(), u32.data() + n);
+    mystl::radix_sort(mu.begin(), mu.end());
+    std::sort(u32.begin(), u32.end());
+    ASSERT_TRUE(std::equal(u32.begin(), u32.end(), mu.begin()));
+
+    auto i64_ref = i64;
+    mystl::radix_sort(i64.data(), i64.data() + n);
+    std::sort(i64_ref.begin(), i64_ref.end());
+    ASSERT_TRUE(i64 == i64_ref);
+
+    auto f_ref = f;
+    mystl::radix_sort(f.data(), f.data() + n);
+    std::sort(f_ref.begin(), f_ref.end());
+    ASSERT_TRUE(f == f_ref);
+
+    auto d_ref = d;
+    mystl::radix_sort(d.data(), d.data() + n);
+    std::sort(d_ref.begin(), d_ref.end());
+    ASSERT_TRUE(d == d_ref);
+  }
+
+  short s[] = {3, -1, 32767, -32768, 0, -1};
+  mystl::radix_sort(s, s + 6);
+  short expect[] = {-32768, -1, -1, 0, 3, 32767};
+  ASSERT_TRUE(std::equal(s, s + 6, expect));
+}
+
+// 按字段排序，相同键保持原有顺序
+TEST_F(AlgorithmTest, radix_sort_projection) {
+  struct record {
+    std::string name;
+    uint16_t level;
+    int order;
+  };
+  std::mt19937 gen(17);
+  std::vector<record> v;
+  for (int i = 0; i < 5000; ++i) v.push_back({"r" + std::to_string(i), static_cast<uint16_t>(gen() % 300), i});
+  auto ref = v;
+  mystl::radix_sort(v.data(), v.data() + v.size(), [](const record& r) { return r.level; });
+  std::stable_sort(ref.begin(), ref.end(), [](const record& a, const record& b) { return a.level < b.level; });
+  for (size_t i = 0; i < v.size(); ++i) ASSERT_TRUE(v[i].order == ref[i].order && v[i].name == ref[i].name);
+
+  using P = std::pair<float, int>;
+  std::vector<P> kv;
+  for (int i = 0; i < 1000; ++i) kv.emplace_back(static_cast<float>(gen() % 100) - 50.0f, i);
+  auto kv_ref = kv;
+  mystl::radix_sort(kv.data(), kv.data() + kv.size(), [](const P& p) { return p.first; });
+  std::stable_sort(kv_ref.begin(), kv_ref.end(), [](const P& a, const P& b) { return a.first < b.first; });
+  ASSERT_TRUE(kv == kv_ref);
+
+  deque<uint64_t> dq;
+  for (int i = 0; i < 3000; ++i) dq.push_front(gen());
+  mystl::radix_sort(dq.begin(), dq.end());
+  for (size_t i = 1; i < dq.size(); ++i) ASSERT_TRUE(dq[i - 1] <= dq[i]);
+}
+
+namespace {
+enum class color : unsigned char { red, green, blue };
+
+// 在每个位置放置目标值，覆盖向量化主循环与尾部
+template<class T>
+void check_find_count(T target, T other) {
+  for (size_t n : {0, 1, 7, 31, 64, 129, 1000}) {
+    std::vector<T> v(n, other);
+    ASSERT_TRUE(mystl::find(v.data(), v.data() + n, target) == v.data() + n);
+    ASSERT_TRUE(mystl::count(v.data(), v.data() + n, target) == 0);
+    for (size_t pos = 0; pos < n; pos += (n > 200 ? 37 : 1)) {
+      v[pos] = target;
+      ASSERT_TRUE(mystl::find(v.data(), v.data() + n, target) == v.data() + pos);
+      if (pos + 1 < n) v[n - 1] = target;
+      ASSERT_TRUE(mystl::count(v.data(), v.data() + n, target) ==
+                  std::count(v.begin(), v.end(), target));
+      v[pos] = other;
+      v[n - 1] = other;
+    }
+  }
+}
+}  // namespace
+
+TEST_F(AlgorithmTest, find_count) {
+  check_find_count<char>('x', 'a');
+  check_find_count<short>(-2, 3);
+  check_find_count<int>(123456, -1);
+  check_find_count<unsigned long long>(1ULL << 40, 1);
+  check_find_count<long long>(-1, (1LL << 32) - 1);// 低 32 位相同
+  int a = 0, b = 0;
+  check_find_count<int*>(&a, &b);
+  check_find_count<color>(color::blue, color::red);
+  check_find_count<double>(2.5, -0.0);
+
+  // 单字节通道计数器需要多次归并
+  std::vector<char> many(100003, 'z');
+  ASSERT_TRUE(mystl::count(many.data(), many.data() + many.size(), 'z') == 100003);
+
+  // 查找值类型与元素类型不同
+  unsigned char bytes[] = {1, 255, 3};
+  ASSERT_TRUE(mystl::find(bytes, bytes + 3, -1) == bytes + 3);
+  ASSERT_TRUE(mystl::find(bytes, bytes + 3, 255) == bytes + 1);
+  ASSERT_TRUE(mystl::count(bytes, bytes + 3, 256 + 3) == 0);
+  unsigned int u[] = {7, 0xFFFFFFFFu};
+  ASSERT_TRUE(mystl::find(u, u + 2, -1) == u + 1);
+  const int ci[] = {1, 2, 3};
+  ASSERT_TRUE(mystl::find(ci, ci + 3, 3L) == ci + 2);
+
+  vector<int> v = {1, 2, 3, 4, 5, 6};
+  ASSERT_TRUE(*mystl::find_if(v.begin(), v.end(), [](int x) { return x > 3; }) == 4);
+  ASSERT_TRUE(mystl::count_if(v.begin(), v.end(), [](int x) { return x % 2 == 0; }) == 3);
+  deque<int> d;
+  for (int i = 0; i < 1000; ++i) d.push_back(i % 10);
+  ASSERT_TRUE(mystl::count(d.begin(), d.end(), 3) == 100);
+  ASSERT_TRUE(mystl::find(d.begin(), d.end(), 9) == d.begin() + 9);
+}
+
+TEST_F(AlgorithmTest, mismatch_equal_compare) {
+  for (size_t n : {1, 15, 16, 33, 100}) {
+    std::vector<long long> x(n, 5), y(n, 5);
+    ASSERT_TRUE(mystl::equal(x.data(), x.data() + n, y.data()));
+    ASSERT_TRUE(mystl::mismatch(x.data(), x.data() + n, y.data()).first == x.data() + n);
+    for (size_t pos = 0; pos < n; ++pos) {
+      y[pos] = pos % 2 ? 4 : 6;
+      auto mm = mystl::mismatch(x.data(), x.data() + n, y.data());
+      ASSERT_TRUE(mm.first == x.data() + pos && mm.second == y.data() + pos);
+      ASSERT_FALSE(mystl::equal(x.data(), x.data() + n, y.data()));
+      ASSERT_TRUE(mystl::lexicographical_compare(x.data(), x.data() + n, y.data(), y.data() + n) == (pos % 2 == 0));
+      y[pos] = 5;
+    }
+  }
+
+  // 有符号字节不能直接用 memcmp
+  signed char s1[] = {-1, 0}, s2[] = {1, 0};
+  ASSERT_TRUE(mystl::lexicographical_compare(s1, s1 + 2, s2, s2 + 2));
+  const unsigned char u1[] = {1, 2}, u2[] = {1, 2, 0};
+  ASSERT_TRUE(mystl::lexicographical_compare(u1, u1 + 2, u2, u2 + 3));
+  ASSERT_FALSE(mystl::lexicographical_compare(u2, u2 + 3, u1, u1 + 2));
+  int i1[] = {1, 2, 3}, i2[] = {1, 2, 4, 0};
+  auto mm = mystl::mismatch(i1, i1 + 3, i2, i2 + 2);
+  ASSERT_TRUE(mm.first == i1 + 2 && mm.second == i2 + 2);
+
+  // 浮点数按值比较：+0.0 与 -0.0 相等
+  double d1[] = {0.0, 1.0}, d2[] = {-0.0, 1.0};
+  ASSERT_TRUE(mystl::equal(d1, d1 + 2, d2));
+
+  vector<int> v1 = {1, 2, 3}, v2 = {1, 2, 3};
+  ASSERT_TRUE(v1 == v2);
+  v2.back() = 4;
+  ASSERT_TRUE(v1 != v2);
+  vector<std::string> vs1 = {"a", "b"}, vs2 = {"a", "b"};
+  ASSERT_TRUE(vs1 == vs2);
+}
@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+#include "../alloc_trace.h"
+#include "../deque.h"
+#include "../hash_map.h"
+#include "../hive.h"
+#include "../list.h"
+#include "../unrolled_list.h"
+
+using namespace ::mystl;
+
+// 容器操作的分配预算：超出即说明引入了多余的分配
+class AllocTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        alloc_trace::instance().reset();
+        alloc_trace::instance().record_events(true);
+    }
+};
+
+namespace {
+  // 只能单遍读取的输入迭代器
+  struct counting_input_iterator {
+    using iterator_category = input_iterator_tag;
+    using value_type = int;
+    using difference_type = ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+
+    int i;
+    const int& operator*() const { return i; }
+    counting_input_iterator& operator++() { ++i; return *this; }
+    bool operator==(const counting_input_iterator& rhs) const { return i == rhs.i; }
+    bool operator!=(const counting_input_iterator& rhs) const { return i != rhs.i; }
+  };
+
+  // 容量从 0 倍增到 n 的扩容次数
+  size_t growth_steps(size_t n) {
+    size_t steps = 0;
+    for (size_t cap = 1; cap < n; cap *= 2) ++steps;
+    return steps + 1;
+  }
+}
+
+TEST_F(AllocTraceTest, trace) {
+  alloc_trace& t = alloc_trace::instance();
+  static const char site[] = "trace";
+  {
+    alloc_site scope(site);
+    int* p = traced_alloc<int>::allocate(4);
+    ASSERT_TRUE(t.allocations() == 1 && t.bytes_allocated() == 4 * sizeof(int));
+    ASSERT_TRUE(t.live_bytes() == 4 * sizeof(int) && t.peak_bytes() == 4 * sizeof(int));
+    traced_alloc<int>::deallocate(p, 4);
+  }
+  ASSERT_TRUE(t.deallocations() == 1 && t.live_bytes() == 0 && t.peak_bytes() == 4 * sizeof(int));
+  ASSERT_TRUE(t.events().size() == 2 && t.allocations_at(site) == 1);
+  ASSERT_TRUE(t.events()[0].kind == alloc_event::allocate && t.events()[0].site == site);
+  ASSERT_TRUE(t.events()[1].kind == alloc_event::deallocate && t.events()[1].bytes == 4 * sizeof(int));
+  ASSERT_TRUE(t.site() == nullptr);
+
+  // 嵌套的调用点
+  static const char outer[] = "outer", inner[] = "inner";
+  {
+    alloc_site a(outer);
+    traced_alloc<char>::deallocate(traced_alloc<char>::allocate(8), 8);
+    {
+      alloc_site b(inner);
+      traced_alloc<char>::deallocate(traced_alloc<char>::allocate(8), 8);
+    }
+    ASSERT_TRUE(t.site() == outer);
+  }
+  ASSERT_TRUE(t.allocations_at(outer) == 1 && t.allocations_at(inner) == 1);
+
+  t.record_events(false);
+  t.reset();
+  traced_alloc<char>::deallocate(traced_alloc<char>::allocate(8), 8);
+  ASSERT_TRUE(t.allocations() == 1 && t.events().empty());
+}
+
+TEST_F(AllocTraceTest, vector_budget) {
+  vector<int, traced_alloc<int>> v;
+  alloc_budget budget;
+  for (int i = 0; i < 1000; ++i) v.push_back(i);
+  ASSERT_TRUE(budget.allocations() <= growth_steps(1000));
+
+  // 容量足够时不分配
+  v.reserve(2100);
+  budget.restart();
+  for (int i = 0; i < 1000; ++i) v.push_back(i);
+  v.insert(v.begin() + 10, 3, 7);
+  ASSERT_TRUE(budget.allocations() == 0);
+
+  // 输入迭代器区间插入：扩容仍按倍增进行
+  budget.restart();
+  v.insert(v.begin() + 500, counting_input_iterator{0}, counting_input_iterator{3000});
+  ASSERT_TRUE(v.size() == 5003);
+  ASSERT_TRUE(budget.allocations() <= 2);
+}
+
+TEST_F(AllocTraceTest, list_budget) {
+  alloc_budget budget;
+  list<int, traced_alloc<int>> l;
+  ASSERT_TRUE(budget.allocations() == 1);      // 哨兵节点
+  budget.restart();
+  for (int i = 0; i < 100; ++i) l.push_back(100 - i);
+  ASSERT_TRUE(budget.allocations() == 100);
+
+  // 排序、翻转只重接指针
+  budget.restart();
+  l.sort();
+  l.reverse();
+  l.sort();
+  ASSERT_TRUE(budget.allocations() == 0 && budget.deallocations() == 0);
+
+  list<int, traced_alloc<int>> other;
+  budget.restart();
+  other.splice(other.end(), l);
+  ASSERT_TRUE(budget.allocations() == 0 && l.empty() && other.size() == 100);
+}
+
+TEST_F(AllocTraceTest, list_node_recycle) {
+  {
+    list<int, traced_alloc<int>> l;
+    l.reserve_nodes(64);
+    // 缓存足够时压入、弹出都不碰配置器
+    alloc_budget budget;
+    for (int round = 0; round < 100; ++round) {
+      for (int i = 0; i < 64; ++i) l.push_back(i);
+      while (!l.empty()) l.pop_front();
+    }
+    ASSERT_TRUE(budget.allocations() == 0 && budget.deallocations() == 0);
+
+    // LRU 式的摘取、改写、挂回
+    for (int i = 0; i < 64; ++i) l.push_back(i);
+    list<int, traced_alloc<int>> other;
+    budget.restart();
+    for (int i = 0; i < 1000; ++i) {
+      auto nh = l.extract(l.begin());
+      nh.value() = i;
+      l.insert(l.end(), mystl::move(nh));
+    }
+    other.insert(other.end(), l.extract(l.begin()));
+    ASSERT_TRUE(budget.allocations() == 0 && budget.deallocations() == 0);
+    ASSERT_TRUE(l.back() == 999 && other.size() == 1 && l.size() == 63);
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+}
+
+TEST_F(AllocTraceTest, deque_budget) {
+  const size_t buf = __deque_buf_size(sizeof(int));
+  {
+    deque<int, traced_alloc<int>> d;
+    alloc_budget budget;
+    for (int i = 0; i < 1000; ++i) d.push_back(i);
+    // 每个缓冲区一次，外加中控数组的扩张
+    ASSERT_TRUE(budget.allocations() <= 1000 / buf + 3);
+
+    // 中间插入在两端缓冲区有余量时不分配
+    d.pop_front();
+    budget.restart();
+    d.insert(d.begin() + 500, 7);
+    ASSERT_TRUE(budget.allocations() == 0);
+
+    // clear 只保留一个缓冲区
+    d.clear();
+    ASSERT_TRUE(alloc_trace::instance().live_bytes() <= buf * sizeof(int) + 64 * sizeof(int*));
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+}
+
+TEST_F(AllocTraceTest, deque_sliding_window) {
+  {
+    deque<int, traced_alloc<int>> d;
+    for (int i = 0; i < 1000; ++i) d.push_back(i);
+    const size_t window_bytes = alloc_trace::instance().live_bytes();
+    // 尾进头出，规模不变：中控数组就地平移到中央而不是不断倍增
+    for (int i = 0; i < 1000000; ++i) {
+      d.push_back(i);
+      d.pop_front();
+    }
+    ASSERT_TRUE(alloc_trace::instance().live_bytes() <= 2 * window_bytes);
+    ASSERT_TRUE(alloc_trace::instance().peak_bytes() <= 2 * window_bytes);
+
+    // shrink_to_fit 同时收缩中控数组
+    for (int i = 0; i < 100000; ++i) d.push_back(i);
+    d.erase(d.begin() + 100, d.end());
+    d.shrink_to_fit();
+    ASSERT_TRUE(alloc_trace::instance().live_bytes() <= window_bytes);
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+}
+
+TEST_F(AllocTraceTest, deque_pop_n) {
+  const size_t buf = __deque_buf_size(sizeof(int));
+  deque<int, traced_alloc<int>> d;
+  for (size_t i = 0; i < 20 * buf; ++i) d.push_back(static_cast<int>(i));
+  // 弹出跨越的整块缓冲区一次释放，不再分配
+  alloc_budget budget;
+  d.pop_front_n(10 * buf);
+  ASSERT_TRUE(budget.allocations() == 0 && budget.deallocations() == 10);
+  budget.restart();
+  d.pop_back_n(5 * buf);
+  ASSERT_TRUE(budget.allocations() == 0 && budget.deallocations() == 5);
+}
+
+TEST_F(AllocTraceTest, hash_map_churn) {
+  {
+    hash_map<int, int, mystl::hash<int>, mystl::equal_to<int>, traced_alloc<pair<const int, int>>> m;
+    // 控制字节与 slot 数组都经 Alloc 分配
+    m.reserve(64);
+    ASSERT_TRUE(alloc_trace::instance().allocations() == 2);
+    for (int i = 0; i < 64; ++i) m.insert(pair<const int, int>(i, i));
+    // 规模不变的删除、插入：删除处附近有空位时直接置空，已删除标记积累时在原数组上清除，不再分配
+    alloc_budget budget;
+    for (int i = 64; i < 10000; ++i) {
+      m.erase(i - 64);
+      m.insert(pair<const int, int>(i, i));
+    }
+    ASSERT_TRUE(budget.allocations() == 0 && m.size() == 64 && m.capacity() == 127);
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+}
+
+TEST_F(AllocTraceTest, hive_budget) {
+  {
+    hive<int, traced_alloc<int>> h;
+    for (int i = 0; i < 1000; ++i) h.insert(i);
+    for (auto it = h.begin(); it != h.end();) {
+      if (*it % 3 == 0) it = h.erase(it);
+      else ++it;
+    }
+    // 空槽复用，不分配
+    alloc_budget budget;
+    for (int i = 0; i < 300; ++i) h.insert(i);
+    ASSERT_TRUE(budget.allocations() == 0);
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+}
+
+TEST_F(AllocTraceTest, unrolled_list_budget) {
+  {
+    unrolled_list<int, traced_alloc<int>> l;
+    // 哨兵节点与数据节点都经 Alloc 分配
+    ASSERT_TRUE(alloc_trace::instance().allocations() == 1);
+    for (int i = 0; i < 1000; ++i) l.push_back(i);
+    ASSERT_TRUE(alloc_trace::instance().allocations() > 1);
+    l.clear();
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+  ASSERT_TRUE(alloc_trace::instance().allocations() == alloc_trace::instance().deallocations());
+}
+
+TEST_F(AllocTraceTest, no_leak) {
+  {
+    vector<int, traced_alloc<int>> v(100, 1);
+    list<int, traced_alloc<int>> l(100, 1);
+    deque<int, traced_alloc<int>> d;
+    for (int i = 0; i < 5000; ++i) {
+      d.push_front(i);
+      d.push_back(i);
+    }
+    for (int i = 0; i < 3000; ++i) d.pop_front();
+    ASSERT_TRUE(alloc_trace::instance().live_bytes() > 0);
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+  ASSERT_TRUE(alloc_trace::instance().allocations() == alloc_trace::instance().deallocations());
+}
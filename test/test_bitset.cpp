@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "../bitset.h"
+
+#include <bitset>
+#include <random>
+
+using namespace ::mystl;
+
+class BitsetTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+template<size_t N>
+bool same_bits(const bitset<N>& b, const std::bitset<N>& ref) {
+  for (size_t i = 0; i < N; ++i) {
+    if (b[i] != ref[i]) return false;
+  }
+  return b.count() == ref.count();
+}
+
+TEST_F(BitsetTest, basic) {
+  bitset<70> b;
+  ASSERT_TRUE(b.none() && b.size() == 70);
+  b.set(3).set(69);
+  ASSERT_TRUE(b.test(3) && b.test(69) && b.count() == 2);
+  ASSERT_THROW(b.test(70), std::out_of_range);
+  b[10] = true;
+  b.flip(3);
+  ASSERT_TRUE(!b[3] && b[10]);
+  ASSERT_TRUE(b.find_first() == 10 && b.find_next(10) == 69 && b.find_next(69) == 70);
+  b.set();
+  ASSERT_TRUE(b.all() && b.count() == 70);
+  b.reset(0);
+  ASSERT_TRUE(!b.all() && b.any());
+  ASSERT_THROW(b.to_ullong(), std::overflow_error);
+
+  bitset<8> small(0x1FF);
+  ASSERT_TRUE(small.to_ullong() == 0xFF && small.all());
+  ASSERT_TRUE((~small).none());
+}
+
+template<size_t N>
+void random_ops() {
+  std::mt19937_64 gen(N);
+  bitset<N> a, b;
+  std::bitset<N> ra, rb;
+  for (size_t i = 0; i < N; ++i) {
+    if (gen() % 2) { a[i] = true; ra[i] = true; }
+    if (gen() % 3 == 0) { b[i] = true; rb[i] = true; }
+  }
+  ASSERT_TRUE(same_bits(a & b, ra & rb));
+  ASSERT_TRUE(same_bits(a | b, ra | rb));
+  ASSERT_TRUE(same_bits(a ^ b, ra ^ rb));
+  ASSERT_TRUE(same_bits(~a, ~ra));
+  for (size_t shift : {size_t(0), size_t(1), size_t(5), size_t(63), size_t(64), size_t(65), size_t(130), N - 1, N, N + 3}) {
+    ASSERT_TRUE(same_bits(a << shift, ra << shift));
+    ASSERT_TRUE(same_bits(a >> shift, ra >> shift));
+  }
+  size_t pos = a.find_first(), expect = 0;
+  while (expect < N && !ra[expect]) ++expect;
+  while (pos != N) {
+    ASSERT_TRUE(pos == expect);
+    pos = a.find_next(pos);
+    ++expect;
+    while (expect < N && !ra[expect]) ++expect;
+  }
+  ASSERT_TRUE(expect == N);
+}
+
+TEST_F(BitsetTest, random_against_std) {
+  random_ops<1>();
+  random_ops<64>();
+  random_ops<100>();
+  random_ops<128>();
+  random_ops<1000>();
+}
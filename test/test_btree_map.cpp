@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "../btree_map.h"
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ::mystl;
+
+class BtreeMapTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+template<class M1, class M2>
+bool same_content(const M1& m, const M2& ref) {
+  if (m.size() != ref.size()) return false;
+  auto it = ref.begin();
+  for (auto& kv : m) {
+    if (kv.first != it->first || kv.second != it->second) return false;
+    ++it;
+  }
+  return true;
+}
+
+TEST_F(BtreeMapTest, ctor) {
+  btree_map<int, int> m0;
+  ASSERT_TRUE(m0.empty());
+  ASSERT_TRUE(m0.begin() == m0.end());
+  ASSERT_TRUE(m0.find(1) == m0.end());
+
+  btree_map<int, int> m1 = {{3, 30}, {1, 10}, {2, 20}};
+  ASSERT_TRUE(m1.size() == 3);
+  ASSERT_TRUE(m1.begin()->first == 1);
+  ASSERT_TRUE(m1.rbegin()->first == 3);
+
+  btree_map<int, int> m2(m1);
+  ASSERT_TRUE(m2 == m1);
+  btree_map<int, int> m3(mystl::move(m2));
+  ASSERT_TRUE(m3 == m1);
+  ASSERT_TRUE(m2.empty());
+  m2 = m3;
+  ASSERT_TRUE(m2 == m1);
+  m2[0] = 0;
+  ASSERT_TRUE(m2 != m1);
+  ASSERT_TRUE(m2 < m1);
+}
+
+TEST_F(BtreeMapTest, insert_order) {
+  std::mt19937 gen(1);
+  btree_map<int, int> m;
+  std::map<int, int> ref;
+  for (int i = 0; i < 20000; ++i) {
+    int k = static_cast<int>(gen() % 50000);
+    ASSERT_TRUE(m.insert(make_pair(k, i)).second == ref.insert({k, i}).second);
+  }
+  ASSERT_TRUE(same_content(m, ref));
+  ASSERT_TRUE(m.height() <= 4);
+
+  // 反向遍历
+  auto rit = ref.rbegin();
+  for (auto it = m.rbegin(); it != m.rend(); ++it, ++rit) ASSERT_TRUE(it->first == rit->first);
+}
+
+TEST_F(BtreeMapTest, bounds) {
+  btree_map<int, int> m;
+  for (int i = 0; i < 5000; ++i) m[i * 2] = i;
+  for (int k = -1; k < 10001; ++k) {
+    auto lb = m.lower_bound(k);
+    auto ub = m.upper_bound(k);
+    int expect_lb = k < 0 ? 0 : (k + 1) / 2 * 2;
+    int expect_ub = k < 0 ? 0 : k / 2 * 2 + 2;
+    if (expect_lb >= 10000) ASSERT_TRUE(lb == m.end());
+    else ASSERT_TRUE(lb->first == expect_lb);
+    if (expect_ub >= 10000) ASSERT_TRUE(ub == m.end());
+    else ASSERT_TRUE(ub->first == expect_ub);
+  }
+  auto r = m.equal_range(100);
+  ASSERT_TRUE(r.first->first == 100 && r.second->first == 102);
+  r = m.equal_range(101);
+  ASSERT_TRUE(r.first == r.second);
+}
+
+TEST_F(BtreeMapTest, erase) {
+  btree_map<int, int> m;
+  for (int i = 0; i < 10000; ++i) m[i] = i;
+  // erase 返回后继
+  for (auto it = m.begin(); it != m.end();) {
+    int k = it->first;
+    if (k % 3 == 0) {
+      it = m.erase(it);
+      if (it != m.end()) {
+        ASSERT_TRUE(it->first == k + 1);
+      }
+    } else {
+      ++it;
+    }
+  }
+  ASSERT_TRUE(m.size() == 6666);
+  for (int i = 0; i < 10000; ++i) ASSERT_TRUE(m.contains(i) == (i % 3 != 0));
+
+  auto first = m.lower_bound(1000), last = m.lower_bound(9000);
+  auto it = m.erase(first, last);
+  ASSERT_TRUE(it->first == 9001);
+  ASSERT_TRUE(m.size() == 666 + 666);
+  ASSERT_TRUE(m.erase(5000) == 0);
+  ASSERT_TRUE(m.erase(9001) == 1);
+
+  m.erase(m.begin(), m.end());
+  ASSERT_TRUE(m.empty());
+}
+
+TEST_F(BtreeMapTest, random_against_std) {
+  std::mt19937 gen(7);
+  btree_map<std::string, int> m;
+  std::map<std::string, int> ref;
+  for (int i = 0; i < 50000; ++i) {
+    std::string k = std::to_string(gen() % 3000);
+    switch (gen() % 4) {
+      case 0: case 1: m[k] = i; ref[k] = i; break;
+      case 2: ASSERT_TRUE(m.erase(k) == ref.erase(k)); break;
+      default: {
+        auto it = m.lower_bound(k);
+        auto rit = ref.lower_bound(k);
+        ASSERT_TRUE((it == m.end()) == (rit == ref.end()));
+        if (rit != ref.end()) {
+          ASSERT_TRUE(it->first == rit->first);
+        }
+      }
+    }
+  }
+  ASSERT_TRUE(same_content(m, ref));
+}
+
+TEST_F(BtreeMapTest, bulk_load) {
+  std::vector<pair<int, int>> v;
+  for (int i = 0; i < 100000; ++i) v.push_back(make_pair(i, -i));
+  btree_map<int, int> m(v.data(), v.data() + v.size());
+  ASSERT_TRUE(m.size() == 100000);
+  int expect = 0;
+  for (auto& kv : m) ASSERT_TRUE(kv.first == expect++ && kv.second == -kv.first);
+
+  // 装载后的树仍可正常增删
+  for (int i = 0; i < 100000; i += 2) ASSERT_TRUE(m.erase(i) == 1);
+  for (int i = 100000; i < 101000; ++i) m[i] = i;
+  ASSERT_TRUE(m.size() == 51000);
+  expect = 1;
+  for (auto it = m.begin(); it != m.lower_bound(100000); ++it, expect += 2) ASSERT_TRUE(it->first == expect);
+
+  // 非有序输入退化为逐个插入
+  int array[][2] = {{3, 0}, {1, 0}, {3, 1}};
+  btree_map<int, int> m2;
+  for (auto& a : array) m2.insert(make_pair(a[0], a[1]));
+  ASSERT_TRUE(m2.size() == 2 && m2.at(3) == 0);
+}
+
+TEST_F(BtreeMapTest, try_emplace) {
+  btree_map<int, std::unique_ptr<int>> m;
+  ASSERT_TRUE(m.try_emplace(1, new int(1)).second);
+  std::unique_ptr<int> p(new int(2));
+  ASSERT_FALSE(m.try_emplace(1, mystl::move(p)).second);
+  ASSERT_TRUE(p != nullptr);
+  ASSERT_TRUE(*m.at(1) == 1);
+
+  btree_map<std::string, int> m2;
+  m2.insert_or_assign("a", 1);
+  m2.insert_or_assign("a", 2);
+  ASSERT_TRUE(m2.size() == 1 && m2["a"] == 2);
+  ASSERT_THROW(m2.at("b"), std::out_of_range);
+}
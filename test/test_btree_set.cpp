@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "../btree_set.h"
+
+#include <random>
+#include <set>
+#include <string>
+
+using namespace ::mystl;
+
+class BtreeSetTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(BtreeSetTest, ctor) {
+  btree_set<int> s0;
+  ASSERT_TRUE(s0.empty());
+
+  int array[] = {5, 1, 3, 3, 1};
+  btree_set<int> s1(array, array + 5);
+  btree_set<int> s2 = {1, 3, 5};
+  ASSERT_TRUE(s1 == s2);
+  ASSERT_TRUE(*s1.begin() == 1 && *s1.rbegin() == 5);
+
+  btree_set<int, mystl::greater<int>> s3 = {1, 3, 5};
+  ASSERT_TRUE(*s3.begin() == 5);
+}
+
+TEST_F(BtreeSetTest, random_against_std) {
+  std::mt19937 gen(3);
+  btree_set<int> s;
+  std::set<int> ref;
+  for (int i = 0; i < 200000; ++i) {
+    int k = static_cast<int>(gen() % 20000);
+    if (gen() % 2) ASSERT_TRUE(s.insert(k).second == ref.insert(k).second);
+    else ASSERT_TRUE(s.erase(k) == ref.erase(k));
+  }
+  ASSERT_TRUE(s.size() == ref.size());
+  auto it = ref.begin();
+  for (int x : s) ASSERT_TRUE(x == *it++);
+  // 逐个删除直到清空
+  for (auto cur = s.begin(); cur != s.end();) cur = s.erase(cur);
+  ASSERT_TRUE(s.empty());
+  ASSERT_TRUE(s.height() == 0);
+}
+
+TEST_F(BtreeSetTest, strings) {
+  btree_set<std::string> s;
+  for (int i = 0; i < 1000; ++i) s.emplace(std::to_string(i));
+  ASSERT_TRUE(s.size() == 1000);
+  ASSERT_TRUE(*s.lower_bound("5") == "5");
+  ASSERT_TRUE(*s.upper_bound("5") == "50");
+  btree_set<std::string> copy(s);
+  ASSERT_TRUE(copy == s);
+  for (int i = 0; i < 1000; i += 2) copy.erase(std::to_string(i));
+  ASSERT_TRUE(copy.size() == 500);
+}
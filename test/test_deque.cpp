@@ -1,5 +1,7 @@
 #include "../deque.h"
+#include "../vector.h"
 #include <gtest/gtest.h>
+#include <memory>
 #include <string>
 
 using namespace ::mystl;
@@ -353,7 +355,7 @@ TEST_F(DequeTest, ERASE) {
   ds.erase(ds.begin() + 1, ds.begin() + 2);
   EXPECT_EQ(ds.size(), 1);
   ddi.erase(ddi.begin() + 1, ddi.begin() + 2);
-  EXPECT_EQ(ddi[1], deque<int>({1, 2, 3}));
+  EXPECT_EQ(ddi[0], deque<int>({1, 2, 3}));
   EXPECT_EQ(ddi.size(), 1);
 }
 
@@ -621,4 +623,218 @@ TEST_F(DequeTest, erase) {
 
   dint.erase(dint.end() - 2, dint.end());
   ASSERT_TRUE(*it == 4);
-}
\ No newline at end of file
+}
+TEST_F(DequeTest, map_recentre) {
+  // 尾进头出：元素整体向中控数组尾部滑动，需要反复平移回中央
+  deque<string> q;
+  int head = 0, tail = 0;
+  for (int round = 0; round < 20000; ++round) {
+    q.push_back(std::to_string(tail++));
+    if (round % 3 != 0) q.push_back(std::to_string(tail++));
+    while (q.size() > 100) {
+      ASSERT_TRUE(q.front() == std::to_string(head));
+      q.pop_front();
+      ++head;
+    }
+  }
+  for (size_t i = 0; i < q.size(); ++i) ASSERT_TRUE(q[i] == std::to_string(head + static_cast<int>(i)));
+
+  // 反方向：头进尾出
+  deque<int> r;
+  for (int i = 0; i < 50000; ++i) {
+    r.push_front(i);
+    if (r.size() > 300) r.pop_back();
+  }
+  ASSERT_TRUE(r.size() == 300 && r.front() == 49999 && r.back() == 49700);
+
+  // 两端交替增长
+  deque<int> a;
+  for (int i = 0; i < 10000; ++i) {
+    a.push_back(i);
+    a.push_front(-i);
+  }
+  ASSERT_TRUE(a.size() == 20000 && a.front() == -9999 && a.back() == 9999);
+  for (int i = 0; i < 10000; ++i) ASSERT_TRUE(a[9999 - i] == -i && a[10000 + i] == i);
+}
+
+TEST_F(DequeTest, shrink_to_fit) {
+  deque<int> d;
+  for (int i = 0; i < 100000; ++i) d.push_back(i);
+  d.erase(d.begin() + 10, d.end());
+  d.shrink_to_fit();
+  ASSERT_TRUE(d.size() == 10);
+  for (int i = 0; i < 10; ++i) ASSERT_TRUE(d[i] == i);
+  // 收缩后两端仍可继续增长
+  for (int i = 0; i < 1000; ++i) {
+    d.push_front(-1 - i);
+    d.push_back(10 + i);
+  }
+  ASSERT_TRUE(d.size() == 2010 && d.front() == -1000 && d.back() == 1009);
+  d.clear();
+  ASSERT_TRUE(d.empty());
+  d.push_back(1);
+  ASSERT_TRUE(d.front() == 1);
+}
+
+namespace {
+  // 只能单遍读取的输入迭代器
+  struct counting_input_iterator {
+    using iterator_category = input_iterator_tag;
+    using value_type = int;
+    using difference_type = ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+
+    int i;
+    const int& operator*() const { return i; }
+    counting_input_iterator& operator++() { ++i; return *this; }
+    bool operator==(const counting_input_iterator& rhs) const { return i == rhs.i; }
+    bool operator!=(const counting_input_iterator& rhs) const { return i != rhs.i; }
+  };
+}
+
+TEST_F(DequeTest, append_and_prepend_range) {
+  const size_t buf = __deque_buf_size(sizeof(int));
+  int arr[3000];
+  for (int i = 0; i < 3000; ++i) arr[i] = i;
+
+  // 跨越多个缓冲区
+  deque<int> d;
+  d.push_back(-1);
+  d.append_range(arr, arr + 3000);
+  ASSERT_TRUE(d.size() == 3001 && d.front() == -1 && d.back() == 2999);
+  for (int i = 0; i < 3000; ++i) ASSERT_TRUE(d[i + 1] == i);
+  d.prepend_range(arr, arr + 3000);
+  ASSERT_TRUE(d.size() == 6001 && d.front() == 0 && d[2999] == 2999 && d[3000] == -1);
+
+  // 恰好填满一个缓冲区
+  deque<int> e;
+  e.append_range(arr, arr + buf);
+  e.append_range(arr, arr + buf);
+  e.prepend_range(arr, arr + buf);
+  ASSERT_TRUE(e.size() == 3 * buf);
+  for (size_t i = 0; i < e.size(); ++i) ASSERT_TRUE(e[i] == static_cast<int>(i % buf));
+
+  // 非平凡元素
+  deque<string> s;
+  string words[] = {"x", "y", "z"};
+  s.append_range(words, words + 3);
+  s.prepend_range(words, words + 2);
+  ASSERT_TRUE(s.size() == 5 && s[0] == "x" && s[1] == "y" && s[2] == "x" && s[4] == "z");
+
+  // 输入迭代器
+  deque<int> f(2, 7);
+  f.append_range(counting_input_iterator{0}, counting_input_iterator{500});
+  f.prepend_range(counting_input_iterator{0}, counting_input_iterator{300});
+  ASSERT_TRUE(f.size() == 802);
+  for (int i = 0; i < 300; ++i) ASSERT_TRUE(f[i] == i);
+  ASSERT_TRUE(f[300] == 7 && f[301] == 7);
+  for (int i = 0; i < 500; ++i) ASSERT_TRUE(f[302 + i] == i);
+
+  // insert 在两端时走同一路径
+  deque<int> g;
+  g.insert(g.end(), arr, arr + 1000);
+  g.insert(g.begin(), arr, arr + 1000);
+  ASSERT_TRUE(g.size() == 2000 && g[999] == 999 && g[1000] == 0);
+}
+
+TEST_F(DequeTest, pop_n) {
+  const int buf = static_cast<int>(__deque_buf_size(sizeof(int)));
+  deque<int> d;
+  for (int i = 0; i < 10 * buf; ++i) d.push_back(i);
+
+  // 在同一缓冲区内、恰好到缓冲区边界、跨越多个缓冲区
+  d.pop_front_n(3);
+  ASSERT_TRUE(d.front() == 3);
+  d.pop_front_n(buf - 3);
+  ASSERT_TRUE(d.front() == buf);
+  d.pop_front_n(2 * buf + 5);
+  ASSERT_TRUE(d.front() == 3 * buf + 5 && d.size() == static_cast<size_t>(7 * buf - 5));
+  d.pop_back_n(buf + 1);
+  ASSERT_TRUE(d.back() == 9 * buf - 2);
+  d.pop_back_n(0);
+  ASSERT_TRUE(d.back() == 9 * buf - 2);
+
+  vector<int> out;
+  d.pop_front_n(buf, back_inserter(out));
+  ASSERT_TRUE(out.size() == static_cast<size_t>(buf));
+  for (int i = 0; i < buf; ++i) ASSERT_TRUE(out[i] == 3 * buf + 5 + i);
+  out.clear();
+  d.pop_back_n(2 * buf, back_inserter(out));
+  for (int i = 0; i < 2 * buf; ++i) ASSERT_TRUE(out[i] == 9 * buf - 2 - i);
+
+  // 全部弹出后仍可继续使用
+  d.pop_front_n(d.size());
+  ASSERT_TRUE(d.empty());
+  d.push_front(1);
+  d.push_back(2);
+  ASSERT_TRUE(d.size() == 2 && d.front() == 1 && d.back() == 2);
+
+  deque<string> s;
+  for (int i = 0; i < 100; ++i) s.push_back(std::to_string(i) + string(30, '.'));
+  string moved[60];
+  s.pop_back_n(60, moved);
+  ASSERT_TRUE(moved[0] == "99" + string(30, '.') && s.size() == 40);
+  s.pop_front_n(40);
+  ASSERT_TRUE(s.empty());
+}
+
+namespace {
+  // 统计复制次数
+  struct copy_counter {
+    static int copies;
+    int v;
+
+    explicit copy_counter(int x = 0) : v(x) {}
+    copy_counter(const copy_counter& rhs) : v(rhs.v) { ++copies; }
+    copy_counter(copy_counter&& rhs) noexcept : v(rhs.v) {}
+    copy_counter& operator=(const copy_counter& rhs) { v = rhs.v; ++copies; return *this; }
+    copy_counter& operator=(copy_counter&& rhs) noexcept { v = rhs.v; return *this; }
+  };
+  int copy_counter::copies = 0;
+}
+
+TEST_F(DequeTest, move_only) {
+  deque<std::unique_ptr<int>> d;
+  for (int i = 0; i < 1000; ++i) d.push_back(std::unique_ptr<int>(new int(i)));
+  d.push_front(std::unique_ptr<int>(new int(-1)));
+  d.insert(d.begin() + 10, std::unique_ptr<int>(new int(-2)));
+  d.insert(d.end() - 10, std::unique_ptr<int>(new int(-3)));
+  d.emplace(d.begin() + 500, new int(-4));
+  ASSERT_TRUE(d.size() == 1004 && *d[10] == -2 && *d[500] == -4 && *d[d.size() - 11] == -3);
+  d.erase(d.begin() + 500);
+  d.erase(d.end() - 11);
+  d.erase(d.begin() + 10);
+  d.erase(d.begin(), d.begin() + 1);
+  for (int i = 0; i < 1000; ++i) ASSERT_TRUE(*d[i] == i);
+  d.erase(d.begin() + 100, d.begin() + 200);
+  ASSERT_TRUE(d.size() == 900 && *d[100] == 200);
+
+  deque<std::unique_ptr<int>> e(mystl::move(d));
+  d = mystl::move(e);
+  ASSERT_TRUE(d.size() == 900 && *d.back() == 999);
+
+  copy_counter::copies = 0;
+  deque<copy_counter> c;
+  for (int i = 0; i < 1000; ++i) c.push_back(copy_counter(i));
+  c.insert(c.begin() + 10, copy_counter(-1));
+  c.insert(c.end() - 10, copy_counter(-2));
+  c.erase(c.begin() + 5);
+  c.erase(c.end() - 5);
+  c.erase(c.begin() + 100, c.begin() + 110);
+  c.erase(c.end() - 110, c.end() - 100);
+  ASSERT_TRUE(copy_counter::copies == 0 && c.size() == 980);
+}
+
+// 空区间删除不能把元素移动赋值给自身
+TEST_F(DequeTest, erase_empty_range) {
+  deque<string> d;
+  for (int i = 0; i < 40; ++i) d.push_back(std::to_string(i) + "-long-enough-to-avoid-sso");
+  for (size_t pos : {size_t(0), size_t(5), size_t(20), size_t(35), size_t(40)}) {
+    auto it = d.erase(d.begin() + pos, d.begin() + pos);
+    ASSERT_TRUE(it == d.begin() + pos && d.size() == 40);
+  }
+  for (int i = 0; i < 40; ++i) ASSERT_TRUE(d[i] == std::to_string(i) + "-long-enough-to-avoid-sso");
+  deque<string> e;
+  ASSERT_TRUE(e.erase(e.begin(), e.end()) == e.end() && e.empty());
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include "../execution.h"
+#include "../vector.h"
+#include "../deque.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ::mystl;
+
+class ExecutionTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    thread_pool pool{4};
+};
+
+namespace {
+const size_t N = 300000;// 远大于一块，保证走并行路径
+
+std::vector<int> random_ints(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<int> v(n);
+  for (auto& x : v) x = static_cast<int>(gen() % 1000000);
+  return v;
+}
+}  // namespace
+
+TEST_F(ExecutionTest, work_steal_deque) {
+  __work_steal_deque<int> q(4);
+  int items[100];
+  for (int i = 0; i < 100; ++i) q.push(items + i);// 触发扩容
+  ASSERT_TRUE(q.steal() == items);
+  ASSERT_TRUE(q.pop() == items + 99);
+  for (int i = 98; i >= 1; --i) ASSERT_TRUE(q.pop() == items + i);
+  ASSERT_TRUE(q.empty());
+  ASSERT_TRUE(q.pop() == nullptr && q.steal() == nullptr);
+
+  // 所有者压入弹出的同时多个线程窃取，每个元素恰好被取走一次
+  std::vector<int> data(200000);
+  std::vector<std::atomic<int>> taken(data.size());
+  std::atomic<bool> finished{false};
+  auto thief = [&] {
+    while (!finished.load()) {
+      if (int* p = q.steal()) taken[p - data.data()].fetch_add(1);
+    }
+  };
+  std::thread t1(thief), t2(thief);
+  for (size_t i = 0; i < data.size(); ++i) {
+    q.push(&data[i]);
+    if (i % 3 == 0) {
+      if (int* p = q.pop()) taken[p - data.data()].fetch_add(1);
+    }
+  }
+  while (int* p = q.pop()) taken[p - data.data()].fetch_add(1);
+  finished.store(true);
+  t1.join();
+  t2.join();
+  while (int* p = q.steal()) taken[p - data.data()].fetch_add(1);
+  for (auto& c : taken) ASSERT_TRUE(c.load() == 1);
+}
+
+TEST_F(ExecutionTest, thread_pool) {
+  ASSERT_TRUE(pool.concurrency() == 4);
+  std::vector<int> hits(100000);
+  pool.parallel_for(0, hits.size(), 100, [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i) ++hits[i];
+  });
+  for (int h : hits) ASSERT_TRUE(h == 1);
+
+  int a = 0, b = 0;
+  pool.invoke([&] { a = 1; }, [&] { b = 2; });
+  ASSERT_TRUE(a == 1 && b == 2);
+  ASSERT_THROW(pool.invoke([] {}, [] { throw std::runtime_error("task"); }), std::runtime_error);
+  ASSERT_THROW(pool.parallel_for(0, 1000, 10, [](size_t b, size_t) {
+    if (b >= 500) throw std::logic_error("chunk");
+  }), std::logic_error);
+
+  thread_pool single(1);// 只有调用线程
+  ASSERT_TRUE(single.concurrency() == 1);
+  long sum = 0;
+  single.parallel_for(0, 1000, 10, [&](size_t b, size_t e) { for (size_t i = b; i < e; ++i) sum += long(i); });
+  ASSERT_TRUE(sum == 999 * 1000 / 2);
+}
+
+TEST_F(ExecutionTest, for_each_fill_copy_transform) {
+  auto par = execution::par.on(pool);
+  vector<int> v(N, 1);
+  mystl::for_each(par, v.begin(), v.end(), [](int& x) { x *= 3; });
+  ASSERT_TRUE(std::count(v.begin(), v.end(), 3) == long(N));
+
+  deque<int> d;
+  for (size_t i = 0; i < N; ++i) d.push_back(0);
+  mystl::fill(par, d.begin() + 1, d.end(), 7);
+  ASSERT_TRUE(d[0] == 0 && d[1] == 7 && d[N - 1] == 7);
+  mystl::for_each(par, d.begin(), d.end(), [](int& x) { ++x; });
+  ASSERT_TRUE(d[0] == 1 && d[N / 2] == 8);
+
+  vector<int> out(N);
+  ASSERT_TRUE(mystl::copy(par, d.begin(), d.end(), out.begin()) == out.end());
+  ASSERT_TRUE(out[0] == 1 && out[N - 1] == 8);
+
+  auto src = random_ints(N, 1);
+  ASSERT_TRUE(mystl::transform(par, src.data(), src.data() + N, out.begin(), [](int x) { return x * 2; }) == out.end());
+  for (size_t i = 0; i < N; ++i) ASSERT_TRUE(out[i] == src[i] * 2);
+  mystl::transform(par, src.data(), src.data() + N, out.begin(), out.begin(), [](int x, int y) { return y - x; });
+  for (size_t i = 0; i < N; ++i) ASSERT_TRUE(out[i] == src[i]);
+
+  // 串行策略与默认线程池
+  mystl::fill(execution::seq, v.begin(), v.end(), 5);
+  mystl::fill(execution::par, v.begin(), v.end(), 6);
+  ASSERT_TRUE(std::count(v.begin(), v.end(), 6) == long(N));
+}
+
+TEST_F(ExecutionTest, reduce_scan) {
+  auto par = execution::par.on(pool);
+  auto src = random_ints(N, 2);
+  const long expect = std::accumulate(src.begin(), src.end(), 10L);
+  ASSERT_TRUE(mystl::reduce(par, src.data(), src.data() + N, 10L) == expect);
+  ASSERT_TRUE(mystl::reduce(execution::seq, src.data(), src.data() + N, 10L) == expect);
+  ASSERT_TRUE(mystl::reduce(par, src.data(), src.data() + 5) == src[0] + src[1] + src[2] + src[3] + src[4]);
+  ASSERT_TRUE(mystl::reduce(par, src.data(), src.data() + N, 0, [](int a, int b) { return std::max(a, b); }) ==
+              *std::max_element(src.begin(), src.end()));
+
+  std::vector<long> in(src.begin(), src.end());
+  std::vector<long> ref(N);
+  std::partial_sum(in.begin(), in.end(), ref.begin());
+  vector<long> out(N);
+  mystl::inclusive_scan(par, in.data(), in.data() + N, out.begin());
+  ASSERT_TRUE(std::equal(ref.begin(), ref.end(), out.begin()));
+  mystl::inclusive_scan(par, in.data(), in.data() + N, out.begin(), mystl::plus<long>(), 100L);
+  for (size_t i = 0; i < N; ++i) ASSERT_TRUE(out[i] == ref[i] + 100);
+  // 原地扫描
+  mystl::inclusive_scan(par, in.data(), in.data() + N, in.data());
+  ASSERT_TRUE(in == ref);
+}
+
+TEST_F(ExecutionTest, sort) {
+  auto par = execution::par.on(pool);
+  auto ref = random_ints(N, 3);
+  vector<int> v(ref.data(), ref.data() + N);
+  mystl::sort(par, v.begin(), v.end());
+  std::sort(ref.begin(), ref.end());
+  ASSERT_TRUE(std::equal(ref.begin(), ref.end(), v.begin()));
+
+  mystl::sort(par, v.begin(), v.end(), mystl::greater<int>());
+  ASSERT_TRUE(std::equal(ref.rbegin(), ref.rend(), v.begin()));
+
+  // 大量重复元素
+  std::vector<int> dup(N);
+  for (size_t i = 0; i < N; ++i) dup[i] = int(i % 7);
+  mystl::sort(par, dup.data(), dup.data() + N);
+  ASSERT_TRUE(std::is_sorted(dup.begin(), dup.end()));
+
+  deque<int> d;
+  auto src = random_ints(N, 4);
+  for (int x : src) d.push_front(x);
+  mystl::sort(par, d.begin(), d.end());
+  std::sort(src.begin(), src.end());
+  for (size_t i = 0; i < N; ++i) ASSERT_TRUE(d[i] == src[i]);
+}
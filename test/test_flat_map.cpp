@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "../flat_map.h"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ::mystl;
+
+class FlatMapTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+template<class M1, class M2>
+bool same_content(const M1& m, const M2& ref) {
+  if (m.size() != ref.size()) return false;
+  auto it = ref.begin();
+  for (auto kv : m) {
+    if (kv.first != it->first || kv.second != it->second) return false;
+    ++it;
+  }
+  return true;
+}
+
+TEST_F(FlatMapTest, ctor) {
+  flat_map<int, int> m0;
+  ASSERT_TRUE(m0.empty());
+  ASSERT_TRUE(m0.begin() == m0.end());
+  ASSERT_TRUE(m0.find(1) == m0.end());
+
+  // 重复键保留最先出现的
+  flat_map<int, int> m1 = {{3, 30}, {1, 10}, {2, 20}, {1, 11}};
+  ASSERT_TRUE(m1.size() == 3);
+  ASSERT_TRUE(m1.begin()->first == 1 && m1.begin()->second == 10);
+  ASSERT_TRUE((*m1.rbegin()).first == 3);
+  ASSERT_TRUE(m1.end() - m1.begin() == 3);
+  ASSERT_TRUE(m1.begin()[1].second == 20);
+
+  flat_map<int, int> m2(m1);
+  ASSERT_TRUE(m2 == m1);
+  flat_map<int, int> m3(mystl::move(m2));
+  ASSERT_TRUE(m3 == m1);
+  ASSERT_TRUE(m2.empty());
+  m2 = m3;
+  ASSERT_TRUE(m2 == m1);
+  m2[0] = 0;
+  ASSERT_TRUE(m2 != m1);
+  ASSERT_TRUE(m2 < m1);
+
+  vector<int> keys = {1, 4, 9};
+  vector<std::string> values = {"a", "b", "c"};
+  flat_map<int, std::string> m4(sorted_unique, keys, values);
+  ASSERT_TRUE(m4.at(4) == "b");
+  ASSERT_TRUE(m4.keys() == keys && m4.values() == values);
+
+  flat_map<int, int, mystl::greater<int>> m5 = {{1, 1}, {3, 3}, {2, 2}};
+  ASSERT_TRUE(m5.begin()->first == 3);
+}
+
+TEST_F(FlatMapTest, insert_find_erase) {
+  std::mt19937 gen(5);
+  flat_map<int, int> m;
+  std::map<int, int> ref;
+  for (int i = 0; i < 5000; ++i) {
+    int k = static_cast<int>(gen() % 3000);
+    switch (gen() % 4) {
+      case 0: ASSERT_TRUE(m.insert(make_pair(k, i)).second == ref.insert({k, i}).second); break;
+      case 1: m[k] = i; ref[k] = i; break;
+      case 2: ASSERT_TRUE(m.erase(k) == ref.erase(k)); break;
+      default: ASSERT_TRUE(m.insert_or_assign(k, i).second == ref.insert_or_assign(k, i).second); break;
+    }
+  }
+  ASSERT_TRUE(same_content(m, ref));
+  for (int k = -1; k <= 3001; ++k) {
+    auto it = m.lower_bound(k);
+    auto rit = ref.lower_bound(k);
+    ASSERT_TRUE((it == m.end()) == (rit == ref.end()));
+    if (rit != ref.end()) {
+      ASSERT_TRUE(it->first == rit->first);
+    }
+    ASSERT_TRUE(m.contains(k) == (ref.count(k) == 1));
+    auto r = m.equal_range(k);
+    ASSERT_TRUE(r.second - r.first == static_cast<ptrdiff_t>(ref.count(k)));
+  }
+
+  ASSERT_THROW(m.at(-5), std::out_of_range);
+  auto it = m.erase(m.begin(), m.begin() + 10);
+  ASSERT_TRUE(it == m.begin());
+  ASSERT_TRUE(m.size() == ref.size() - 10);
+}
+
+TEST_F(FlatMapTest, try_emplace) {
+  flat_map<std::string, std::string> m;
+  std::string k = "key", v = "value";
+  ASSERT_TRUE(m.try_emplace(mystl::move(k), mystl::move(v)).second);
+  ASSERT_TRUE(k.empty() && v.empty());
+  k = "key";
+  v = "other";
+  ASSERT_TRUE(!m.try_emplace(mystl::move(k), mystl::move(v)).second);
+  ASSERT_TRUE(k == "key" && v == "other");
+  ASSERT_TRUE(m.at("key") == "value");
+  ASSERT_TRUE(m.emplace("a", "b").second);
+  ASSERT_TRUE(m.begin()->first == "a");
+}
+
+TEST_F(FlatMapTest, batch_insert) {
+  std::mt19937 gen(9);
+  flat_map<int, int> m;
+  std::map<int, int> ref;
+  for (int round = 0; round < 20; ++round) {
+    std::vector<pair<int, int>> batch;
+    for (int i = 0; i < 500; ++i) {
+      int k = static_cast<int>(gen() % 20000);
+      batch.push_back(make_pair(k, round * 1000 + i));
+      ref.insert({k, round * 1000 + i});// 与 flat_map 一致：已存在和批内重复的键保留最先出现的值
+    }
+    m.insert(batch.data(), batch.data() + batch.size());
+    ASSERT_TRUE(same_content(m, ref));
+  }
+
+  std::vector<pair<int, int>> sorted = {{-3, 1}, {-2, 2}, {100000, 3}};
+  m.insert(sorted_unique, sorted.data(), sorted.data() + sorted.size());
+  ASSERT_TRUE(m.begin()->first == -3 && (*m.rbegin()).first == 100000);
+}
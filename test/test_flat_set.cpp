@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "../flat_set.h"
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace ::mystl;
+
+class FlatSetTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(FlatSetTest, ctor) {
+  flat_set<int> s0;
+  ASSERT_TRUE(s0.empty());
+
+  int array[] = {5, 1, 3, 3, 1};
+  flat_set<int> s1(array, array + 5);
+  flat_set<int> s2 = {1, 3, 5};
+  ASSERT_TRUE(s1 == s2);
+  ASSERT_TRUE(*s1.begin() == 1 && *s1.rbegin() == 5);
+
+  flat_set<int, mystl::greater<int>> s3 = {1, 3, 5};
+  ASSERT_TRUE(*s3.begin() == 5);
+
+  flat_set<int> s4(sorted_unique, vector<int>{2, 4, 6});
+  ASSERT_TRUE(s4.contains(4) && !s4.contains(5));
+  vector<int> keys = mystl::move(s4).extract();
+  ASSERT_TRUE(keys.size() == 3 && s4.empty());
+}
+
+TEST_F(FlatSetTest, random_against_std) {
+  std::mt19937 gen(3);
+  flat_set<int> s;
+  std::set<int> ref;
+  for (int i = 0; i < 20000; ++i) {
+    int k = static_cast<int>(gen() % 2000);
+    if (gen() % 2) ASSERT_TRUE(s.insert(k).second == ref.insert(k).second);
+    else ASSERT_TRUE(s.erase(k) == ref.erase(k));
+  }
+  ASSERT_TRUE(s.size() == ref.size());
+  auto it = ref.begin();
+  for (int x : s) ASSERT_TRUE(x == *it++);
+  for (int k = -1; k <= 2001; ++k) {
+    ASSERT_TRUE(s.count(k) == ref.count(k));
+    auto r = s.equal_range(k);
+    ASSERT_TRUE(r.second - r.first == static_cast<ptrdiff_t>(ref.count(k)));
+    auto u = s.upper_bound(k);
+    ASSERT_TRUE(u == s.end() ? ref.upper_bound(k) == ref.end() : *u == *ref.upper_bound(k));
+  }
+}
+
+TEST_F(FlatSetTest, batch_insert) {
+  std::mt19937 gen(4);
+  flat_set<std::string> s;
+  std::set<std::string> ref;
+  for (int round = 0; round < 10; ++round) {
+    std::vector<std::string> batch;
+    for (int i = 0; i < 300; ++i) batch.push_back(std::to_string(gen() % 5000));
+    s.insert(batch.data(), batch.data() + batch.size());
+    ref.insert(batch.begin(), batch.end());
+    ASSERT_TRUE(s.size() == ref.size());
+    auto it = ref.begin();
+    for (const auto& x : s) ASSERT_TRUE(x == *it++);
+  }
+  s.insert({"0", "zzz"});
+  ASSERT_TRUE(*s.rbegin() == "zzz");
+}
+
+TEST_F(FlatSetTest, erase_empty_range) {
+  flat_set<std::string> s;
+  for (int i = 0; i < 40; ++i) s.insert(std::to_string(i) + "-long-enough-to-avoid-sso");
+  auto p = s.begin() + 3;
+  s.erase(p, p);
+  s.erase(s.begin(), s.begin());
+  ASSERT_TRUE(s.size() == 40);
+  for (int i = 0; i < 40; ++i) ASSERT_TRUE(s.count(std::to_string(i) + "-long-enough-to-avoid-sso") == 1);
+}
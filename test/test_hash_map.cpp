@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include "../hash_map.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <random>
+#include <memory>
+
+using namespace ::mystl;
+
+class HashMapTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(HashMapTest, ctor) {
+  hash_map<int, int> m0;
+  ASSERT_TRUE(m0.empty());
+  ASSERT_TRUE(m0.begin() == m0.end());
+  ASSERT_TRUE(m0.find(1) == m0.end());
+  ASSERT_TRUE(m0.capacity() == 0);
+
+  hash_map<int, int> m1 = {{1, 10}, {2, 20}, {3, 30}};
+  ASSERT_TRUE(m1.size() == 3);
+  ASSERT_TRUE(m1.at(2) == 20);
+
+  hash_map<int, int> m2(m1);
+  ASSERT_TRUE(m2 == m1);
+  hash_map<int, int> m3(mystl::move(m2));
+  ASSERT_TRUE(m3 == m1);
+  ASSERT_TRUE(m2.empty());
+
+  m2 = m3;
+  ASSERT_TRUE(m2 == m1);
+  m2[4] = 40;
+  ASSERT_TRUE(m2 != m1);
+}
+
+TEST_F(HashMapTest, insert_find) {
+  hash_map<int, int> m;
+  for (int i = 0; i < 10000; ++i) {
+    auto res = m.insert(make_pair(i, i * 2));
+    ASSERT_TRUE(res.second);
+    ASSERT_TRUE(res.first->second == i * 2);
+  }
+  ASSERT_TRUE(m.size() == 10000);
+  ASSERT_FALSE(m.insert(make_pair(5, 0)).second);
+  for (int i = 0; i < 10000; ++i) ASSERT_TRUE(m.at(i) == i * 2);
+  ASSERT_TRUE(m.count(10000) == 0);
+  ASSERT_THROW(m.at(-1), std::out_of_range);
+
+  size_t n = 0;
+  for (auto& kv : m) {
+    ASSERT_TRUE(kv.second == kv.first * 2);
+    ++n;
+  }
+  ASSERT_TRUE(n == m.size());
+}
+
+TEST_F(HashMapTest, try_emplace) {
+  hash_map<std::string, std::unique_ptr<int>> m;
+  auto res = m.try_emplace("a", new int(1));
+  ASSERT_TRUE(res.second);
+  std::unique_ptr<int> p(new int(2));
+  res = m.try_emplace("a", mystl::move(p));
+  ASSERT_FALSE(res.second);
+  ASSERT_TRUE(p != nullptr);// 键已存在，不移动参数
+  ASSERT_TRUE(*m["a"] == 1);
+
+  hash_map<std::string, int> m2;
+  m2.insert_or_assign("x", 1);
+  m2.insert_or_assign("x", 2);
+  ASSERT_TRUE(m2.size() == 1 && m2["x"] == 2);
+  m2.emplace("y", 3);
+  ASSERT_TRUE(m2["y"] == 3);
+  ASSERT_TRUE(m2["z"] == 0);
+}
+
+TEST_F(HashMapTest, heterogeneous_lookup) {
+  hash_map<std::string, int, mystl::hash<std::string>, mystl::equal_to<void>> m;
+  m["apple"] = 1;
+  m["banana"] = 2;
+  std::string_view sv = "banana";
+  ASSERT_TRUE(m.find(sv) != m.end());
+  ASSERT_TRUE(m.find("apple")->second == 1);
+  ASSERT_TRUE(m.contains(std::string_view("apple")));
+  ASSERT_FALSE(m.contains("cherry"));
+  ASSERT_TRUE(m.erase(sv) == 1);
+  ASSERT_TRUE(m.size() == 1);
+}
+
+TEST_F(HashMapTest, erase) {
+  hash_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m[i] = i;
+  for (int i = 0; i < 1000; i += 2) ASSERT_TRUE(m.erase(i) == 1);
+  ASSERT_TRUE(m.erase(0) == 0);
+  ASSERT_TRUE(m.size() == 500);
+  for (int i = 0; i < 1000; ++i) ASSERT_TRUE(m.contains(i) == (i % 2 == 1));
+
+  for (auto it = m.begin(); it != m.end();) {
+    if (it->first % 3 == 0) it = m.erase(it);
+    else ++it;
+  }
+  for (auto& kv : m) ASSERT_TRUE(kv.first % 3 != 0);
+
+  m.erase(m.begin(), m.end());
+  ASSERT_TRUE(m.empty());
+  m.clear();
+  ASSERT_TRUE(m.begin() == m.end());
+}
+
+// 反复插入删除，表的容量不应因已删除标记而持续增长
+TEST_F(HashMapTest, churn_no_growth) {
+  hash_map<int, int> m;
+  m.reserve(1000);
+  const size_t cap = m.capacity();
+  for (int round = 0; round < 200; ++round) {
+    for (int i = 0; i < 1000; ++i) m[round * 1000 + i] = i;
+    for (int i = 0; i < 1000; ++i) m.erase(round * 1000 + i);
+  }
+  ASSERT_TRUE(m.empty());
+  ASSERT_TRUE(m.capacity() == cap);
+}
+
+// 规模不变的随机删除、插入会积累已删除标记，原地清除后所有元素仍能找到，容量不变
+TEST_F(HashMapTest, churn_rehash_in_place) {
+  std::mt19937 gen(11);
+  hash_map<int, std::string> m;
+  std::unordered_map<int, std::string> ref;
+  m.reserve(1000);
+  const size_t cap = m.capacity();
+  int next = 0;
+  for (; next < 850; ++next) {
+    m[next] = std::to_string(next);
+    ref[next] = std::to_string(next);
+  }
+  for (int i = 0; i < 50000; ++i) {
+    int k = static_cast<int>(gen() % static_cast<unsigned>(next));
+    ASSERT_TRUE(m.erase(k) == ref.erase(k));
+    if (m.size() < 850) {
+      m[next] = std::to_string(next);
+      ref[next] = std::to_string(next);
+      ++next;
+    }
+  }
+  ASSERT_TRUE(m.capacity() == cap);
+  ASSERT_TRUE(m.size() == ref.size());
+  for (auto& kv : ref) ASSERT_TRUE(m.at(kv.first) == kv.second);
+  size_t n = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) ++n;
+  ASSERT_TRUE(n == ref.size());
+}
+
+TEST_F(HashMapTest, reserve_rehash) {
+  hash_map<int, int> m;
+  m.reserve(5000);
+  const size_t cap = m.capacity();
+  ASSERT_TRUE(cap >= 5000);
+  for (int i = 0; i < 5000; ++i) m[i] = i;
+  ASSERT_TRUE(m.capacity() == cap);
+  ASSERT_TRUE(m.load_factor() <= 0.875f);
+
+  for (int i = 100; i < 5000; ++i) m.erase(i);
+  m.rehash(0);
+  ASSERT_TRUE(m.capacity() < cap);
+  for (int i = 0; i < 100; ++i) ASSERT_TRUE(m.at(i) == i);
+}
+
+TEST_F(HashMapTest, random_against_std) {
+  std::mt19937 gen(7);
+  hash_map<unsigned, unsigned> m;
+  std::unordered_map<unsigned, unsigned> ref;
+  for (int i = 0; i < 100000; ++i) {
+    unsigned k = gen() % 5000;
+    switch (gen() % 3) {
+      case 0: m[k] = i; ref[k] = i; break;
+      case 1: ASSERT_TRUE(m.erase(k) == ref.erase(k)); break;
+      default: ASSERT_TRUE(m.count(k) == ref.count(k));
+    }
+  }
+  ASSERT_TRUE(m.size() == ref.size());
+  for (auto& kv : ref) ASSERT_TRUE(m.at(kv.first) == kv.second);
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "../hash_set.h"
+
+#include <string>
+#include <string_view>
+
+using namespace ::mystl;
+
+class HashSetTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(HashSetTest, ctor) {
+  hash_set<int> s0;
+  ASSERT_TRUE(s0.empty());
+  ASSERT_TRUE(s0.begin() == s0.end());
+
+  int array[] = {1, 2, 3, 3, 2};
+  hash_set<int> s1(array, array + 5);
+  hash_set<int> s2 = {3, 2, 1};
+  ASSERT_TRUE(s1.size() == 3);
+  ASSERT_TRUE(s1 == s2);
+
+  hash_set<int> s3(s2);
+  ASSERT_TRUE(s3 == s2);
+  hash_set<int> s4(mystl::move(s3));
+  ASSERT_TRUE(s4 == s2);
+  ASSERT_TRUE(s3.empty());
+  s3.swap(s4);
+  ASSERT_TRUE(s3 == s2 && s4.empty());
+}
+
+TEST_F(HashSetTest, insert_erase) {
+  hash_set<std::string> s;
+  for (int i = 0; i < 2000; ++i) ASSERT_TRUE(s.insert(std::to_string(i)).second);
+  ASSERT_FALSE(s.emplace("7").second);
+  ASSERT_TRUE(s.size() == 2000);
+  for (int i = 0; i < 2000; i += 2) ASSERT_TRUE(s.erase(std::to_string(i)) == 1);
+  for (int i = 0; i < 2000; ++i) ASSERT_TRUE(s.contains(std::to_string(i)) == (i % 2 == 1));
+
+  size_t n = 0;
+  for (auto it = s.begin(); it != s.end(); ++it) ++n;
+  ASSERT_TRUE(n == 1000);
+}
+
+TEST_F(HashSetTest, heterogeneous_lookup) {
+  hash_set<std::string, mystl::hash<std::string>, mystl::equal_to<void>> s = {"red", "green"};
+  ASSERT_TRUE(s.contains("red"));
+  ASSERT_TRUE(s.find(std::string_view("green")) != s.end());
+  ASSERT_TRUE(s.count("blue") == 0);
+}
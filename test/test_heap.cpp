@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "../heap.h"
+#include "../vector.h"
+#include "../deque.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace ::mystl;
+
+class HeapTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    std::srand(11);
+    for (int i = 0; i < 1000; ++i) data.push_back(std::rand() % 500);
+  }
+  std::vector<int> data;
+};
+
+TEST_F(HeapTest, make_heap) {
+  vector<int> v(data.data(), data.data() + data.size());
+  make_heap(v.begin(), v.end());
+  ASSERT_TRUE(is_heap(v.begin(), v.end()));
+  ASSERT_TRUE(v.front() == *std::max_element(data.data(), data.data() + data.size()));
+
+  make_heap(v.begin(), v.end(), greater<int>());
+  ASSERT_TRUE(is_heap(v.begin(), v.end(), greater<int>()));
+  ASSERT_TRUE(v.front() == *std::min_element(data.data(), data.data() + data.size()));
+}
+
+TEST_F(HeapTest, push_pop_heap) {
+  vector<int> v;
+  for (int x : data) {
+    v.push_back(x);
+    push_heap(v.begin(), v.end());
+    ASSERT_TRUE(is_heap(v.begin(), v.end()));
+  }
+  std::vector<int> sorted(data);
+  std::sort(sorted.begin(), sorted.end());
+  for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+    ASSERT_TRUE(v.front() == *it);
+    pop_heap(v.begin(), v.end());
+    ASSERT_TRUE(v.back() == *it);
+    v.pop_back();
+  }
+  ASSERT_TRUE(v.empty());
+}
+
+TEST_F(HeapTest, sort_heap) {
+  vector<int> v(data.data(), data.data() + data.size());
+  make_heap(v.begin(), v.end());
+  sort_heap(v.begin(), v.end());
+  std::vector<int> sorted(data);
+  std::sort(sorted.begin(), sorted.end());
+  ASSERT_TRUE(std::equal(sorted.begin(), sorted.end(), v.begin()));
+
+  // deque 迭代器同样适用
+  deque<int> d(data.data(), data.data() + data.size());
+  make_heap(d.begin(), d.end(), greater<int>());
+  sort_heap(d.begin(), d.end(), greater<int>());
+  ASSERT_TRUE(std::equal(sorted.rbegin(), sorted.rend(), d.begin()));
+}
+
+TEST_F(HeapTest, non_trivial) {
+  vector<std::string> v;
+  for (int x : data) v.push_back(std::to_string(x));
+  mystl::make_heap(v.begin(), v.end());
+  mystl::sort_heap(v.begin(), v.end());
+  ASSERT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+TEST_F(HeapTest, dary_heap) {
+  vector<int> v(data.data(), data.data() + data.size());
+  dary_make_heap<4>(v.begin(), v.end(), less<int>());
+  ASSERT_TRUE(dary_is_heap<4>(v.begin(), v.end(), less<int>()));
+
+  vector<int> w;
+  for (int x : data) {
+    w.push_back(x);
+    dary_push_heap<3>(w.begin(), w.end(), greater<int>());
+  }
+  ASSERT_TRUE(dary_is_heap<3>(w.begin(), w.end(), greater<int>()));
+  std::vector<int> sorted(data);
+  std::sort(sorted.begin(), sorted.end());
+  for (int x : sorted) {
+    ASSERT_TRUE(w.front() == x);
+    dary_pop_heap<3>(w.begin(), w.end(), greater<int>());
+    w.pop_back();
+  }
+}
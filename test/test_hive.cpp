@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "../hive.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ::mystl;
+
+class HiveTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+namespace {
+  template<class T>
+  std::vector<T> sorted_contents(const hive<T>& h) {
+    std::vector<T> result;
+    for (const T& x : h) result.push_back(x);
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+}
+
+TEST_F(HiveTest, ctor) {
+  hive<int> h0;
+  ASSERT_TRUE(h0.empty() && h0.capacity() == 0);
+  ASSERT_TRUE(h0.begin() == h0.end());
+
+  hive<int> h1(20, 7);
+  ASSERT_TRUE(h1.size() == 20 && h1.capacity() >= 20);
+  ASSERT_TRUE(std::count(h1.begin(), h1.end(), 7) == 20);
+
+  hive<int> h2{1, 2, 3, 4, 5};
+  hive<int> h3(h2);
+  ASSERT_TRUE(sorted_contents(h3) == sorted_contents(h2));
+  hive<int> h4(mystl::move(h3));
+  ASSERT_TRUE(h4.size() == 5 && h3.empty() && h3.begin() == h3.end());
+  h3 = h4;
+  ASSERT_TRUE(sorted_contents(h3) == (std::vector<int>{1, 2, 3, 4, 5}));
+  h1 = mystl::move(h4);
+  ASSERT_TRUE(h1.size() == 5 && h4.empty());
+  swap(h1, h0);
+  ASSERT_TRUE(h0.size() == 5 && h1.empty());
+}
+
+TEST_F(HiveTest, iterate) {
+  hive<int> h;
+  for (int i = 0; i < 1000; ++i) h.insert(i);
+  // 没有删除时按插入顺序遍历
+  int expect = 0;
+  for (int x : h) ASSERT_TRUE(x == expect++);
+  ASSERT_TRUE(expect == 1000);
+
+  expect = 999;
+  for (auto it = h.rbegin(); it != h.rend(); ++it) ASSERT_TRUE(*it == expect--);
+
+  const hive<int>& ch = h;
+  ASSERT_TRUE(mystl::distance(ch.begin(), ch.end()) == 1000);
+  ASSERT_TRUE(*--ch.end() == 999);
+}
+
+TEST_F(HiveTest, erase_skips) {
+  hive<int> h;
+  std::vector<int*> addr;
+  for (int i = 0; i < 100; ++i) addr.push_back(&*h.insert(i));
+
+  // 删除偶数：每个空段长度为 1
+  for (auto it = h.begin(); it != h.end();) {
+    if (*it % 2 == 0) it = h.erase(it);
+    else ++it;
+  }
+  ASSERT_TRUE(h.size() == 50);
+  for (int x : h) ASSERT_TRUE(x % 2 == 1);
+  // 再删除 3 的倍数，与已有空段合并
+  for (auto it = h.begin(); it != h.end();) {
+    if (*it % 3 == 0) it = h.erase(it);
+    else ++it;
+  }
+  std::vector<int> expect;
+  for (int i = 0; i < 100; ++i) {
+    if (i % 2 && i % 3) expect.push_back(i);
+  }
+  ASSERT_TRUE(sorted_contents(h) == expect);
+
+  // 反向遍历与正向一致
+  std::vector<int> forward, backward;
+  for (int x : h) forward.push_back(x);
+  for (auto it = h.end(); it != h.begin();) backward.push_back(*--it);
+  std::reverse(backward.begin(), backward.end());
+  ASSERT_TRUE(forward == backward);
+
+  // 剩余元素的地址不变
+  for (int i : expect) ASSERT_TRUE(*addr[i] == i);
+  ASSERT_TRUE(h.get_iterator(addr[5]) != h.end() && *h.get_iterator(addr[5]) == 5);
+
+  // 插入优先复用空槽，容量不增长
+  const size_t cap = h.capacity();
+  for (int i = 0; i < 30; ++i) h.insert(1000 + i);
+  ASSERT_TRUE(h.capacity() == cap && h.size() == expect.size() + 30);
+  for (int i : expect) ASSERT_TRUE(*addr[i] == i);
+}
+
+TEST_F(HiveTest, erase_range_and_blocks) {
+  hive<int> h;
+  for (int i = 0; i < 500; ++i) h.insert(i);
+  auto first = h.begin(), last = h.begin();
+  mystl::advance(first, 3);
+  mystl::advance(last, 400);
+  auto it = h.erase(first, last);
+  ASSERT_TRUE(*it == 400 && h.size() == 103);
+  // 空块被释放
+  ASSERT_TRUE(h.capacity() < 500);
+
+  h.erase(h.begin(), h.end());
+  ASSERT_TRUE(h.empty() && h.capacity() == 0 && h.begin() == h.end());
+  h.insert(1);
+  ASSERT_TRUE(h.size() == 1 && *h.begin() == 1);
+  h.clear();
+  ASSERT_TRUE(h.empty() && h.begin() == h.end());
+}
+
+TEST_F(HiveTest, random_ops) {
+  std::mt19937 gen(40);
+  hive<std::string> h;
+  std::vector<std::pair<const std::string*, std::string>> live;
+  for (int round = 0; round < 20000; ++round) {
+    if (live.empty() || gen() % 5 < 3) {
+      std::string s = std::to_string(gen() % 100000) + "-payload-string";
+      auto it = h.insert(s);
+      live.emplace_back(&*it, s);
+    } else {
+      size_t k = gen() % live.size();
+      auto it = h.get_iterator(live[k].first);
+      ASSERT_TRUE(it != h.end() && *it == live[k].second);
+      h.erase(it);
+      live[k] = live.back();
+      live.pop_back();
+    }
+    if (round % 1000 == 0) {
+      for (auto& p : live) ASSERT_TRUE(*p.first == p.second);
+      std::vector<std::string> a = sorted_contents(h), b;
+      for (auto& p : live) b.push_back(p.second);
+      std::sort(b.begin(), b.end());
+      ASSERT_TRUE(a == b);
+      size_t backward = 0;
+      for (auto it = h.end(); it != h.begin(); --it) ++backward;
+      ASSERT_TRUE(backward == live.size());
+    }
+  }
+  ASSERT_TRUE(h.size() == live.size());
+  ASSERT_TRUE(static_cast<size_t>(mystl::distance(h.begin(), h.end())) == live.size());
+}
+
+TEST_F(HiveTest, move_only) {
+  hive<std::unique_ptr<int>> h;
+  for (int i = 0; i < 50; ++i) h.emplace(new int(i));
+  for (auto it = h.begin(); it != h.end();) {
+    if (**it % 5) it = h.erase(it);
+    else ++it;
+  }
+  int sum = 0;
+  for (auto& p : h) sum += *p;
+  ASSERT_TRUE(h.size() == 10 && sum == 225);
+}
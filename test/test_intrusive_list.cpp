@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "../intrusive_list.h"
+
+#include <vector>
+
+using namespace ::mystl;
+
+namespace {
+struct timer {
+  int id;
+  list_hook by_deadline;
+  list_hook by_owner;
+  explicit timer(int i = 0) : id(i) {}
+};
+
+using deadline_list = intrusive_list<timer, &timer::by_deadline>;
+using owner_list = intrusive_list<timer, &timer::by_owner>;
+}  // namespace
+
+class IntrusiveListTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    for (int i = 0; i < 5; ++i) items.emplace_back(i);
+  }
+  std::vector<timer> items;
+};
+
+TEST_F(IntrusiveListTest, push_and_iterate) {
+  deadline_list l;
+  ASSERT_TRUE(l.empty());
+  for (auto& t : items) l.push_back(t);
+  ASSERT_TRUE(l.size() == 5);
+  int k = 0;
+  for (auto& t : l) ASSERT_TRUE(t.id == k++);
+  ASSERT_TRUE(l.front().id == 0);
+  ASSERT_TRUE(l.back().id == 4);
+  ASSERT_TRUE(&l.front() == &items[0]);
+  k = 4;
+  for (auto it = l.rbegin(); it != l.rend(); ++it) ASSERT_TRUE(it->id == k--);
+}
+
+TEST_F(IntrusiveListTest, multiple_lists) {
+  deadline_list d;
+  owner_list o;
+  for (auto& t : items) {
+    d.push_back(t);
+    o.push_front(t);
+  }
+  ASSERT_TRUE(d.front().id == 0);
+  ASSERT_TRUE(o.front().id == 4);
+  d.remove(items[2]);
+  ASSERT_TRUE(d.size() == 4);
+  ASSERT_TRUE(o.size() == 5);
+  ASSERT_FALSE(items[2].by_deadline.is_linked());
+  ASSERT_TRUE(items[2].by_owner.is_linked());
+}
+
+TEST_F(IntrusiveListTest, unlink_self) {
+  deadline_list l;
+  for (auto& t : items) l.push_back(t);
+  items[0].by_deadline.unlink();
+  items[4].by_deadline.unlink();
+  items[2].by_deadline.unlink();
+  ASSERT_TRUE(l.size() == 2);
+  ASSERT_TRUE(l.front().id == 1);
+  ASSERT_TRUE(l.back().id == 3);
+  items[1].by_deadline.unlink();
+  items[3].by_deadline.unlink();
+  ASSERT_TRUE(l.empty());
+}
+
+TEST_F(IntrusiveListTest, auto_unlink_on_destroy) {
+  deadline_list l;
+  l.push_back(items[0]);
+  {
+    timer tmp(42);
+    l.push_back(tmp);
+    ASSERT_TRUE(l.size() == 2);
+  }
+  ASSERT_TRUE(l.size() == 1);
+  ASSERT_TRUE(l.back().id == 0);
+}
+
+TEST_F(IntrusiveListTest, erase_insert) {
+  deadline_list l;
+  for (auto& t : items) l.push_back(t);
+  auto it = deadline_list::iterator_to(items[1]);
+  it = l.erase(it);
+  ASSERT_TRUE(it->id == 2);
+  l.insert(it, items[1]);
+  int k = 0;
+  for (auto& t : l) ASSERT_TRUE(t.id == k++);
+  l.erase(l.begin(), l.end());
+  ASSERT_TRUE(l.empty());
+  for (auto& t : items) ASSERT_FALSE(t.by_deadline.is_linked());
+}
+
+TEST_F(IntrusiveListTest, splice_and_swap) {
+  deadline_list l1, l2;
+  l1.push_back(items[0]);
+  l1.push_back(items[3]);
+  l2.push_back(items[1]);
+  l2.push_back(items[2]);
+  auto pos = l1.begin();
+  ++pos;
+  l1.splice(pos, l2);
+  ASSERT_TRUE(l2.empty());
+  int k = 0;
+  for (auto& t : l1) {
+    if (k == 3) break;
+    ASSERT_TRUE(t.id == k++);
+  }
+
+  l2.push_back(items[4]);
+  l1.splice(l1.begin(), l2, l2.begin());
+  ASSERT_TRUE(l1.front().id == 4);
+  ASSERT_TRUE(l2.empty());
+
+  l1.swap(l2);
+  ASSERT_TRUE(l1.empty());
+  ASSERT_TRUE(l2.size() == 5);
+
+  deadline_list l3(mystl::move(l2));
+  ASSERT_TRUE(l2.empty());
+  ASSERT_TRUE(l3.size() == 5);
+  l3.clear();
+  for (auto& t : items) ASSERT_FALSE(t.by_deadline.is_linked());
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "../list.h"
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
 
 using namespace ::mystl;
 
@@ -234,6 +238,68 @@ TEST_F(ListTest, push_back_perfermance) {
     ASSERT_TRUE(lst1.size() == 499999);
 }
 
+TEST_F(ListTest, sort_compare) {
+  int array[] = {5, 1, 4, 2, 3};
+  list<int> l(array, array + 5);
+  l.sort(mystl::greater<int>());
+  list<int>::iterator i = l.begin();
+  ASSERT_TRUE(*i++ == 5);
+  ASSERT_TRUE(*i++ == 4);
+  ASSERT_TRUE(*i++ == 3);
+  ASSERT_TRUE(*i++ == 2);
+  ASSERT_TRUE(*i++ == 1);
+  ASSERT_TRUE(i == l.end());
+  ASSERT_TRUE(l.size() == 5);
+  ASSERT_TRUE(*(--l.end()) == 1);
+}
+
+TEST_F(ListTest, sort_stable) {
+  // 只比较 first，检查相等元素保持原有顺序
+  std::vector<std::pair<int, int>> v;
+  for (int k = 0; k < 1000; ++k) v.push_back(std::make_pair(std::rand() % 10, k));
+  list<std::pair<int, int>> l(v.begin(), v.end());
+  auto by_first = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first < b.first;
+  };
+  l.sort(by_first);
+  std::stable_sort(v.begin(), v.end(), by_first);
+  ASSERT_TRUE(l.size() == v.size());
+  auto it = v.begin();
+  for (auto& p : l) ASSERT_TRUE(p == *it++);
+}
+
+TEST_F(ListTest, sort_random) {
+  std::vector<int> v;
+  for (int k = 0; k < 100000; ++k) v.push_back(std::rand());
+  list<int> l(v.begin(), v.end());
+  l.sort();
+  std::sort(v.begin(), v.end());
+  ASSERT_TRUE(l.size() == v.size());
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), l.begin()));
+  // 反向遍历检查 prev 指针
+  ASSERT_TRUE(std::equal(v.rbegin(), v.rend(), l.rbegin()));
+}
+
+TEST_F(ListTest, merge_size) {
+  int array1[] = {1, 3, 5};
+  int array2[] = {6, 4, 2};
+  list<int> l1(array1, array1 + 3);
+  list<int> l2(array2, array2 + 3);
+  l2.sort();
+  l1.merge(l2);
+  ASSERT_TRUE(l1.size() == 6);
+  ASSERT_TRUE(l2.size() == 0);
+  ASSERT_TRUE(l2.empty());
+  int k = 1;
+  for (auto x : l1) ASSERT_TRUE(x == k++);
+
+  list<int> l3(array2, array2 + 3);
+  l1.sort(mystl::greater<int>());
+  l1.merge(l3, mystl::greater<int>());
+  ASSERT_TRUE(l1.size() == 9);
+  ASSERT_TRUE(l1.front() == 6 && l1.back() == 1);
+}
+
 namespace foo {
 class bar {};
 
@@ -244,4 +310,158 @@ size_t distance(It, It);
 TEST_F(ListTest, adl) {
   list<foo::bar> lbar;
   ASSERT_TRUE(lbar.empty());
-}
\ No newline at end of file
+}
+namespace {
+    // 统计复制次数
+    struct copy_counter {
+        static int copies;
+        int v;
+
+        explicit copy_counter(int x = 0) : v(x) {}
+        copy_counter(const copy_counter& rhs) : v(rhs.v) { ++copies; }
+        copy_counter(copy_counter&& rhs) noexcept : v(rhs.v) {}
+        copy_counter& operator=(const copy_counter& rhs) { v = rhs.v; ++copies; return *this; }
+        copy_counter& operator=(copy_counter&& rhs) noexcept { v = rhs.v; return *this; }
+    };
+    int copy_counter::copies = 0;
+}
+
+TEST_F(ListTest, move_only) {
+    list<std::unique_ptr<int>> l;
+    for (int i = 0; i < 10; ++i) l.push_back(std::unique_ptr<int>(new int(i)));
+    l.push_front(std::unique_ptr<int>(new int(-1)));
+    l.insert(l.end(), std::unique_ptr<int>(new int(10)));
+    l.emplace_back(new int(11));
+    ASSERT_TRUE(l.size() == 13 && *l.front() == -1 && *l.back() == 11);
+    l.sort([](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a > *b; });
+    ASSERT_TRUE(*l.front() == 11 && *l.back() == -1);
+
+    list<std::unique_ptr<int>> m(mystl::move(l));
+    ASSERT_TRUE(m.size() == 13 && l.size() == 0 && l.begin() == l.end());
+    l = mystl::move(m);
+    ASSERT_TRUE(l.size() == 13 && m.size() == 0);
+
+    copy_counter::copies = 0;
+    list<copy_counter> c;
+    copy_counter x(1);
+    c.push_back(copy_counter(0));
+    c.push_back(mystl::move(x));
+    c.push_front(copy_counter(2));
+    c.insert(c.begin(), copy_counter(3));
+    list<copy_counter> d(mystl::move(c));
+    c = mystl::move(d);
+    ASSERT_TRUE(copy_counter::copies == 0 && c.size() == 4 && c.front().v == 3);
+}
+
+TEST_F(ListTest, node_handle) {
+    list<int> a{1, 2, 3, 4};
+    list<int> b{10, 20};
+    auto it = a.begin();
+    ++it;
+    int* addr = &*it;
+    list<int>::node_type nh = a.extract(it);
+    ASSERT_TRUE(!nh.empty() && nh.value() == 2 && a.size() == 3);
+    ASSERT_TRUE(a.front() == 1 && *(++a.begin()) == 3);
+
+    // 插入另一个 list，节点原样复用
+    nh.value() = 15;
+    auto pos = b.insert(++b.begin(), mystl::move(nh));
+    ASSERT_TRUE(nh.empty() && !nh && &*pos == addr && *pos == 15);
+    ASSERT_TRUE(b.size() == 3 && b.front() == 10 && b.back() == 20);
+
+    // 空句柄插入什么也不做
+    pos = b.insert(b.end(), list<int>::node_type());
+    ASSERT_TRUE(pos == b.end() && b.size() == 3);
+
+    // 未插回的句柄自行释放
+    list<std::unique_ptr<int>> u;
+    u.push_back(std::unique_ptr<int>(new int(7)));
+    u.push_back(std::unique_ptr<int>(new int(8)));
+    {
+        auto h = u.extract(u.begin());
+        ASSERT_TRUE(*h.value() == 7 && u.size() == 1);
+        list<std::unique_ptr<int>>::node_type h2;
+        h2 = mystl::move(h);
+        ASSERT_TRUE(h.empty() && *h2.value() == 7);
+    }
+    ASSERT_TRUE(u.size() == 1 && *u.front() == 8);
+}
+
+TEST_F(ListTest, node_cache) {
+    list<int> l;
+    ASSERT_TRUE(l.node_cache_limit() == 0 && l.cached_nodes() == 0);
+    l.reserve_nodes(8);
+    ASSERT_TRUE(l.node_cache_limit() == 8 && l.cached_nodes() == 8);
+    for (int i = 0; i < 5; ++i) l.push_back(i);
+    ASSERT_TRUE(l.cached_nodes() == 3 && l.size() == 5);
+
+    // 删除的节点回到缓存，超出上限的直接释放
+    for (int i = 0; i < 10; ++i) l.push_back(i);
+    l.clear();
+    ASSERT_TRUE(l.cached_nodes() == 8 && l.empty());
+
+    l.set_node_cache_limit(2);
+    ASSERT_TRUE(l.cached_nodes() == 2);
+    l.release_node_cache();
+    ASSERT_TRUE(l.cached_nodes() == 0 && l.node_cache_limit() == 2);
+
+    // swap、移动赋值不交换缓存
+    list<int> m{1, 2, 3};
+    l.reserve_nodes(4);
+    l.swap(m);
+    ASSERT_TRUE(l.size() == 3 && l.cached_nodes() == 4 && m.cached_nodes() == 0);
+    l = list<int>{5};
+    ASSERT_TRUE(l.size() == 1 && l.front() == 5 && l.node_cache_limit() == 4);
+}
+
+TEST_F(ListTest, splice_size) {
+    list<int> a{1, 2, 3, 4};
+    list<int> b{5};
+    a.reverse();
+    ASSERT_TRUE(a.size() == 4);
+    b.splice(b.begin(), a);
+    ASSERT_TRUE(a.size() == 0 && b.size() == 5);
+    b.splice(b.begin(), b, --b.end());
+    ASSERT_TRUE(b.size() == 5 && b.front() == 5);
+    a.splice(a.end(), b, b.begin());
+    ASSERT_TRUE(a.size() == 1 && b.size() == 4);
+    auto last = b.begin();
+    mystl::advance(last, 3);
+    a.splice(a.end(), b, b.begin(), last);
+    ASSERT_TRUE(a.size() == 4 && b.size() == 1 && b.front() == 1);
+    // 同一 list 内的区间 splice 与自身 splice 不改变个数
+    auto mid = a.begin();
+    ++mid;
+    a.splice(a.begin(), a, mid, a.end());
+    a.splice(a.end(), a);
+    ASSERT_TRUE(a.size() == 4);
+    a.sort();
+    ASSERT_TRUE(a.size() == 4 && a.front() == 2 && a.back() == 5);
+}
+
+TEST_F(ListTest, splice_batch) {
+    list<int> a{1, 2, 3, 4, 5, 6};
+    list<int> b{10};
+    // 按给定顺序挂到 pos 之前，节点原样复用
+    std::vector<list<int>::iterator> picks;
+    for (auto it = a.begin(); it != a.end(); ++it) {
+        if (*it % 2 == 0) picks.push_back(it);
+    }
+    int* addr = &*picks[0];
+    std::swap(picks[0], picks[2]);
+    b.splice_batch(b.begin(), a, picks.begin(), picks.end());
+    ASSERT_TRUE(a.size() == 3 && b.size() == 4);
+    const int expect_a[] = {1, 3, 5};
+    const int expect_b[] = {6, 4, 2, 10};
+    ASSERT_TRUE(std::equal(a.begin(), a.end(), expect_a));
+    ASSERT_TRUE(std::equal(b.begin(), b.end(), expect_b));
+    ASSERT_TRUE(&*(--(--b.end())) == addr);
+
+    // 同一 list 内批量前移，个数不变；与 pos 相同的元素原地不动
+    auto last = --b.end();
+    auto first = b.begin();
+    list<int>::iterator moves[] = {last, first};
+    b.splice_batch(b.begin(), b, moves, moves + 2);
+    const int expect_self[] = {10, 6, 4, 2};
+    ASSERT_TRUE(b.size() == 4 && std::equal(b.begin(), b.end(), expect_self));
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "../lru_cache.h"
+#include "../alloc_trace.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::mystl;
+
+class LruCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+namespace {
+  // 按字符串长度计权，即按字节限制容量
+  struct string_bytes {
+    size_t operator()(int, const std::string& s) const noexcept { return s.size(); }
+  };
+}
+
+TEST_F(LruCacheTest, get_put) {
+  lru_cache<int, int> c(3);
+  ASSERT_TRUE(c.empty() && c.capacity() == 3 && c.get(1) == nullptr);
+  ASSERT_TRUE(c.put(1, 10) && c.put(2, 20) && c.put(3, 30));
+  ASSERT_TRUE(c.size() == 3 && c.weight() == 3);
+
+  // 访问 1 后，最旧的是 2
+  ASSERT_TRUE(*c.get(1) == 10);
+  c.put(4, 40);
+  ASSERT_TRUE(c.size() == 3 && !c.contains(2));
+  ASSERT_TRUE(c.contains(1) && c.contains(3) && c.contains(4));
+
+  // 覆盖也算一次使用
+  c.put(3, 33);
+  c.put(5, 50);
+  ASSERT_TRUE(!c.contains(1) && *c.peek(3) == 33);
+
+  // peek 不改变顺序：4 仍是最旧的
+  ASSERT_TRUE(*c.peek(4) == 40);
+  c.put(6, 60);
+  ASSERT_TRUE(!c.contains(4) && c.size() == 3);
+
+  *c.get(5) = 55;
+  ASSERT_TRUE(*c.peek(5) == 55);
+  ASSERT_TRUE(c.erase(5) && !c.erase(5) && c.size() == 2);
+  c.clear();
+  ASSERT_TRUE(c.empty() && c.weight() == 0 && c.get(3) == nullptr);
+}
+
+TEST_F(LruCacheTest, capacity_by_bytes) {
+  lru_cache<int, std::string, mystl::hash<int>, mystl::equal_to<int>, string_bytes> c(10);
+  ASSERT_TRUE(c.put(1, std::string(4, 'a')) && c.put(2, std::string(4, 'b')));
+  ASSERT_TRUE(c.weight() == 8);
+  // 需要淘汰两条才放得下
+  c.get(1);
+  ASSERT_TRUE(c.put(3, std::string(7, 'c')));
+  ASSERT_TRUE(c.size() == 1 && c.weight() == 7 && !c.contains(1) && !c.contains(2));
+
+  // 单条超过容量：不放入，同键的旧条目删除
+  ASSERT_TRUE(!c.put(4, std::string(11, 'd')) && !c.contains(4));
+  ASSERT_TRUE(!c.put(3, std::string(11, 'e')) && c.empty() && c.weight() == 0);
+  ASSERT_TRUE(c.stats().rejections == 2);
+
+  // 覆盖后变重，从表尾淘汰其他条目
+  c.put(1, "aa");
+  c.put(2, "bb");
+  c.put(1, std::string(9, 'a'));
+  ASSERT_TRUE(c.size() == 1 && c.weight() == 9 && c.peek(1)->size() == 9);
+
+  // 调小容量立即淘汰
+  c.put(2, "b");
+  c.set_capacity(5);
+  ASSERT_TRUE(c.size() == 1 && c.contains(2) && c.weight() == 1);
+}
+
+TEST_F(LruCacheTest, stats) {
+  lru_cache<int, int> c(2);
+  c.put(1, 1);
+  c.put(2, 2);
+  c.put(1, 11);
+  c.get(1);
+  c.get(3);
+  c.put(3, 3);
+  const lru_stats& s = c.stats();
+  ASSERT_TRUE(s.hits == 1 && s.misses == 1 && s.hit_rate() == 0.5);
+  ASSERT_TRUE(s.insertions == 3 && s.updates == 1 && s.evictions == 1);
+  ASSERT_TRUE(s.timed_lookups == 0 && s.mean_lookup_ns() == 0.0);
+
+  c.record_latency(true);
+  for (int i = 0; i < 10; ++i) c.get(i % 4);
+  ASSERT_TRUE(c.stats().timed_lookups == 10 && c.stats().max_lookup_ns * 10 >= c.stats().lookup_ns);
+  c.reset_stats();
+  ASSERT_TRUE(c.stats().hits == 0 && c.stats().hit_rate() == 0.0);
+}
+
+TEST_F(LruCacheTest, move_only) {
+  lru_cache<int, std::unique_ptr<int>> c(2);
+  c.put(1, std::unique_ptr<int>(new int(1)));
+  c.put(2, std::unique_ptr<int>(new int(2)));
+  c.put(3, std::unique_ptr<int>(new int(3)));
+  ASSERT_TRUE(c.size() == 2 && !c.contains(1) && **c.get(3) == 3);
+  c.put(3, std::unique_ptr<int>(new int(33)));
+  ASSERT_TRUE(**c.get(3) == 33);
+}
+
+TEST_F(LruCacheTest, string_keys) {
+  lru_cache<std::string, int> c(100);
+  for (int i = 0; i < 1000; ++i) c.put(std::to_string(i), i);
+  ASSERT_TRUE(c.size() == 100);
+  for (int i = 900; i < 1000; ++i) ASSERT_TRUE(*c.get(std::to_string(i)) == i);
+  ASSERT_TRUE(c.get("899") == nullptr);
+}
+
+TEST_F(LruCacheTest, recycle_without_alloc) {
+  alloc_trace::instance().reset();
+  alloc_trace::instance().record_events(false);
+  {
+    lru_cache<int, int, mystl::hash<int>, mystl::equal_to<int>, lru_unit_weight, traced_alloc<int>> c(64);
+    c.reserve(64);
+    for (int i = 0; i < 64; ++i) c.put(i, i);
+    // 满载后的插入淘汰表尾并复用其节点，命中只 splice；
+    // 索引的已删除标记在原数组上清除，同样不分配
+    alloc_budget budget;
+    for (int i = 64; i < 10000; ++i) {
+      c.put(i, i);
+      c.get(i - 10);
+      c.get(i - 100);
+    }
+    c.erase(9999);
+    c.put(9999, 1);
+    ASSERT_TRUE(budget.allocations() == 0 && budget.deallocations() == 0);
+    ASSERT_TRUE(c.size() == 64 && *c.peek(9999) == 1);
+  }
+  ASSERT_TRUE(alloc_trace::instance().live_bytes() == 0);
+  alloc_trace::instance().record_events(true);
+}
+
+TEST_F(LruCacheTest, sharded) {
+  sharded_lru_cache<int, int> c(1000, 6);
+  ASSERT_TRUE(c.shard_count() == 8);
+  for (int i = 0; i < 100; ++i) c.put(i, i * 2);
+  int v = 0;
+  ASSERT_TRUE(c.size() == 100 && c.get(42, v) && v == 84);
+  ASSERT_TRUE(!c.get(1000, v) && c.contains(7) && c.erase(7) && !c.contains(7));
+
+  // 每个线程写、读自己的键段，容量充足时读到的都是自己写的值
+  c.clear();
+  c.reset_stats();
+  c.reserve(1000);
+  c.record_latency(true);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&c, t] {
+      for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 100; ++i) c.put(t * 1000 + i, t * 1000 + i + round);
+        for (int i = 0; i < 100; ++i) {
+          int x = -1;
+          if (!c.get(t * 1000 + i, x) || x != t * 1000 + i + round) std::abort();
+        }
+      }
+    });
+  }
+  for (auto& th : threads) th.join();
+  const lru_stats s = c.stats();
+  ASSERT_TRUE(c.size() == 400 && s.hits == 8000 && s.misses == 0);
+  ASSERT_TRUE(s.timed_lookups == 8000 && s.insertions == 400 && s.updates == 7600);
+
+  // 容量不足时总量不超过各分片容量之和
+  sharded_lru_cache<int, int> small(64, 4);
+  for (int i = 0; i < 1000; ++i) small.put(i, i);
+  ASSERT_TRUE(small.size() <= 64 && small.stats().evictions == 1000 - small.size());
+}
+
+// 总容量精确分给各分片，分片数不超过容量
+TEST_F(LruCacheTest, sharded_capacity_split) {
+  sharded_lru_cache<int, int> c(10, 16);
+  ASSERT_TRUE(c.shard_count() == 8 && c.capacity() == 10);
+  for (int i = 0; i < 1000; ++i) c.put(i, i);
+  ASSERT_TRUE(c.size() <= 10);
+
+  sharded_lru_cache<int, int> one(1, 16);
+  ASSERT_TRUE(one.shard_count() == 1 && one.capacity() == 1);
+  for (int i = 0; i < 100; ++i) one.put(i, i);
+  ASSERT_TRUE(one.size() == 1 && one.contains(99));
+
+  sharded_lru_cache<int, int> odd(1003, 8);
+  ASSERT_TRUE(odd.shard_count() == 8 && odd.capacity() == 1003);
+  for (int i = 0; i < 100000; ++i) odd.put(i, i);
+  ASSERT_TRUE(odd.size() <= 1003);
+}
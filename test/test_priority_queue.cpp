@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "../queue.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace ::mystl;
+
+class PriorityQueueTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+};
+
+TEST_F(PriorityQueueTest, basic) {
+  priority_queue<int> pq;
+  ASSERT_TRUE(pq.empty());
+  pq.push(3);
+  pq.push(5);
+  pq.push(1);
+  pq.emplace(4);
+  ASSERT_TRUE(pq.size() == 4);
+  ASSERT_TRUE(pq.top() == 5);
+  pq.pop();
+  ASSERT_TRUE(pq.top() == 4);
+  pq.pop();
+  ASSERT_TRUE(pq.top() == 3);
+  pq.clear();
+  ASSERT_TRUE(pq.empty());
+}
+
+TEST_F(PriorityQueueTest, range_and_compare) {
+  int array[] = {5, 2, 8, 1, 9};
+  priority_queue<int, vector<int>, greater<int>> pq(array, array + 5);
+  int expect[] = {1, 2, 5, 8, 9};
+  for (int x : expect) {
+    ASSERT_TRUE(pq.top() == x);
+    pq.pop();
+  }
+
+  priority_queue<int> pq2 = {3, 1, 2};
+  ASSERT_TRUE(pq2.top() == 3);
+  priority_queue<int> pq3;
+  pq3.swap(pq2);
+  ASSERT_TRUE(pq2.empty());
+  ASSERT_TRUE(pq3.size() == 3);
+}
+
+TEST_F(PriorityQueueTest, dary) {
+  dary_priority_queue<int, 4> pq;
+  std::vector<int> ref;
+  std::srand(3);
+  for (int i = 0; i < 2000; ++i) {
+    int x = std::rand();
+    pq.push(x);
+    ref.push_back(x);
+  }
+  std::sort(ref.rbegin(), ref.rend());
+  for (int x : ref) {
+    ASSERT_TRUE(pq.top() == x);
+    pq.pop();
+  }
+  ASSERT_TRUE(pq.empty());
+}
+
+TEST_F(PriorityQueueTest, indexed_decrease_key) {
+  indexed_priority_queue<int> pq(5);
+  pq.push(0, 50);
+  pq.push(1, 40);
+  pq.push(2, 30);
+  pq.push(3, 20);
+  pq.push(4, 10);
+  ASSERT_TRUE(pq.top_id() == 4);
+  pq.decrease_key(0, 5);
+  ASSERT_TRUE(pq.top_id() == 0);
+  ASSERT_TRUE(pq.top() == 5);
+  pq.increase_key(0, 45);
+  ASSERT_TRUE(pq.top_id() == 4);
+  pq.update(2, 1);
+  ASSERT_TRUE(pq.top_id() == 2);
+  pq.erase(2);
+  ASSERT_FALSE(pq.contains(2));
+  ASSERT_TRUE(pq.size() == 4);
+
+  int expect_ids[] = {4, 3, 1, 0};
+  for (int id : expect_ids) {
+    ASSERT_TRUE(pq.top_id() == static_cast<size_t>(id));
+    pq.pop();
+  }
+  ASSERT_TRUE(pq.empty());
+  // 超出预留范围的 id 自动扩展
+  pq.push(100, 7);
+  ASSERT_TRUE(pq.contains(100));
+  ASSERT_TRUE(pq.key(100) == 7);
+}
+
+TEST_F(PriorityQueueTest, indexed_dijkstra) {
+  // 5 个点的小图，与手算结果对比
+  const int INF = 1 << 30;
+  int w[5][5] = {
+      {0, 4, 1, INF, INF},
+      {4, 0, 2, 5, INF},
+      {1, 2, 0, 8, 10},
+      {INF, 5, 8, 0, 2},
+      {INF, INF, 10, 2, 0}};
+  std::vector<int> dist(5, INF);
+  std::vector<bool> done(5, false);
+  indexed_priority_queue<int> pq(5);
+  dist[0] = 0;
+  pq.push(0, 0);
+  while (!pq.empty()) {
+    size_t u = pq.top_id();
+    pq.pop();
+    done[u] = true;
+    for (size_t v = 0; v < 5; ++v) {
+      if (w[u][v] == INF || done[v]) continue;
+      int nd = dist[u] + w[u][v];
+      if (nd < dist[v]) {
+        dist[v] = nd;
+        if (pq.contains(v)) pq.decrease_key(v, nd);
+        else pq.push(v, nd);
+      }
+    }
+  }
+  int expect[] = {0, 3, 1, 8, 10};
+  for (int i = 0; i < 5; ++i) ASSERT_TRUE(dist[i] == expect[i]);
+}
@@ -240,4 +240,48 @@ TEST_F(QueueTest, SWAP) {
   swap(qqi, temp_qqi);
   EXPECT_EQ(qqi.front().front(), 1);
   EXPECT_EQ(temp_qqi.front(), queue<int>());
-}
\ No newline at end of file
+}
+TEST_F(QueueTest, PUSH_RANGE) {
+  int arr[1000];
+  for (int i = 0; i < 1000; ++i) arr[i] = i + 2;
+  qi.push_range(arr, arr + 1000);
+  EXPECT_EQ(qi.size(), 1001);
+  EXPECT_EQ(qi.front(), 1);
+  EXPECT_EQ(qi.back(), 1001);
+  for (int i = 1; i <= 1001; ++i) {
+    EXPECT_EQ(qi.front(), i);
+    qi.pop();
+  }
+  EXPECT_TRUE(qi.empty());
+
+  string words[] = {"a", "b", "c"};
+  qs.push_range(words, words + 3);
+  EXPECT_EQ(qs.size(), 5);
+  EXPECT_EQ(qs.back(), "c");
+  qs.push_range(words, words);
+  EXPECT_EQ(qs.size(), 5);
+}
+
+TEST_F(QueueTest, POP_N_AND_DRAIN) {
+  for (int i = 2; i <= 1000; ++i) qi.push(i);
+  int out[300];
+  EXPECT_EQ(qi.pop_n(300, out), out + 300);
+  for (int i = 0; i < 300; ++i) EXPECT_EQ(out[i], i + 1);
+  EXPECT_EQ(qi.size(), 700);
+  EXPECT_EQ(qi.front(), 301);
+
+  vector<int> v;
+  qi.drain_into(v);
+  EXPECT_TRUE(qi.empty());
+  EXPECT_EQ(v.size(), 700);
+  for (int i = 0; i < 700; ++i) EXPECT_EQ(v[i], 301 + i);
+  qi.push(5);
+  EXPECT_EQ(qi.front(), 5);
+
+  vector<string> words;
+  qs.drain_into(words);
+  EXPECT_TRUE(qs.empty());
+  EXPECT_EQ(words.size(), 2);
+  EXPECT_EQ(words[0], "hello");
+  EXPECT_EQ(words[1], "world");
+}
@@ -0,0 +1,70 @@
+#include "../shared_ptr.h"
+#include "../vector.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace ::mystl;
+
+class SharedPtrTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+namespace {
+    struct tracked {
+        static int alive;
+        tracked() { ++alive; }
+        ~tracked() { --alive; }
+    };
+    int tracked::alive = 0;
+}
+
+TEST_F(SharedPtrTest, copy_and_move) {
+    {
+        shared_ptr<tracked> a(new tracked);
+        ASSERT_TRUE(a.use_count() == 1 && a.unique());
+        shared_ptr<tracked> b(a);
+        ASSERT_TRUE(a.use_count() == 2 && b.get() == a.get());
+
+        // 移动不改变计数，源变为空
+        shared_ptr<tracked> c(mystl::move(b));
+        ASSERT_TRUE(!b && b.use_count() == 0 && c.use_count() == 2);
+        b = mystl::move(c);
+        ASSERT_TRUE(!c && b.use_count() == 2);
+        b = mystl::move(b);
+        ASSERT_TRUE(b.use_count() == 2);
+
+        c = a;
+        ASSERT_TRUE(a.use_count() == 3);
+        a.reset();
+        ASSERT_TRUE(!a && c.use_count() == 2 && tracked::alive == 1);
+    }
+    ASSERT_TRUE(tracked::alive == 0);
+
+    // 空指针的复制与销毁
+    {
+        shared_ptr<tracked> e;
+        shared_ptr<tracked> f(e);
+        f = e;
+        ASSERT_TRUE(!e && e.use_count() == 0);
+        f.reset(new tracked);
+        ASSERT_TRUE(f.use_count() == 1 && tracked::alive == 1);
+    }
+    ASSERT_TRUE(tracked::alive == 0);
+}
+
+TEST_F(SharedPtrTest, in_container) {
+    {
+        vector<shared_ptr<tracked>> v;
+        shared_ptr<tracked> p(new tracked);
+        for (int i = 0; i < 100; ++i) v.push_back(p);
+        ASSERT_TRUE(p.use_count() == 101);
+        // 扩容、删除时移动，计数不变
+        v.reserve(1000);
+        v.erase(v.begin(), v.begin() + 50);
+        ASSERT_TRUE(p.use_count() == 51 && v.size() == 50);
+        v.push_back(shared_ptr<tracked>(new tracked));
+        ASSERT_TRUE(tracked::alive == 2);
+    }
+    ASSERT_TRUE(tracked::alive == 0);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "../soa_vector.h"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace ::mystl;
+
+class SoaVectorTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(SoaVectorTest, ctor) {
+  soa_vector<int, double> v0;
+  ASSERT_TRUE(v0.empty() && v0.capacity() == 0);
+  ASSERT_TRUE(v0.begin() == v0.end());
+
+  soa_vector<int, double> v1(3);
+  ASSERT_TRUE(v1.size() == 3);
+  ASSERT_TRUE(std::get<0>(v1[2]) == 0 && std::get<1>(v1[2]) == 0.0);
+
+  v1.emplace_back(7, 1.5);
+  soa_vector<int, double> v2(v1);
+  ASSERT_TRUE(v2 == v1);
+  soa_vector<int, double> v3(mystl::move(v2));
+  ASSERT_TRUE(v3 == v1 && v2.empty());
+  v2 = v3;
+  ASSERT_TRUE(v2 == v1);
+  std::get<0>(v2[0]) = 1;
+  ASSERT_TRUE(v2 != v1);
+}
+
+TEST_F(SoaVectorTest, push_back) {
+  soa_vector<int, std::string, char> v;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 2) v.push_back(std::make_tuple(i, std::to_string(i), static_cast<char>('a' + i % 26)));
+    else v.emplace_back(i, std::to_string(i), static_cast<char>('a' + i % 26));
+  }
+  ASSERT_TRUE(v.size() == 1000);
+  ASSERT_TRUE(v.capacity() == 1024);
+  for (int i = 0; i < 1000; ++i) {
+    auto [id, name, tag] = v[i];
+    ASSERT_TRUE(id == i && name == std::to_string(i) && tag == 'a' + i % 26);
+  }
+  ASSERT_TRUE(std::get<1>(v.back()) == "999");
+
+  // 参数引用自身元素时扩容也不能失效
+  v.shrink_to_fit();
+  ASSERT_TRUE(v.capacity() == 1000);
+  v.emplace_back(std::get<0>(v[0]), std::get<1>(v[0]), std::get<2>(v[0]));
+  ASSERT_TRUE(std::get<1>(v.back()) == "0");
+
+  v.pop_back();
+  v.resize(10);
+  ASSERT_TRUE(v.size() == 10 && std::get<1>(v.back()) == "9");
+  v.clear();
+  ASSERT_TRUE(v.empty());
+}
+
+TEST_F(SoaVectorTest, iterator_column) {
+  soa_vector<int, float> v;
+  for (int i = 0; i < 100; ++i) v.emplace_back(i, i * 0.5f);
+
+  int n = 0;
+  for (auto [id, x] : v) {
+    ASSERT_TRUE(id == n && x == n * 0.5f);
+    x = 0;// 代理引用写回列
+    ++n;
+  }
+  ASSERT_TRUE(n == 100);
+  ASSERT_TRUE(v.end() - v.begin() == 100);
+  ASSERT_TRUE(std::get<0>(v.begin()[42]) == 42);
+
+  auto xs = v.column<1>();
+  ASSERT_TRUE(xs.size() == 100);
+  for (float x : xs) ASSERT_TRUE(x == 0);
+  auto ids = v.column<0>();
+  ASSERT_TRUE(ids.data() == v.data<0>());
+  long sum = 0;
+  for (size_t i = 0; i < ids.size(); ++i) sum += ids[i];
+  ASSERT_TRUE(sum == 4950);
+
+  const auto& cv = v;
+  ASSERT_TRUE(cv.column<0>()[99] == 99);
+  ASSERT_TRUE(std::get<0>(*(cv.end() - 1)) == 99);
+}
+
+TEST_F(SoaVectorTest, move_only) {
+  soa_vector<std::unique_ptr<int>, int> v;
+  for (int i = 0; i < 100; ++i) v.emplace_back(std::unique_ptr<int>(new int(i)), i);
+  for (int i = 0; i < 100; ++i) ASSERT_TRUE(*std::get<0>(v[i]) == i);
+  soa_vector<std::unique_ptr<int>, int> w(mystl::move(v));
+  ASSERT_TRUE(w.size() == 100 && v.empty());
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "../sorted_index.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ::mystl;
+
+class SortedIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(SortedIndexTest, ctor) {
+  sorted_index<int> s0;
+  ASSERT_TRUE(s0.empty());
+  ASSERT_TRUE(s0.lower_bound(1) == nullptr);
+  ASSERT_TRUE(!s0.contains(1));
+
+  vector<int> keys = {5, 1, 3, 3, 9};
+  sorted_index<int> s1(keys);
+  ASSERT_TRUE(s1.size() == 5);
+  ASSERT_TRUE(*s1.lower_bound(0) == 1);
+  ASSERT_TRUE(*s1.lower_bound(4) == 5);
+  ASSERT_TRUE(s1.lower_bound(10) == nullptr);
+  ASSERT_TRUE(s1.contains(3) && !s1.contains(4));
+
+  sorted_index<int, mystl::greater<int>> s2(keys);
+  ASSERT_TRUE(*s2.lower_bound(4) == 3);
+  ASSERT_TRUE(*s2.find(9) == 9);
+}
+
+TEST_F(SortedIndexTest, random_against_std) {
+  std::mt19937 gen(11);
+  for (size_t n : {1, 2, 3, 7, 8, 15, 16, 17, 1000, 65537}) {
+    vector<int> keys;
+    std::vector<int> ref;
+    for (size_t i = 0; i < n; ++i) {
+      int k = static_cast<int>(gen() % (n * 2));
+      keys.push_back(k);
+      ref.push_back(k);
+    }
+    std::sort(ref.begin(), ref.end());
+    sorted_index<int> s(keys);
+    for (int q = -1; q <= static_cast<int>(n * 2); ++q) {
+      auto it = std::lower_bound(ref.begin(), ref.end(), q);
+      const int* p = s.lower_bound(q);
+      if (it == ref.end()) {
+        ASSERT_TRUE(p == nullptr);
+      } else {
+        ASSERT_TRUE(p != nullptr && *p == *it);
+      }
+      ASSERT_TRUE(s.contains(q) == std::binary_search(ref.begin(), ref.end(), q));
+    }
+  }
+}
+
+TEST_F(SortedIndexTest, string) {
+  std::vector<std::string> words = {"pear", "apple", "fig", "kiwi", "banana"};
+  sorted_index<std::string> s(words.data(), words.data() + words.size());
+  ASSERT_TRUE(*s.lower_bound("b") == "banana");
+  ASSERT_TRUE(*s.lower_bound("g") == "kiwi");
+  ASSERT_TRUE(s.lower_bound("q") == nullptr);
+  ASSERT_TRUE(s.contains("fig"));
+}
@@ -238,4 +238,29 @@ TEST_F(StackTest, SWAP) {
   swap(ssi, temp_ssi);
   EXPECT_EQ(ssi.top().top(), 1);
   EXPECT_EQ(temp_ssi.top(), stack<int>());
-}
\ No newline at end of file
+}
+TEST_F(StackTest, POP_N_AND_DRAIN) {
+  for (int i = 2; i <= 1000; ++i) si.push(i);
+  int out[300];
+  EXPECT_EQ(si.pop_n(300, out), out + 300);
+  for (int i = 0; i < 300; ++i) EXPECT_EQ(out[i], 1000 - i);
+  EXPECT_EQ(si.size(), 700);
+  EXPECT_EQ(si.top(), 700);
+
+  vector<int> v;
+  v.push_back(-1);
+  si.drain_into(v);
+  EXPECT_EQ(si.size(), 0);
+  EXPECT_EQ(v.size(), 701);
+  EXPECT_EQ(v[0], -1);
+  for (int i = 1; i <= 700; ++i) EXPECT_EQ(v[i], 701 - i);
+
+  // n 超过元素个数时全部弹出
+  string words[3];
+  EXPECT_EQ(ss.pop_n(3, words), words + 2);
+  EXPECT_EQ(words[0], "world");
+  EXPECT_EQ(words[1], "hello");
+  EXPECT_EQ(ss.size(), 0);
+  ss.push("again");
+  EXPECT_EQ(ss.top(), "again");
+}
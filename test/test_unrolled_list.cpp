@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include "../unrolled_list.h"
+#include "../list.h"
+
+#include <list>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace ::mystl;
+
+class UnrolledListTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(UnrolledListTest, ctor) {
+  unrolled_list<int> l0;
+  ASSERT_TRUE(l0.empty());
+  ASSERT_TRUE(l0.begin() == l0.end());
+
+  unrolled_list<int> l1(5, 3);
+  ASSERT_TRUE(l1.size() == 5);
+  for (auto x : l1) ASSERT_TRUE(x == 3);
+
+  int array[] = {1, 2, 3, 4};
+  unrolled_list<int> l2(array, array + 4);
+  unrolled_list<int> l3 = {1, 2, 3, 4};
+  ASSERT_TRUE(l2 == l3);
+
+  unrolled_list<int> l4(l3);
+  ASSERT_TRUE(l4 == l3);
+  unrolled_list<int> l5(mystl::move(l4));
+  ASSERT_TRUE(l5 == l3);
+  ASSERT_TRUE(l4.empty());
+}
+
+TEST_F(UnrolledListTest, push_pop) {
+  unrolled_list<int> l;
+  for (int i = 0; i < 1000; ++i) l.push_back(i);
+  for (int i = -1; i >= -1000; --i) l.push_front(i);
+  ASSERT_TRUE(l.size() == 2000);
+  ASSERT_TRUE(l.front() == -1000);
+  ASSERT_TRUE(l.back() == 999);
+
+  int expect = -1000;
+  for (auto x : l) ASSERT_TRUE(x == expect++);
+
+  l.pop_front();
+  l.pop_back();
+  ASSERT_TRUE(l.front() == -999);
+  ASSERT_TRUE(l.back() == 998);
+  ASSERT_TRUE(l.size() == 1998);
+}
+
+TEST_F(UnrolledListTest, reverse_iterate) {
+  unrolled_list<int> l;
+  for (int i = 0; i < 500; ++i) l.push_back(i);
+  int expect = 499;
+  for (auto it = l.rbegin(); it != l.rend(); ++it) ASSERT_TRUE(*it == expect--);
+  ASSERT_TRUE(expect == -1);
+}
+
+TEST_F(UnrolledListTest, insert_erase_random) {
+  // 与 std::list 对拍
+  unrolled_list<int> l;
+  std::list<int> ref;
+  std::srand(7);
+  for (int round = 0; round < 5000; ++round) {
+    size_t pos = ref.empty() ? 0 : std::rand() % (ref.size() + 1);
+    auto it = l.begin();
+    auto rit = ref.begin();
+    for (size_t k = 0; k < pos; ++k, ++it, ++rit);
+    if (std::rand() % 3 != 0 || ref.empty() || rit == ref.end()) {
+      int v = std::rand();
+      auto res = l.insert(it, v);
+      ref.insert(rit, v);
+      ASSERT_TRUE(*res == v);
+    } else {
+      auto res = l.erase(it);
+      auto rres = ref.erase(rit);
+      if (rres == ref.end()) ASSERT_TRUE(res == l.end());
+      else ASSERT_TRUE(*res == *rres);
+    }
+  }
+  ASSERT_TRUE(l.size() == ref.size());
+  ASSERT_TRUE(std::equal(ref.begin(), ref.end(), l.begin()));
+}
+
+TEST_F(UnrolledListTest, erase_range) {
+  unrolled_list<int> l;
+  for (int i = 0; i < 1000; ++i) l.push_back(i);
+  auto first = l.begin();
+  for (int i = 0; i < 100; ++i) ++first;
+  auto last = first;
+  for (int i = 0; i < 800; ++i) ++last;
+  auto res = l.erase(first, last);
+  ASSERT_TRUE(*res == 900);
+  ASSERT_TRUE(l.size() == 200);
+  int k = 0;
+  for (auto x : l) {
+    ASSERT_TRUE(x == k);
+    k = (k == 99) ? 900 : k + 1;
+  }
+  l.erase(l.begin(), l.end());
+  ASSERT_TRUE(l.empty());
+}
+
+TEST_F(UnrolledListTest, splice) {
+  unrolled_list<int> l1 = {1, 2, 5, 6};
+  unrolled_list<int> l2 = {3, 4};
+  auto pos = l1.begin();
+  ++pos;
+  ++pos;
+  l1.splice(pos, l2);
+  ASSERT_TRUE(l2.empty());
+  ASSERT_TRUE(l1.size() == 6);
+  int k = 1;
+  for (auto x : l1) ASSERT_TRUE(x == k++);
+
+  unrolled_list<int> l3 = {7, 8};
+  l1.splice(l1.end(), l3);
+  ASSERT_TRUE(l1.back() == 8);
+  ASSERT_TRUE(l1.size() == 8);
+}
+
+TEST_F(UnrolledListTest, non_trivial) {
+  unrolled_list<std::string> l;
+  for (int i = 0; i < 300; ++i) l.push_back(std::to_string(i));
+  auto it = l.begin();
+  for (int i = 0; i < 150; ++i) ++it;
+  l.insert(it, std::string("mid"));
+  l.emplace(l.begin(), "head");
+  ASSERT_TRUE(l.front() == "head");
+  ASSERT_TRUE(l.size() == 302);
+  unrolled_list<std::string> copy(l);
+  ASSERT_TRUE(copy == l);
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+}
+
+// 节点已满时插入的参数引用了拆分会搬走的元素
+TEST_F(UnrolledListTest, insert_aliasing) {
+  const size_t cap = mystl::__unrolled_node_capacity(sizeof(std::string));
+  for (size_t target = 0; target <= cap; target += cap / 4 ? cap / 4 : 1) {
+    unrolled_list<std::string> l;
+    std::list<std::string> ref;
+    for (size_t i = 0; i < cap; ++i) {
+      l.push_back(std::to_string(i) + "-long-enough-to-avoid-sso");
+      ref.push_back(std::to_string(i) + "-long-enough-to-avoid-sso");
+    }
+    auto pos = l.begin();
+    auto rpos = ref.begin();
+    for (size_t i = 0; i < target; ++i, ++pos, ++rpos) {}
+    l.insert(pos, *--l.end());
+    ref.insert(rpos, ref.back());
+    ASSERT_TRUE(l.size() == ref.size());
+    ASSERT_TRUE(std::equal(l.begin(), l.end(), ref.begin()));
+  }
+}
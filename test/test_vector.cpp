@@ -1,5 +1,8 @@
 #include "../vector.h"
 #include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 using namespace mystl;
 
@@ -344,6 +347,113 @@ TEST_F(VectorTest, emplace_back) {
     ASSERT_TRUE(11 == v.size());
 }
 
+namespace {
+    // 只能单遍读取的输入迭代器，读到 throw_at 时抛出异常
+    struct single_pass_iterator {
+        using iterator_category = input_iterator_tag;
+        using value_type = int;
+        using difference_type = ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        int i;
+        int throw_at;
+        const int& operator*() const {
+            if (i == throw_at) throw std::runtime_error("single_pass_iterator");
+            return i;
+        }
+        single_pass_iterator& operator++() { ++i; return *this; }
+        bool operator==(const single_pass_iterator& rhs) const { return i == rhs.i; }
+        bool operator!=(const single_pass_iterator& rhs) const { return i != rhs.i; }
+    };
+}
+
+namespace {
+    // 统计复制与移动次数
+    struct copy_counter {
+        static int copies, moves;
+        std::string s;
+
+        explicit copy_counter(std::string v = "") : s(mystl::move(v)) {}
+        copy_counter(const copy_counter& rhs) : s(rhs.s) { ++copies; }
+        copy_counter(copy_counter&& rhs) noexcept : s(mystl::move(rhs.s)) { ++moves; }
+        copy_counter& operator=(const copy_counter& rhs) { s = rhs.s; ++copies; return *this; }
+        copy_counter& operator=(copy_counter&& rhs) noexcept { s = mystl::move(rhs.s); ++moves; return *this; }
+        static void reset() { copies = moves = 0; }
+    };
+    int copy_counter::copies = 0;
+    int copy_counter::moves = 0;
+}
+
+TEST_F(VectorTest, insert_middle_moves) {
+    vector<copy_counter> v;
+    v.reserve(32);
+    for (int i = 0; i < 10; ++i) v.emplace_back(std::to_string(i) + std::string(20, '-'));
+
+    // 有备用空间时中间插入只移动尾部，不复制
+    copy_counter::reset();
+    v.insert(v.begin() + 3, copy_counter("rvalue"));
+    ASSERT_TRUE(copy_counter::copies == 0);
+    ASSERT_TRUE(v[3].s == "rvalue" && v[4].s == "3" + std::string(20, '-') && v.size() == 11);
+
+    copy_counter::reset();
+    v.emplace(v.begin() + 1, "emplaced");
+    ASSERT_TRUE(copy_counter::copies == 0 && v[1].s == "emplaced");
+
+    // 左值只复制一次
+    const copy_counter outside("outside");
+    copy_counter::reset();
+    v.insert(v.begin() + 5, outside);
+    ASSERT_TRUE(copy_counter::copies == 1 && v[5].s == "outside");
+
+    // 参数引用容器内将被平移的元素
+    const std::string last = v.back().s;
+    v.insert(v.begin(), v.back());
+    ASSERT_TRUE(v.front().s == last && v.back().s == last);
+    v.insert(v.begin() + 2, mystl::move(v[6]));
+    ASSERT_TRUE(v[2].s == "outside");
+    v.insert(v.begin() + 1, v[0]);
+    ASSERT_TRUE(v[0].s == last && v[1].s == last);
+
+    // 空间已满时参数引用旧空间中的元素
+    vector<std::string> w;
+    w.push_back("first");
+    for (int i = 0; i < 6; ++i) w.insert(w.begin() + 1, w[0]);
+    w.push_back(w[3]);
+    ASSERT_TRUE(w.size() == 8);
+    for (auto& x : w) ASSERT_TRUE(x == "first");
+
+    // 指针参数指向被平移的元素
+    vector<int> a;
+    a.reserve(8);
+    for (int i = 0; i < 4; ++i) a.push_back(i * 10);
+    a.insert(a.begin(), a[2]);
+    ASSERT_TRUE(a[0] == 20 && a[3] == 20 && a.size() == 5);
+}
+
+TEST_F(VectorTest, insert_input_range) {
+    vector<int> v;
+    for (int i = 0; i < 10; ++i) v.push_back(-i);
+    v.insert(v.begin() + 4, single_pass_iterator{0, -1}, single_pass_iterator{1000, -1});
+    v.insert(v.begin(), single_pass_iterator{5, -1}, single_pass_iterator{8, -1});
+    v.insert(v.end(), single_pass_iterator{1, -1}, single_pass_iterator{3, -1});
+    v.insert(v.begin() + 2, single_pass_iterator{0, -1}, single_pass_iterator{0, -1});
+
+    std::vector<int> expect;
+    for (int i = 0; i < 10; ++i) expect.push_back(-i);
+    for (int i = 999; i >= 0; --i) expect.insert(expect.begin() + 4, i);
+    expect.insert(expect.begin(), {5, 6, 7});
+    expect.insert(expect.end(), {1, 2});
+    ASSERT_TRUE(v.size() == expect.size());
+    for (size_t i = 0; i < expect.size(); ++i) ASSERT_TRUE(v[i] == expect[i]);
+
+    // 读取中途抛出异常时，已追加的元素被撤销，原有元素不变
+    vector<int> w(5, 1);
+    ASSERT_THROW(w.insert(w.begin() + 2, single_pass_iterator{0, 50}, single_pass_iterator{100, -1}), std::runtime_error);
+    ASSERT_TRUE(w.size() == 5);
+    for (int x : w) ASSERT_TRUE(x == 1);
+}
+
 // // 测试push_back的性能，50W条数据用时8ms
 // TEST_F(VectorTest, push_back_efficient) {
 //     vector<int> v;
@@ -440,4 +550,172 @@ TEST_F(VectorTest, emplace_back) {
 //         v.emplace_back(mystl::move(x));
 //     }
 //     ASSERT_TRUE(v.size() == 499999);
-// }
\ No newline at end of file
+// }
+TEST_F(VectorTest, bool_packed) {
+    vector<bool> v;
+    std::vector<bool> ref;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i % 3 == 0);
+        ref.push_back(i % 3 == 0);
+    }
+    ASSERT_TRUE(v.size() == 1000);
+    ASSERT_TRUE(v.capacity() < 2048);
+    for (size_t i = 0; i < ref.size(); ++i) ASSERT_TRUE(v[i] == ref[i]);
+
+    v[1] = true;
+    ref[1] = true;
+    v[0].flip();
+    ref[0].flip();
+    ASSERT_TRUE(!v.front() && v[1]);
+
+    v.insert(v.begin() + 5, true);
+    ref.insert(ref.begin() + 5, true);
+    v.insert(v.begin() + 70, 100, false);
+    ref.insert(ref.begin() + 70, 100, false);
+    v.erase(v.begin() + 3, v.begin() + 90);
+    ref.erase(ref.begin() + 3, ref.begin() + 90);
+    v.pop_back();
+    ref.pop_back();
+    v.resize(1200, true);
+    ref.resize(1200, true);
+    ASSERT_TRUE(v.size() == ref.size());
+    for (size_t i = 0; i < ref.size(); ++i) ASSERT_TRUE(v[i] == ref[i]);
+
+    vector<bool> w(v);
+    ASSERT_TRUE(w == v);
+    w.back() = !w.back();
+    ASSERT_TRUE(w != v);
+
+    vector<bool> b = {true, false, true};
+    ASSERT_TRUE(b.size() == 3 && b[0] && !b[1] && b[2]);
+    vector<bool> n(130, true);
+    ASSERT_TRUE(n.size() == 130 && n.back());
+}
+
+TEST_F(VectorTest, bool_word_algorithms) {
+    vector<bool> v(1000);
+    std::vector<bool> ref(1000);
+    for (size_t i = 0; i < 1000; i += 7) v[i] = ref[i] = true;
+
+    // 起点、终点分别落在字中间与字边界的各种区间
+    for (size_t first : {0, 1, 63, 64, 65, 500}) {
+        for (size_t last : {first, first + 1, size_t(128), size_t(999), size_t(1000)}) {
+            if (last < first) continue;
+            auto b = v.begin() + first, e = v.begin() + last;
+            auto rb = ref.begin() + first, re = ref.begin() + last;
+            ASSERT_TRUE(mystl::count(b, e, true) == std::count(rb, re, true));
+            ASSERT_TRUE(mystl::count(b, e, false) == std::count(rb, re, false));
+            ASSERT_TRUE(mystl::find(b, e, true) - v.begin() == std::find(rb, re, true) - ref.begin());
+            ASSERT_TRUE(mystl::find(b, e, false) - v.begin() == std::find(rb, re, false) - ref.begin());
+        }
+    }
+
+    mystl::fill(v.begin() + 3, v.begin() + 200, true);
+    std::fill(ref.begin() + 3, ref.begin() + 200, true);
+    mystl::flip(v.begin() + 150, v.begin() + 700);
+    for (size_t i = 150; i < 700; ++i) ref[i] = !ref[i];
+    for (size_t i = 0; i < ref.size(); ++i) ASSERT_TRUE(v[i] == ref[i]);
+
+    const vector<bool>& cv = v;
+    ASSERT_TRUE(mystl::count(cv.begin(), cv.end(), true) == std::count(ref.begin(), ref.end(), true));
+
+    vector<bool> a(200), b(200);
+    for (size_t i = 0; i < 200; ++i) {
+        a[i] = i % 2 == 0;
+        b[i] = i % 3 == 0;
+    }
+    vector<bool> x = a & b, o = a | b, e = a ^ b, na = ~a;
+    for (size_t i = 0; i < 200; ++i) {
+        ASSERT_TRUE(x[i] == (a[i] && b[i]));
+        ASSERT_TRUE(o[i] == (a[i] || b[i]));
+        ASSERT_TRUE(e[i] == (a[i] != b[i]));
+        ASSERT_TRUE(na[i] == !a[i]);
+    }
+    ASSERT_TRUE(mystl::count(na.begin(), na.end(), true) == 100);// 超出 size 的位不能被取反
+}
+
+TEST_F(VectorTest, bool_shrink_then_grow) {
+    // 缩小后整字超出 size() 的旧位必须清零，再增长跨过字边界时不能重新出现
+    auto expected = [](size_t ones, size_t zeros) {
+        vector<bool> r(ones, true);
+        for (size_t i = 0; i < zeros; ++i) r.push_back(false);
+        return r;
+    };
+
+    vector<bool> a(128, true);
+    a.erase(a.begin() + 10, a.end());
+    for (int i = 0; i < 55; ++i) a.push_back(false);
+    ASSERT_TRUE(a == expected(10, 55));
+    ASSERT_TRUE(mystl::count(a.begin(), a.end(), true) == 10);
+
+    vector<bool> c(200, true);
+    c.clear();
+    for (int i = 0; i < 100; ++i) c.push_back(false);
+    ASSERT_TRUE(c == expected(0, 100));
+
+    vector<bool> r(200, true);
+    r.resize(3);
+    r.resize(150);
+    ASSERT_TRUE(r == expected(3, 147));
+
+    vector<bool> p(65, true);
+    p.pop_back();
+    p.push_back(false);
+    ASSERT_TRUE(p == expected(64, 1));
+
+    vector<bool> s(300, true);
+    s.assign(20, false);
+    s.insert(s.end(), 200, false);
+    ASSERT_TRUE(s == expected(0, 220));
+    s.flip();
+    ASSERT_TRUE(mystl::count(s.begin(), s.end(), true) == 220);
+}
+
+// 空区间删除不能把元素移动赋值给自身
+TEST_F(VectorTest, erase_empty_range) {
+    vector<std::string> v;
+    for (int i = 0; i < 4; ++i) v.push_back(std::to_string(i) + "-long-enough-to-avoid-sso");
+    auto it = v.erase(v.begin() + 1, v.begin() + 1);
+    ASSERT_TRUE(it == v.begin() + 1 && v.size() == 4);
+    v.erase(v.begin(), v.begin());
+    v.erase(v.end(), v.end());
+    for (int i = 0; i < 4; ++i) ASSERT_TRUE(v[i] == std::to_string(i) + "-long-enough-to-avoid-sso");
+}
+
+TEST_F(VectorTest, move_only) {
+    vector<std::unique_ptr<int>> v;
+    for (int i = 0; i < 100; ++i) v.push_back(std::unique_ptr<int>(new int(i)));
+    ASSERT_TRUE(*v.emplace_back(new int(100)) == 100);
+    v.insert(v.begin() + 50, std::unique_ptr<int>(new int(-1)));
+    v.emplace(v.begin(), new int(-2));
+    ASSERT_TRUE(v.size() == 103 && *v[0] == -2 && *v[1] == 0 && *v[51] == -1 && *v.back() == 100);
+    v.erase(v.begin() + 51);
+    v.erase(v.begin());
+    for (int i = 0; i <= 100; ++i) ASSERT_TRUE(*v[i] == i);
+    v.reserve(1000);
+    v.resize(200);
+    ASSERT_TRUE(v.size() == 200 && *v[100] == 100 && !v[150]);
+    v.resize(101);
+    v.shrink_to_fit();
+    ASSERT_TRUE(v.capacity() == 101 && *v[100] == 100);
+
+    vector<std::unique_ptr<int>> w(mystl::move(v));
+    ASSERT_TRUE(v.empty() && w.size() == 101);
+    v = mystl::move(w);
+    mystl::swap(v, w);
+    ASSERT_TRUE(v.empty() && *w[7] == 7);
+}
+
+TEST_F(VectorTest, relocate_moves) {
+    // 移动构造不抛异常的元素在扩容、中间插入、删除时都不复制
+    vector<copy_counter> v;
+    copy_counter::reset();
+    for (int i = 0; i < 100; ++i) v.emplace_back(std::to_string(i));
+    v.insert(v.begin() + 10, copy_counter("x"));
+    v.erase(v.begin() + 20, v.begin() + 30);
+    v.reserve(500);
+    v.resize(200);
+    v.shrink_to_fit();
+    ASSERT_TRUE(copy_counter::copies == 0 && copy_counter::moves > 0);
+    ASSERT_TRUE(v[10].s == "x" && v[20].s == "29" && v.size() == 200);
+}
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// 并行算法使用的工作窃取线程池
+// 每个工作线程持有一个 Chase-Lev 双端队列：自己从底部压入、弹出（LIFO，利于缓存），
+// 空闲线程从其他队列的顶部窃取（FIFO，窃取到的通常是最大的子任务）。
+// 池的内部状态只使用 std 的分配器，因为 _default_alloc 的内存池不是线程安全的；
+// 同理，交给池执行的任务也不应通过 simpleAlloc 分配内存。
+namespace mystl {
+
+    // 任务由发起方在栈上持有，池中只保存指针；done 置位后发起方即可销毁任务
+    struct __pool_task {
+        void (*execute)(__pool_task*);
+        std::atomic<bool> done{false};
+        std::exception_ptr error;
+
+        explicit __pool_task(void (*f)(__pool_task*)) : execute(f) {}
+    };
+
+    template<class Function>
+    struct __pool_task_impl : __pool_task {
+        Function& f;
+
+        explicit __pool_task_impl(Function& fn) : __pool_task(&run), f(fn) {}
+
+        static void run(__pool_task* task) {
+            auto* self = static_cast<__pool_task_impl*>(task);
+            try {
+                self->f();
+            } catch (...) {
+                self->error = std::current_exception();
+            }
+            self->done.store(true, std::memory_order_release);
+        }
+    };
+
+    // Chase-Lev 工作窃取队列（Lê 等人给出的 C11 内存序版本）
+    // push / pop 只能由所有者线程调用，steal 可由任意线程调用；队列满时容量翻倍，
+    // 旧数组可能仍被窃取者读取，因此留到析构时才释放
+    template<class T>
+    class __work_steal_deque {
+    private:
+        struct array {
+            int64_t capacity;
+            std::atomic<T*>* slots;
+
+            explicit array(int64_t cap) : capacity(cap), slots(new std::atomic<T*>[static_cast<size_t>(cap)]) {}
+            ~array() { delete[] slots; }
+
+            // 槽位以 release / acquire 读写，使任务对象在压入前的初始化对窃取者可见
+            T* get(int64_t i) const { return slots[i & (capacity - 1)].load(std::memory_order_acquire); }
+            void put(int64_t i, T* x) { slots[i & (capacity - 1)].store(x, std::memory_order_release); }
+
+            array* grow(int64_t bottom, int64_t top) const {
+                array* a = new array(capacity * 2);
+                for (int64_t i = top; i != bottom; ++i) a->put(i, get(i));
+                return a;
+            }
+        };
+
+        alignas(64) std::atomic<int64_t> top_;
+        alignas(64) std::atomic<int64_t> bottom_;
+        std::atomic<array*> array_;
+        std::vector<array*> retired_;
+
+    public:
+        explicit __work_steal_deque(int64_t capacity = 256) : top_(0), bottom_(0), array_(new array(capacity)) {}
+        __work_steal_deque(const __work_steal_deque&) = delete;
+        __work_steal_deque& operator=(const __work_steal_deque&) = delete;
+
+        ~__work_steal_deque() {
+            delete array_.load(std::memory_order_relaxed);
+            for (array* a : retired_) delete a;
+        }
+
+        bool empty() const noexcept {
+            return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+        }
+
+        void push(T* x) {
+            const int64_t b = bottom_.load(std::memory_order_relaxed);
+            const int64_t t = top_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+            if (b - t > a->capacity - 1) {
+                retired_.push_back(a);
+                a = a->grow(b, t);
+                array_.store(a, std::memory_order_release);
+            }
+            a->put(b, x);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // 队列为空或最后一个元素被窃取时返回 nullptr
+        T* pop() {
+            const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_relaxed);
+            if (t > b) {
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            T* x = a->get(b);
+            if (t == b) {// 只剩一个元素，与窃取者竞争
+                if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    x = nullptr;
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            }
+            return x;
+        }
+
+        // 队列为空或竞争失败时返回 nullptr
+        T* steal() {
+            int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t b = bottom_.load(std::memory_order_acquire);
+            if (t >= b) return nullptr;
+            array* a = array_.load(std::memory_order_acquire);
+            T* x = a->get(t);
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+            return x;
+        }
+    };
+
+    // concurrency 个执行者：concurrency - 1 个后台工作线程，加上发起并行调用的线程本身。
+    // 发起线程在等待子任务时也会执行或窃取任务，因此 thread_pool(1) 即为串行执行
+    class thread_pool {
+    private:
+        struct worker {
+            __work_steal_deque<__pool_task> tasks;
+            std::thread thread;
+        };
+
+        struct thread_slot {
+            const thread_pool* pool = nullptr;
+            size_t index = 0;
+            uint64_t seed = 0x9E3779B97F4A7C15ULL;
+        };
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        std::vector<std::unique_ptr<worker>> workers_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::vector<__pool_task*> injected_;      // 非工作线程提交的任务，由 mutex_ 保护
+        std::atomic<size_t> injected_count_{0};
+        std::atomic<int64_t> queued_{0};          // 已提交但尚未被取走的任务数
+        std::atomic<size_t> sleeping_{0};
+        bool stop_ = false;
+
+    public:
+        explicit thread_pool(size_t concurrency = std::thread::hardware_concurrency()) {
+            const size_t n = concurrency > 1 ? concurrency - 1 : 0;
+            for (size_t i = 0; i < n; ++i) workers_.emplace_back(new worker);
+            try {
+                for (size_t i = 0; i < n; ++i) workers_[i]->thread = std::thread(&thread_pool::worker_loop, this, i);
+            } catch (...) {
+                shutdown();
+                throw;
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() { shutdown(); }
+
+        size_t concurrency() const noexcept { return workers_.size() + 1; }
+
+        // 并行算法默认使用的线程池，线程数等于硬件并发数
+        static thread_pool& default_pool() {
+            static thread_pool pool;
+            return pool;
+        }
+
+        // fork-join：f2 作为可被窃取的任务提交，当前线程执行 f1，随后等待 f2 完成。
+        // 两者抛出的异常在都结束后重新抛出，f1 的异常优先
+        template<class F1, class F2>
+        void invoke(F1&& f1, F2&& f2) {
+            if (workers_.empty()) {
+                f1();
+                f2();
+                return;
+            }
+            __pool_task_impl<std::remove_reference_t<F2>> task(f2);
+            const size_t self = current_index();
+            spawn(&task, self);
+            std::exception_ptr error;
+            try {
+                f1();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            wait(task, self);
+            if (error) std::rethrow_exception(error);
+            if (task.error) std::rethrow_exception(task.error);
+        }
+
+        // 把 [first, last) 二分到不超过 grain 的块，对每块调用 f(块首, 块尾)
+        template<class Function>
+        void parallel_for(size_t first, size_t last, size_t grain, Function&& f) {
+            if (grain == 0) grain = 1;
+            if (last - first > grain) {
+                const size_t mid = first + (last - first) / 2;
+                invoke([&] { parallel_for(first, mid, grain, f); }, [&] { parallel_for(mid, last, grain, f); });
+            } else if (first != last) {
+                f(first, last);
+            }
+        }
+
+    private:
+        static thread_slot& current_slot() {
+            static thread_local thread_slot slot;
+            return slot;
+        }
+
+        // 当前线程在本池中的工作线程下标，非工作线程返回 npos
+        size_t current_index() const {
+            const thread_slot& slot = current_slot();
+            return slot.pool == this ? slot.index : npos;
+        }
+
+        void spawn(__pool_task* task, size_t self) {
+            if (self != npos) {
+                workers_[self]->tasks.push(task);
+            } else {
+                std::lock_guard<std::mutex> lock(mutex_);
+                injected_.push_back(task);
+                injected_count_.fetch_add(1, std::memory_order_release);
+            }
+            queued_.fetch_add(1, std::memory_order_seq_cst);
+            if (sleeping_.load(std::memory_order_seq_cst) > 0) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                cv_.notify_one();
+            }
+        }
+
+        __pool_task* steal(size_t self) {
+            const size_t n = workers_.size();
+            uint64_t& seed = current_slot().seed;
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            const size_t start = static_cast<size_t>(seed % n);
+            for (size_t i = 0; i < n; ++i) {
+                const size_t victim = (start + i) % n;
+                if (victim == self) continue;
+                if (__pool_task* task = workers_[victim]->tasks.steal()) return task;
+            }
+            return nullptr;
+        }
+
+        // 依次尝试自己的队列、外部提交的任务、其他线程的队列，执行取到的一个任务
+        bool run_one(size_t self) {
+            __pool_task* task = nullptr;
+            if (self != npos) task = workers_[self]->tasks.pop();
+            if (!task && injected_count_.load(std::memory_order_acquire) > 0) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!injected_.empty()) {
+                    task = injected_.back();
+                    injected_.pop_back();
+                    injected_count_.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+            if (!task) task = steal(self);
+            if (!task) return false;
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            task->execute(task);
+            return true;
+        }
+
+        // 等待期间协助执行其他任务；task 仍在自己队列中时会被直接弹出执行
+        void wait(const __pool_task& task, size_t self) {
+            while (!task.done.load(std::memory_order_acquire)) {
+                if (!run_one(self)) std::this_thread::yield();
+            }
+        }
+
+        void worker_loop(size_t index) {
+            thread_slot& slot = current_slot();
+            slot.pool = this;
+            slot.index = index;
+            slot.seed += index * 0x2545F4914F6CDD1DULL;
+            while (true) {
+                if (run_one(index)) continue;
+                bool found = false;
+                for (int spin = 0; spin < 64 && !found; ++spin) {// 短暂自旋，避免频繁休眠唤醒
+                    std::this_thread::yield();
+                    found = run_one(index);
+                }
+                if (found) continue;
+                std::unique_lock<std::mutex> lock(mutex_);
+                sleeping_.fetch_add(1, std::memory_order_seq_cst);
+                cv_.wait(lock, [this] { return stop_ || queued_.load(std::memory_order_seq_cst) > 0; });
+                sleeping_.fetch_sub(1, std::memory_order_relaxed);
+                if (stop_) return;
+            }
+        }
+
+        void shutdown() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            for (auto& w : workers_) {
+                if (w->thread.joinable()) w->thread.join();
+            }
+        }
+    };
+
+} // namespace mystl
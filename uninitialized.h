@@ -5,6 +5,7 @@
 #include "iterator.h"
 #include "algobase.h"
 #include <cstring>// memove
+#include <type_traits>
 
 namespace mystl {
 
@@ -95,6 +96,47 @@ namespace mystl {
         return cur;
     }
 
+    // 把 [first, last) 搬到未初始化空间 result 处：元素的移动构造不抛异常（或元素不可复制）时移动，
+    // 否则复制，即 std::move_if_noexcept 的规则；中途失败时析构已构造的元素，可复制的元素原数据保持完好
+    template<class InputIterator, class ForwardIterator>
+    inline ForwardIterator uninitialized_move_if_noexcept(InputIterator first,
+        InputIterator last,
+        ForwardIterator result) {
+        using isPODType =
+            typename type_traits<value_type_t<InputIterator>>::is_POD_type;
+        return _uninitialized_move_aux(first, last, result, isPODType());
+    }
+
+    template<class InputIterator, class ForwardIterator>
+    inline ForwardIterator _uninitialized_move_aux(InputIterator first,
+        InputIterator last,
+        ForwardIterator result,
+        true_type) {
+        return mystl::copy(first, last, result);
+    }
+
+    template<class InputIterator, class ForwardIterator>
+    ForwardIterator _uninitialized_move_aux(InputIterator first,
+        InputIterator last,
+        ForwardIterator result,
+        false_type) {
+        using T = value_type_t<InputIterator>;
+        constexpr bool use_move = std::is_nothrow_move_constructible<T>::value ||
+            !std::is_copy_constructible<T>::value;
+        ForwardIterator cur = result;
+        try {
+            for (; first != last; ++first, ++cur) {
+                if constexpr (use_move) construct(&*cur, mystl::move(*first));
+                else construct(&*cur, *first);
+            }
+        }
+        catch (...) {
+            mystl::destroy(result, cur);
+            throw;
+        }
+        return cur;
+    }
+
     // SGI_STL的扩展：
     // uninitialized_copy_copy, uninitialized_copy_fill, uninitialized_fill_copy
 
@@ -0,0 +1,493 @@
+#pragma once
+
+#include "iterator.h"
+#include "allocator.h"
+#include "algobase.h"
+#include "construct.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>  // aligned_storage
+
+// 每个节点中元素区的目标字节数
+#ifndef UNROLLED_NODE_BYTES
+#define UNROLLED_NODE_BYTES 256
+#endif
+
+// 节点定义
+// 每个节点保存一小段连续的元素，[0, count) 为已构造的元素
+// 除哨兵节点外，链表中不存在 count == 0 的节点
+namespace mystl {
+    inline constexpr size_t __unrolled_node_capacity(size_t sz) {
+        return sz * 2 <= UNROLLED_NODE_BYTES ? size_t(UNROLLED_NODE_BYTES / sz) : size_t(2);
+    }
+
+    struct __unrolled_node_base {
+        __unrolled_node_base* prev;
+        __unrolled_node_base* next;
+        size_t count;
+    };
+
+    template<class T>
+    struct __unrolled_node : public __unrolled_node_base {
+        static constexpr size_t capacity = __unrolled_node_capacity(sizeof(T));
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[capacity];
+
+        T* data() noexcept { return reinterpret_cast<T*>(storage); }
+    };
+
+    template<class T>
+    constexpr size_t __unrolled_node<T>::capacity;
+}
+
+
+// 迭代器定义
+namespace mystl {
+    template<class T, class Ref, class Ptr>
+    struct __unrolled_list_iterator {
+        using iterator = __unrolled_list_iterator<T, T &, T *>;
+        using const_iterator = __unrolled_list_iterator<T, const T &, const T *>;
+        using self = __unrolled_list_iterator;
+
+        using iterator_category = bidirectional_iterator_tag;
+        using value_type = T;
+        using pointer = Ptr;
+        using reference = Ref;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using base_ptr = __unrolled_node_base *;
+        using node_ptr = __unrolled_node<T> *;
+
+        // 数据成员
+        base_ptr node;      // 所在节点
+        size_type idx;      // 节点内下标
+
+        __unrolled_list_iterator() : node(nullptr), idx(0) {}
+        __unrolled_list_iterator(base_ptr n, size_type i) : node(n), idx(i) {}
+        __unrolled_list_iterator(const iterator &rhs) : node(rhs.node), idx(rhs.idx) {}
+        self &operator=(const self &) = default;
+
+        reference operator*() const { return static_cast<node_ptr>(node)->data()[idx]; }
+        pointer operator->() const { return &(operator*()); }
+
+        self &operator++() {
+            if (++idx == node->count) {// 到达节点末尾，跳到下一个节点开头
+                node = node->next;
+                idx = 0;
+            }
+            return *this;
+        }
+
+        self operator++(int) {
+            self temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        self &operator--() {
+            if (idx == 0) {
+                node = node->prev;
+                idx = node->count;
+            }
+            --idx;
+            return *this;
+        }
+
+        self operator--(int) {
+            self temp = *this;
+            --*this;
+            return temp;
+        }
+    };
+
+    template<class T, class RefL, class PtrL, class RefR, class PtrR>
+    inline bool operator==(const __unrolled_list_iterator<T, RefL, PtrL> &lhs,
+                           const __unrolled_list_iterator<T, RefR, PtrR> &rhs) {
+        return lhs.node == rhs.node && lhs.idx == rhs.idx;
+    }
+
+    template<class T, class RefL, class PtrL, class RefR, class PtrR>
+    inline bool operator!=(const __unrolled_list_iterator<T, RefL, PtrL> &lhs,
+                           const __unrolled_list_iterator<T, RefR, PtrR> &rhs) {
+        return !(lhs == rhs);
+    }
+} // namespace mystl
+
+
+namespace mystl {
+
+    // 展开链表：每个节点存放 capacity 个元素，遍历时大部分步进都在同一块连续内存中
+    // 插入会使所在节点上的迭代器失效；删除会使所在节点及其后继节点上的迭代器失效，
+    // 因为删除后若两节点合起来不超过半个节点，后继的元素会并入当前节点。其余节点上的迭代器保持有效
+    template<class T, class Alloc = simpleAlloc<T>>
+    class unrolled_list {
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = const T *;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = __unrolled_list_iterator<T, T &, T *>;
+        using const_iterator = __unrolled_list_iterator<T, const T &, const T *>;
+        using reverse_iterator = __reverse_iterator<iterator>;
+        using const_reverse_iterator = __reverse_iterator<const_iterator>;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+    private: // 节点创建，销毁
+        using base_node = __unrolled_node_base;
+        using data_node = __unrolled_node<T>;
+        using base_allocator = typename __rebind_alloc<Alloc, base_node>::type;
+        using node_allocator = typename __rebind_alloc<Alloc, data_node>::type;
+
+        static constexpr size_type node_capacity = data_node::capacity;
+
+        static T* data_of(base_node* p) noexcept { return static_cast<data_node*>(p)->data(); }
+
+        base_node* create_node() {
+            base_node* p = node_allocator::allocate();
+            p->count = 0;
+            return p;
+        }
+        void destroy_node(base_node* p) {
+            T* data = data_of(p);
+            for (size_type i = 0; i < p->count; ++i) mystl::destroy(data + i);
+            node_allocator::deallocate(static_cast<data_node*>(p));
+        }
+
+    private: // 哨兵节点，只分配链接部分，count 恒为 0
+        base_node* _node;
+        size_type _size;
+
+    private: // aux interface
+        void empty_initialized();
+        void link_after(base_node* pos, base_node* p) noexcept;
+        void unlink(base_node* p) noexcept;
+        base_node* split_node(base_node* p, size_type idx);
+        template<class... Args>
+        iterator insert_aux(iterator pos, Args&&... args);
+        template<class... Args>
+        iterator insert_in_node(base_node* p, size_type idx, Args&&... args);
+        void merge_next(base_node* p);
+
+    public: // 迭代器相关操作
+        iterator               begin()         noexcept { return iterator(_node->next, 0); }
+        const_iterator         begin()   const noexcept { return const_iterator(_node->next, 0); }
+        iterator               end()           noexcept { return iterator(_node, 0); }
+        const_iterator         end()     const noexcept { return const_iterator(_node, 0); }
+        reverse_iterator       rbegin()        noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator       rend()          noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+        const_iterator         cbegin()  const noexcept { return begin(); }
+        const_iterator         cend()    const noexcept { return end(); }
+
+    public: // 容量操作
+        size_type size() const noexcept { return _size; }
+        bool empty() const noexcept { return _node->next == _node; }
+        reference front() { return *begin(); }
+        const_reference front() const { return *begin(); }
+        reference back() { return data_of(_node->prev)[_node->prev->count - 1]; }
+        const_reference back() const { return data_of(_node->prev)[_node->prev->count - 1]; }
+
+    public: // 构造、复制、移动、析构函数
+        unrolled_list() { empty_initialized(); }
+        explicit unrolled_list(size_type n, const value_type& value = value_type()) {
+            empty_initialized();
+            for (; n > 0; --n) push_back(value);
+        }
+
+        template<class InputIterator, class = enable_if_t<!is_integral<InputIterator>::value>>
+        unrolled_list(InputIterator first, InputIterator last) {
+            empty_initialized();
+            for (; first != last; ++first) push_back(*first);
+        }
+
+        unrolled_list(std::initializer_list<value_type> il)
+            : unrolled_list(il.begin(), il.end()) {}
+
+        unrolled_list(const unrolled_list& rhs)
+            : unrolled_list(rhs.begin(), rhs.end()) {}
+
+        unrolled_list(unrolled_list&& rhs) noexcept {
+            empty_initialized();
+            swap(rhs);
+        }
+
+        ~unrolled_list() {
+            clear();
+            base_allocator::deallocate(_node);
+        }
+
+        unrolled_list& operator=(const unrolled_list& rhs) {
+            if (this != &rhs) {
+                unrolled_list temp(rhs);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        unrolled_list& operator=(unrolled_list&& rhs) noexcept {
+            if (this != &rhs) {
+                clear();
+                swap(rhs);
+            }
+            return *this;
+        }
+
+    public: // swap
+        void swap(unrolled_list& rhs) noexcept {
+            mystl::swap(_node, rhs._node);
+            mystl::swap(_size, rhs._size);
+        }
+
+    public: // 添加与删除
+        void push_back(const value_type& val) { emplace_back(val); }
+        void push_back(value_type&& val) { emplace_back(mystl::move(val)); }
+        void push_front(const value_type& val) { emplace_front(val); }
+        void push_front(value_type&& val) { emplace_front(mystl::move(val)); }
+
+        template<class... Args>
+        void emplace_back(Args&&... args);
+        template<class... Args>
+        void emplace_front(Args&&... args) { insert_aux(begin(), mystl::forward<Args>(args)...); }
+        template<class... Args>
+        iterator emplace(iterator pos, Args&&... args) {
+            return insert_aux(pos, mystl::forward<Args>(args)...);
+        }
+
+        void pop_front() { erase(begin()); }
+        void pop_back() { erase(iterator(_node->prev, _node->prev->count - 1)); }
+
+    public: // insert & erase
+        iterator insert(iterator pos, const value_type& val) { return insert_aux(pos, val); }
+        iterator insert(iterator pos, value_type&& val) { return insert_aux(pos, mystl::move(val)); }
+
+        iterator erase(iterator pos);
+        iterator erase(iterator first, iterator last);
+        void clear();
+
+    public: // other interface
+        // 把 x 的全部节点整体挂到 pos 之前，pos 位于节点边界时为 O(1)，否则先拆分 pos 所在节点
+        void splice(iterator pos, unrolled_list& x);
+    };
+
+
+    template<class T, class Alloc>
+    inline void unrolled_list<T, Alloc>::empty_initialized() {
+        _node = base_allocator::allocate();
+        _node->prev = _node;
+        _node->next = _node;
+        _node->count = 0;
+        _size = 0;
+    }
+
+    template<class T, class Alloc>
+    inline void unrolled_list<T, Alloc>::link_after(base_node* pos, base_node* p) noexcept {
+        p->prev = pos;
+        p->next = pos->next;
+        pos->next->prev = p;
+        pos->next = p;
+    }
+
+    template<class T, class Alloc>
+    inline void unrolled_list<T, Alloc>::unlink(base_node* p) noexcept {
+        p->prev->next = p->next;
+        p->next->prev = p->prev;
+    }
+
+    // 把 p 中 [idx, count) 的元素移到紧随其后的新节点中，返回新节点
+    template<class T, class Alloc>
+    typename unrolled_list<T, Alloc>::base_node *
+    unrolled_list<T, Alloc>::split_node(base_node* p, size_type idx) {
+        base_node* q = create_node();
+        T* src = data_of(p);
+        T* dst = data_of(q);
+        for (size_type i = idx; i < p->count; ++i) {
+            construct(dst + (i - idx), mystl::move(src[i]));
+            mystl::destroy(src + i);
+        }
+        q->count = p->count - idx;
+        p->count = idx;
+        link_after(p, q);
+        return q;
+    }
+
+    // 若 p 与后继节点合起来不超过半个节点，则把后继并入 p，防止大量删除后节点过稀
+    template<class T, class Alloc>
+    void unrolled_list<T, Alloc>::merge_next(base_node* p) {
+        base_node* q = p->next;
+        if (q == _node || p->count + q->count > node_capacity / 2) return;
+        T* dst = data_of(p) + p->count;
+        T* src = data_of(q);
+        for (size_type i = 0; i < q->count; ++i) {
+            construct(dst + i, mystl::move(src[i]));
+            mystl::destroy(src + i);
+        }
+        p->count += q->count;
+        q->count = 0;
+        unlink(q);
+        node_allocator::deallocate(static_cast<data_node*>(q));
+    }
+
+    template<class T, class Alloc>
+    template<class... Args>
+    void unrolled_list<T, Alloc>::emplace_back(Args&&... args) {
+        base_node* tail = _node->prev;
+        if (tail == _node || tail->count == node_capacity) {
+            base_node* p = create_node();
+            try {
+                construct(data_of(p), mystl::forward<Args>(args)...);
+            } catch (...) {
+                node_allocator::deallocate(static_cast<data_node*>(p));
+                throw;
+            }
+            p->count = 1;
+            link_after(tail, p);
+        } else {
+            construct(data_of(tail) + tail->count, mystl::forward<Args>(args)...);
+            ++tail->count;
+        }
+        ++_size;
+    }
+
+    // 在 pos 前插入元素
+    // 节点已满时从中间拆分；pos 位于节点开头且前驱有空位时直接追加到前驱末尾
+    template<class T, class Alloc>
+    template<class... Args>
+    typename unrolled_list<T, Alloc>::iterator
+    unrolled_list<T, Alloc>::insert_aux(iterator pos, Args&&... args) {
+        base_node* p = pos.node;
+        size_type idx = pos.idx;
+        if (idx == 0 && p->prev != _node && p->prev->count < node_capacity) {
+            p = p->prev;
+            idx = p->count;
+        }
+        if (p == _node) {// 空表或在末尾插入
+            emplace_back(mystl::forward<Args>(args)...);
+            return iterator(_node->prev, _node->prev->count - 1);
+        }
+        if (p->count == node_capacity) {
+            // 拆分会移动并析构后半部分元素，参数可能引用其中之一，先构造出新值
+            value_type value_copy(mystl::forward<Args>(args)...);
+            base_node* q = split_node(p, node_capacity / 2);
+            if (idx > p->count) {
+                idx -= p->count;
+                p = q;
+            }
+            return insert_in_node(p, idx, mystl::move(value_copy));
+        }
+        return insert_in_node(p, idx, mystl::forward<Args>(args)...);
+    }
+
+    // 在未满的节点 p 的 idx 处插入元素
+    template<class T, class Alloc>
+    template<class... Args>
+    typename unrolled_list<T, Alloc>::iterator
+    unrolled_list<T, Alloc>::insert_in_node(base_node* p, size_type idx, Args&&... args) {
+        T* data = data_of(p);
+        if (idx == p->count) {
+            construct(data + idx, mystl::forward<Args>(args)...);
+        } else {// 节点内右移一位，先构造出新值以防参数引用了被移动的元素
+            value_type value_copy(mystl::forward<Args>(args)...);
+            construct(data + p->count, mystl::move(data[p->count - 1]));
+            for (size_type i = p->count - 1; i > idx; --i)
+                data[i] = mystl::move(data[i - 1]);
+            data[idx] = mystl::move(value_copy);
+        }
+        ++p->count;
+        ++_size;
+        return iterator(p, idx);
+    }
+
+    // 删除元素，节点内左移；节点变空时释放，过稀时与后继合并
+    template<class T, class Alloc>
+    typename unrolled_list<T, Alloc>::iterator
+    unrolled_list<T, Alloc>::erase(iterator pos) {
+        base_node* p = pos.node;
+        const size_type idx = pos.idx;
+        T* data = data_of(p);
+        for (size_type i = idx + 1; i < p->count; ++i)
+            data[i - 1] = mystl::move(data[i]);
+        mystl::destroy(data + p->count - 1);
+        --p->count;
+        --_size;
+
+        if (p->count == 0) {
+            base_node* next = p->next;
+            unlink(p);
+            node_allocator::deallocate(static_cast<data_node*>(p));
+            return iterator(next, 0);
+        }
+        merge_next(p);
+        return idx < p->count ? iterator(p, idx) : iterator(p->next, 0);
+    }
+
+    template<class T, class Alloc>
+    typename unrolled_list<T, Alloc>::iterator
+    unrolled_list<T, Alloc>::erase(iterator first, iterator last) {
+        // 先记下 last 之前的元素个数，逐个删除时 last 可能因节点合并而失效
+        size_type n = 0;
+        for (iterator it = first; it != last; ++it) ++n;
+        for (; n > 0; --n) first = erase(first);
+        return first;
+    }
+
+    template<class T, class Alloc>
+    void unrolled_list<T, Alloc>::clear() {
+        base_node* cur = _node->next;
+        while (cur != _node) {
+            base_node* temp = cur;
+            cur = cur->next;
+            destroy_node(temp);
+        }
+        _node->next = _node;
+        _node->prev = _node;
+        _size = 0;
+    }
+
+    template<class T, class Alloc>
+    void unrolled_list<T, Alloc>::splice(iterator pos, unrolled_list& x) {
+        if (this == &x || x.empty()) return;
+        base_node* p = pos.node;
+        if (pos.idx != 0) p = split_node(p, pos.idx);
+        base_node* first = x._node->next;
+        base_node* last = x._node->prev;
+        first->prev = p->prev;
+        p->prev->next = first;
+        last->next = p;
+        p->prev = last;
+        _size += x._size;
+        x._node->next = x._node;
+        x._node->prev = x._node;
+        x._size = 0;
+    }
+
+
+    template<class T, class Alloc>
+    bool operator==(const unrolled_list<T, Alloc> &lhs, const unrolled_list<T, Alloc> &rhs) {
+        if (lhs.size() != rhs.size()) return false;
+        auto it1 = lhs.begin(), it2 = rhs.begin();
+        for (; it1 != lhs.end(); ++it1, ++it2)
+            if (*it1 != *it2) return false;
+        return true;
+    }
+
+    template<class T, class Alloc>
+    inline bool operator!=(const unrolled_list<T, Alloc> &lhs, const unrolled_list<T, Alloc> &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class T, class Alloc>
+    inline bool operator<(const unrolled_list<T, Alloc> &lhs, const unrolled_list<T, Alloc> &rhs) {
+        return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template<class T, class Alloc>
+    inline void swap(unrolled_list<T, Alloc> &lhs, unrolled_list<T, Alloc> &rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl
@@ -6,8 +6,29 @@
 #include "construct.h"
 
 #include <cstddef>// ptrdiff_t
+#include <cstdint>// uintptr_t
+#include <type_traits>
 
 namespace mystl {
+    // ָָĶλ [first, last) Ĵ洢ʱ true
+    // жϲʱƽԪػ᲻Ķ
+    template<class Arg>
+    inline bool __arg_aliases(const void* first, const void* last, const Arg& arg) noexcept {
+        const uintptr_t lo = reinterpret_cast<uintptr_t>(first), hi = reinterpret_cast<uintptr_t>(last);
+        const uintptr_t a = reinterpret_cast<uintptr_t>(&reinterpret_cast<const volatile char&>(arg));
+        if (a >= lo && a < hi) return true;
+        if constexpr (std::is_pointer<Arg>::value) {
+            const uintptr_t p = reinterpret_cast<uintptr_t>(arg);
+            return p >= lo && p < hi;
+        }
+        return false;
+    }
+
+    template<class... Args>
+    inline bool __args_alias(const void* first, const void* last, const Args&... args) noexcept {
+        return (false || ... || mystl::__arg_aliases(first, last, args));
+    }
+
     // use sub_allocator as default allocator
     template<class T, class Alloc = simpleAlloc<T>>
     class vector {
@@ -136,11 +157,14 @@ namespace mystl {
 
     public:// interface for size and capacity
         void resize(size_type, const value_type&);
-        void resize(size_type new_size) { resize(new_size, value_type()); }
+        void resize(size_type);
         void reserve(size_type);
         void shrink_to_fit() noexcept {
-            vector temp(*this);
-            swap(temp);
+            if (finish == end_of_storage) return;
+            try {
+                reallocate(size());
+            }
+            catch (...) {}  // ʧʱԭ
         }
 
     public:// compare operator(member function)
@@ -162,8 +186,14 @@ namespace mystl {
         iterator erase(iterator position) { return erase(position, position + 1); }
         void clear() { erase(begin(), end()); }
 
+    private:// ԪذᵽΪ new_capacity ¿ռ䣨new_capacity >= size()
+        void reallocate(size_type new_capacity);
+
     private:// aux_interface for insert
-        void insert_aux(iterator, const value_type&);                                   // 뵥ֵ
+        template<class... Args>
+        void insert_aux(iterator, Args&&...);                                           // ÿռ㹻ʱ뵥ֵ
+        template<class... Args>
+        void realloc_insert(iterator, Args&&...);                                       // ݲ뵥ֵ
         void fill_insert(iterator, size_type, const value_type&);                       // ֵ
         template<class InputIterator>
         void range_insert(iterator pos, InputIterator first, InputIterator last,        // Χ루
@@ -228,56 +258,82 @@ namespace mystl {
         iterator emplace(iterator pos, Args&& ...args);
 
         template<class... Args>
-        iterator emplace_back(Args&& ...args);
+        reference emplace_back(Args&& ...args);
        
     };
 
-    // positionλòһֵֵ
+    //  position һԪأҪбÿռ position != finish
+    // [position, finish) һƶǸƣñƶԪءҹ첻쳣ʱ
+    // ֱڿճλϹ죬ȹʱȶȡҲ֤ʧʱ䣩ƽƺƶֵ
     template<class T, class Alloc>
-    void vector<T, Alloc>::insert_aux(iterator position, const value_type& value) {
-        if (finish != end_of_storage) {// needn't expand
-            construct(finish, *(finish - 1));
+    template<class... Args>
+    void vector<T, Alloc>::insert_aux(iterator position, Args&&... args) {
+        if (std::is_nothrow_constructible<value_type, Args&&...>::value &&
+            !mystl::__args_alias(position, finish, args...)) {
+            construct(finish, mystl::move(*(finish - 1)));
             ++finish;
-            value_type value_copy = value;// STL copy in copy out
-            mystl::copy_backward(position, finish - 2, finish - 1);
-            *position = value_copy;
+            mystl::move_backward(position, finish - 2, finish - 1);
+            mystl::destroy(position);
+            construct(position, mystl::forward<Args>(args)...);
         }
-        else {// expand
-            const size_type old_size = size();      
-            const size_type new_size =                                  // old_size == 0Ļռ12 * old_size
-                old_size ? 2 * old_size : 1;
-            iterator new_start = data_allocator::allocate(new_size);
-            iterator new_finish = new_start;
-            try {
-                new_finish = mystl::uninitialized_copy(
-                    start, position, new_start);                        // Copy the first segment
-                construct(new_finish, value);
-                ++new_finish;
-                new_finish = mystl::uninitialized_copy(
-                    position, finish, new_finish);                      // Copy the second segment
-            }
-            catch (std::exception&) {
-                // commit or rollback
-                destroy(new_start, new_finish);
-                data_allocator::deallocate(new_start, new_size);
-                throw;
-            }
-            destroy_and_deallocate();
-            start = new_start;
-            finish = new_finish;
-            end_of_storage = new_start + new_size;
+        else {
+            value_type temp(mystl::forward<Args>(args)...);
+            construct(finish, mystl::move(*(finish - 1)));
+            ++finish;
+            mystl::move_backward(position, finish - 2, finish - 1);
+            *position = mystl::move(temp);
         }
     }
 
+    // ռʱ position һԪأ¿ռйԪأþɿռеԪأ
+    // ٰǰΰȥ
+    template<class T, class Alloc>
+    template<class... Args>
+    void vector<T, Alloc>::realloc_insert(iterator position, Args&&... args) {
+        const size_type old_size = size();
+        const size_type new_size = old_size ? 2 * old_size : 1;
+        iterator new_start = data_allocator::allocate(new_size);
+        iterator new_pos = new_start + (position - start);
+        try {
+            construct(new_pos, mystl::forward<Args>(args)...);
+        }
+        catch (...) {
+            data_allocator::deallocate(new_start, new_size);
+            throw;
+        }
+        iterator new_finish = new_start;
+        try {
+            new_finish = mystl::uninitialized_move_if_noexcept(start, position, new_start);
+            new_finish = mystl::uninitialized_move_if_noexcept(position, finish, new_pos + 1);
+        }
+        catch (...) {
+            // commit or rollback
+            mystl::destroy(new_start, new_finish);
+            mystl::destroy(new_pos);
+            data_allocator::deallocate(new_start, new_size);
+            throw;
+        }
+        destroy_and_deallocate();
+        start = new_start;
+        finish = new_finish;
+        end_of_storage = new_start + new_size;
+    }
+
     // Χ루׼Ϊǰ
+    // Ԫظδ֪׷ӵβݣһת pos O(n + k)
     template<class T, class Alloc>
     template<class InputIterator>
     void vector<T, Alloc>::range_insert(iterator pos, InputIterator first,
         InputIterator last, input_iterator_tag) {
-        for (; first != last; ++first) {
-            pos = insert(pos, *first);
-            ++pos;
-        }
+        const size_type offset = static_cast<size_type>(pos - start);
+        const size_type old_size = size();
+        try {
+            for (; first != last; ++first) emplace_back(*first);
+        } catch (...) {
+            erase(start + old_size, finish);
+            throw;
+        }
+        mystl::rotate(start + offset, start + old_size, finish);
     }
 
     // Χ룬STLƥ
@@ -292,9 +348,9 @@ namespace mystl {
                 const size_type elems_after = finish - position;
                 iterator old_finish = finish;
                 if (elems_after > n) {
-                    mystl::uninitialized_copy(finish - n, finish, finish);
+                    mystl::uninitialized_move_if_noexcept(finish - n, finish, finish);
                     finish += n;
-                    mystl::copy_backward(position, old_finish - n, old_finish);
+                    mystl::move_backward(position, old_finish - n, old_finish);
                     mystl::copy(first, last, position);                             // Ӧfirst, last, position
                 }
                 else {                                                              // ο
@@ -302,7 +358,7 @@ namespace mystl {
                     advance(mid, elems_after);
                     mystl::uninitialized_copy(mid, last, finish);
                     finish += n - elems_after;
-                    mystl::uninitialized_copy(position, old_finish, finish);
+                    mystl::uninitialized_move_if_noexcept(position, old_finish, finish);
                     finish += elems_after;
                     mystl::copy(first, mid, position);
                 }
@@ -311,17 +367,25 @@ namespace mystl {
                 const size_type old_size = size();
                 const size_type new_size = old_size + mystl::max(old_size, n);
                 iterator new_start = data_allocator::allocate(new_size);
+                // ȹԪأٰԭԪأʧʱԭݲ
+                iterator new_pos = new_start + (position - start);
                 iterator new_finish = new_start;
+                try {
+                    mystl::uninitialized_copy(first, last, new_pos);
+                }
+                catch (...) {
+                    data_allocator::deallocate(new_start, new_size);
+                    throw;
+                }
                 try {
                     new_finish =
-                        mystl::uninitialized_copy(start, position, new_start);
-                    new_finish =
-                        mystl::uninitialized_copy(first, last, new_finish);
+                        mystl::uninitialized_move_if_noexcept(start, position, new_start);
                     new_finish =
-                        mystl::uninitialized_copy(position, finish, new_finish);
+                        mystl::uninitialized_move_if_noexcept(position, finish, new_pos + n);
                 }
-                catch (std::exception&) {
-                    destroy(new_start, new_finish);
+                catch (...) {
+                    mystl::destroy(new_start, new_finish);
+                    mystl::destroy(new_pos, new_pos + n);
                     data_allocator::deallocate(new_start, new_size);
                     throw;
                 }
@@ -352,29 +416,56 @@ namespace mystl {
             fill_insert(end(), new_size - size(), value);
     }
 
+    // ԪֵʼʱƣԪؿֻƶ
+    template<class T, class Alloc>
+    void vector<T, Alloc>::resize(size_type new_size) {
+        if (new_size < size()) {
+            erase(begin() + new_size, end());
+            return;
+        }
+        if (new_size > capacity())
+            reallocate(mystl::max(new_size, 2 * size()));
+        iterator cur = finish;
+        try {
+            for (; cur != start + new_size; ++cur) construct(cur);
+        }
+        catch (...) {
+            mystl::destroy(finish, cur);
+            throw;
+        }
+        finish = cur;
+    }
+
     template<class T, class Alloc>
     inline void vector<T, Alloc>::reserve(size_type new_capacity) {
         if (new_capacity <= capacity()) return;
-        T* new_start = data_allocator::allocate(new_capacity);
-        T* new_finish = mystl::uninitialized_copy(start, finish, new_start);
+        reallocate(new_capacity);
+    }
+
+    // Ԫصƶ첻쳣ʱƶƣʧʱԭݲ
+    template<class T, class Alloc>
+    void vector<T, Alloc>::reallocate(size_type new_capacity) {
+        iterator new_start = nullptr;
+        iterator new_finish = nullptr;
+        if (new_capacity != 0) {
+            new_start = data_allocator::allocate(new_capacity);
+            try {
+                new_finish = mystl::uninitialized_move_if_noexcept(start, finish, new_start);
+            }
+            catch (...) {
+                data_allocator::deallocate(new_start, new_capacity);
+                throw;
+            }
+        }
         destroy_and_deallocate();
         start = new_start;
         finish = new_finish;
-        end_of_storage = start + new_capacity;
+        end_of_storage = new_start + new_capacity;
     }
 
     template<class T, class Alloc>
     bool vector<T, Alloc>::operator==(const vector& rhs) const noexcept {
-        if (size() != rhs.size()) {
-            return false;
-        }
-        else {
-            iterator ptr1 = start;
-            iterator ptr2 = rhs.start;
-            for (; ptr1 != finish && ptr2 != rhs.finish; ++ptr1, ++ptr2)
-                if (*ptr1 != *ptr2) return false;
-            return true;
-        }
+        return size() == rhs.size() && mystl::equal(start, finish, rhs.start);
     }
 
     template<class T, class Alloc>
@@ -384,13 +475,14 @@ namespace mystl {
             ++finish;
         }
         else
-            insert_aux(end(), value);
+            realloc_insert(finish, value);
     }
 
     template<class T, class Alloc>
     inline typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(
         iterator first, iterator last) {
-        iterator i = mystl::copy(last, finish, first);
+        if (first == last) return first;   // 䣺ܰԪƶֵ
+        iterator i = mystl::move(last, finish, first);
         mystl::destroy(i, finish);
         finish -= (last - first);
         return first;
@@ -407,16 +499,16 @@ namespace mystl {
             const size_type elems_after = finish - position;                // ֮Ԫظ
             iterator old_finish = finish;
             if (elems_after > n) {                                          // ֮ԪظԪظ
-                mystl::uninitialized_copy(finish - n, finish, finish);      // finishǰnԪظƵfinish֮
+                mystl::uninitialized_move_if_noexcept(finish - n, finish, finish);      // finishǰnԪƵfinish֮
                 finish += n;
-                mystl::copy_backward(position, old_finish - n, old_finish); // copy_backwardӺǰƣͬҿ
+                mystl::move_backward(position, old_finish - n, old_finish); // move_backwardӺǰƶͬҿ
                 mystl::fill(position, position + n, value_copy);            // Ԫ䵽positionλ
             }
             else {                                                          // ֮ԪظСڵԪظ
                 mystl::uninitialized_fill_n(finish, n - elems_after,        // ԪأȻ󿽱Ԫأ󸲸ʣԪ
                     value_copy);
                 finish += n - elems_after;
-                mystl::uninitialized_copy(position, old_finish, finish);
+                mystl::uninitialized_move_if_noexcept(position, old_finish, finish);
                 finish += elems_after;
                 mystl::fill(position, old_finish, value_copy);// complement
             }
@@ -425,17 +517,24 @@ namespace mystl {
             const size_type old_size = size();
             const size_type new_size = old_size + mystl::max(old_size, n);  // ݵԭold_size + nС
             iterator new_start = data_allocator::allocate(new_size);        // ݵڴ
+            iterator new_pos = new_start + (position - start);              // Ԫأvalue ԭԪ
             iterator new_finish = new_start;
+            try {
+                mystl::uninitialized_fill_n(new_pos, n, value);
+            }
+            catch (...) {
+                data_allocator::deallocate(new_start, new_size);
+                throw;
+            }
             try {
                 new_finish =
-                    mystl::uninitialized_copy(start, position, new_start);
-                new_finish =
-                    mystl::uninitialized_fill_n(new_finish, n, value);
+                    mystl::uninitialized_move_if_noexcept(start, position, new_start);
                 new_finish =
-                    mystl::uninitialized_copy(position, finish, new_finish);
+                    mystl::uninitialized_move_if_noexcept(position, finish, new_pos + n);
             }
-            catch (std::exception&) {
+            catch (...) {
                 mystl::destroy(new_start, new_finish);                      // ͷԭڴռ
+                mystl::destroy(new_pos, new_pos + n);
                 data_allocator::deallocate(new_start, new_size);
                 throw;
             }
@@ -457,14 +556,7 @@ namespace mystl {
     template<class T, class Alloc>
     inline typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(
         iterator position, const value_type& value) {
-        size_type n = position - begin();
-        if (finish != end_of_storage && position == end()) {
-            construct(finish, value);
-            ++finish;
-        }
-        else
-            insert_aux(position, value);
-        return begin() + n;
+        return emplace(position, value);
     }
 
     // positionλòֵ
@@ -515,7 +607,7 @@ namespace mystl {
         }
         else if (size() >= len) {
             iterator new_finish = mystl::copy(first, last, start);
-            destroy(new_finish, finish);                           // ɾݵͷſռ
+            mystl::destroy(new_finish, finish);                           // ɾݵͷſռ
             finish = new_finish;
         }
         else {                                                     // µԪظԭԪظСcapacity
@@ -531,38 +623,15 @@ namespace mystl {
     template<class... Args>
     inline typename vector<T, Alloc>::iterator vector<T, Alloc>::emplace(iterator pos, Args&&... args) {
         const size_type n = pos - start;
-        if (finish != end_of_storage && pos == finish) {
-            construct(pos, mystl::forward<Args>(args)...);
-            ++finish;
+        if (finish == end_of_storage) {
+            realloc_insert(pos, mystl::forward<Args>(args)...);
         }
-        else if (finish != end_of_storage) {
-            iterator new_end = finish;
-            construct(finish, *(finish - 1));
-            ++new_end;
-            mystl::copy_backward(pos, finish - 1, finish);
-            construct(pos, mystl::forward<Args>(args)...);
-            finish = new_end;
+        else if (pos == finish) {
+            construct(finish, mystl::forward<Args>(args)...);
+            ++finish;
         }
-        else { // reallocate and emplace
-            const size_type old_size = size();
-            const size_type new_size = old_size + mystl::max(old_size, static_cast<const size_type>(1));
-            iterator new_start = data_allocator::allocate(new_size);
-            iterator new_finish = new_start;
-            try {
-                new_finish = mystl::uninitialized_copy(start, pos, new_start);
-                construct(new_finish, mystl::forward<Args>(args)...);
-                ++new_finish;
-                new_finish = mystl::uninitialized_copy(pos, finish, new_finish);
-            }
-            catch (std::exception&) {
-                mystl::destroy(new_start, new_finish);
-                data_allocator::deallocate(new_start, new_size);
-                throw;
-            }
-            destroy_and_deallocate();
-            start = new_start;
-            finish = new_finish;
-            end_of_storage = new_start + new_size;
+        else {
+            insert_aux(pos, mystl::forward<Args>(args)...);
         }
         return begin() + n;
     }
@@ -570,16 +639,16 @@ namespace mystl {
     // βԪ
     template<class T, class Alloc>
     template<class... Args>
-    inline typename vector<T, Alloc>::iterator
+    inline typename vector<T, Alloc>::reference
     vector<T, Alloc>::emplace_back(Args&&... args) {
         if (finish == end_of_storage) {
-            emplace(finish, mystl::forward<Args>(args)...);
+            realloc_insert(finish, mystl::forward<Args>(args)...);
         }
         else {
             construct(finish, mystl::forward<Args>(args)...);
             ++finish;
         }
-        return finish;
+        return *(finish - 1);
     }
 
 
@@ -665,4 +734,7 @@ namespace mystl {
         lhs.swap(rhs);
     }
 
-}// namespace mystl
\ No newline at end of file
+}// namespace mystl
+
+// vector<bool> İλػ
+#include "bvector.h"